@@ -6,6 +6,7 @@
 #include <azure/core/azure_assert.hpp>
 
 #include <atomic>
+#include <condition_variable>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -51,7 +52,15 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     std::mutex m_pollablesMutex;
     std::thread m_pollingThread;
     std::atomic<bool> m_activelyPolling;
-    bool m_stopped{false};
+    std::atomic<bool> m_stopped{false};
+
+    // The polling thread waits on m_wakeCondition between passes. The wait is kept short while
+    // there is AMQP traffic and backs off when the connections are idle. m_wakeMutex is
+    // deliberately separate from m_pollablesMutex so that a notification never contends with
+    // RemovePollable.
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    bool m_workPending{false};
 #elif ENABLE_RUST_AMQP
     RustRuntimeContext m_runtimeContext;
 #endif
@@ -69,6 +78,14 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     void AddPollable(std::shared_ptr<Pollable> pollable);
 
     void RemovePollable(std::shared_ptr<Pollable> pollable);
+
+    /**
+     * @brief Wakes the polling thread so that queued AMQP work is processed immediately instead
+     * of after the current poll interval has elapsed.
+     *
+     * @remarks This is cheap and may be called while holding connection or link locks.
+     */
+    void NotifyPendingWork();
 #elif ENABLE_RUST_AMQP
     Azure::Core::Amqp::_detail::RustRuntimeContext* GetRuntimeContext()
     {
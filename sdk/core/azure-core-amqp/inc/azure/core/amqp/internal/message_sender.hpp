@@ -15,6 +15,8 @@
 
 #include <azure/core/nullable.hpp>
 
+#include <functional>
+#include <future>
 #include <tuple>
 
 #if defined(_azure_TESTING_BUILD)
@@ -122,6 +124,17 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
      */
     Nullable<uint32_t> InitialDeliveryCount;
 
+    /** @brief The maximum number of messages sent with SendAsync which may be in flight at once.
+     *
+     * A message is in flight from the call to SendAsync until its completion has been reported.
+     * When the window is full, SendAsync waits for the oldest message to complete. Messages which
+     * exceed the link credit granted by the peer are held by the sender until more credit arrives,
+     * and count against the window. If zero, MaxLinkCredits is used, and if that is zero too, the
+     * number of messages in flight is not limited.
+     *
+     */
+    uint32_t MaxUnsettledDeliveries{};
+
     /** @brief If true, the message sender will log trace events. */
     bool EnableTrace{false};
 
@@ -134,6 +147,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
 #if ENABLE_UAMQP
     using MessageSendCompleteCallback
         = std::function<void(MessageSendStatus sendResult, Models::AmqpValue const& deliveryState)>;
+
+    /** @brief Reports the outcome of a message sent with SendAsync. */
+    using MessageSendResultCallback = std::function<
+        void(MessageSendStatus sendResult, Models::_internal::AmqpError const& error)>;
 #endif
     ~MessageSender() noexcept;
 
@@ -181,6 +198,38 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
     _azure_NODISCARD std::tuple<MessageSendStatus, Models::_internal::AmqpError> Send(
         Models::AmqpMessage const& message,
         Context const& context = {});
+
+    /** @brief Send a message without waiting for the peer to settle it.
+     *
+     * The completion of each message is reported in the order in which the messages were passed to
+     * SendAsync, once all the messages sent before it have completed. The callback is called on the
+     * thread which processes the connection, so it must not block waiting on other sends.
+     *
+     * @param message The message to send.
+     * @param onSendComplete Called with the status of the send operation and the send disposition.
+     * @param context The context to use for the operation. If it is cancelled before the message
+     * is queued, the send completes with MessageSendStatus::Cancelled.
+     *
+     * @throw Azure::Core::OperationCancelledException if the context is cancelled while waiting
+     * for room in the window of messages in flight. The callback is not called in that case.
+     */
+    void SendAsync(
+        Models::AmqpMessage const& message,
+        MessageSendResultCallback onSendComplete,
+        Context const& context = {});
+
+    /** @brief Send a message without waiting for the peer to settle it.
+     *
+     * @param message The message to send.
+     * @param context The context to use for the operation.
+     *
+     * @return A future which holds the status of the send operation and the send disposition.
+     *
+     * @throw Azure::Core::OperationCancelledException if the context is cancelled while waiting
+     * for room in the window of messages in flight.
+     */
+    _azure_NODISCARD std::future<std::tuple<MessageSendStatus, Models::_internal::AmqpError>>
+    SendAsync(Models::AmqpMessage const& message, Context const& context = {});
 #elif ENABLE_RUST_AMQP
     _azure_NODISCARD Models::_internal::AmqpError Send(
         Models::AmqpMessage const& message,
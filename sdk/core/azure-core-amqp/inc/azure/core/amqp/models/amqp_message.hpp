@@ -210,6 +210,16 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
      */
     void SetBody(std::vector<AmqpBinaryData> const& bodyBinarySequence);
 
+    /** @brief Set the body of the message, taking ownership of a sequence of data values.
+     *
+     * @param bodyBinarySequence - a sequence of binary data which makes up the body of the
+     * message.
+     *
+     * @remarks This avoids copying the binary data when the caller no longer needs it.
+     *
+     */
+    void SetBody(std::vector<AmqpBinaryData>&& bodyBinarySequence);
+
     /** @brief Appends a binary value to the body of the message.
      *
      * An AMQP Message Body can be one of the following formats:
@@ -271,6 +281,18 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
      */
     static std::vector<uint8_t> Serialize(AmqpMessage const& message);
 
+    /** @brief Serialize the message, appending the bytes to an existing buffer.
+     *
+     * @param[in] message The message to serialize.
+     * @param[in,out] buffer The buffer the serialized message is appended to.
+     *
+     * @remarks The buffer is grown once to hold the whole message before it is written, and is
+     * left unchanged if serialization fails.
+     *
+     * @remarks This API will fail if BodyType is not set.
+     */
+    static void Serialize(AmqpMessage const& message, std::vector<uint8_t>& buffer);
+
     /** @brief Deserialize the message from a buffer.
      *
      * @remarks This API will fail if BodyType is not set.
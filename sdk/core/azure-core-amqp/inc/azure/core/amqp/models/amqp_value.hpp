@@ -551,6 +551,13 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
     /** @brief Serialize this AMQP value as an array of bytes. */
     static std::vector<uint8_t> Serialize(AmqpValue const& value);
 
+    /** @brief Serialize this AMQP value, appending the bytes to an existing buffer.
+     *
+     * @param[in] value The AMQP value to serialize.
+     * @param[in,out] buffer The buffer the serialized form of the value is appended to.
+     */
+    static void Serialize(AmqpValue const& value, std::vector<uint8_t>& buffer);
+
     /** @brief Returns the size (in bytes) of the serialized form of this value */
     static size_t GetSerializedSize(AmqpValue const& value);
 
@@ -585,7 +592,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models { namespace
     using initializer_type = std::initializer_list<typename T::value_type>;
 
     AmqpCollectionBase(initializer_type const& initializer) : m_value{initializer} {}
-    AmqpCollectionBase(T initializer) : m_value{initializer} {}
+    AmqpCollectionBase(T initializer) : m_value{std::move(initializer)} {}
     AmqpCollectionBase(){};
 
     // Copy constructor
@@ -818,6 +825,8 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
     AmqpBinaryData(initializer_type const& values) : AmqpCollectionBase(values){};
     /** @brief Construct a new AmqpBinaryData from a vector of bytes. */
     AmqpBinaryData(std::vector<std::uint8_t> const& values) : AmqpCollectionBase(values){};
+    /** @brief Construct a new AmqpBinaryData by taking ownership of a vector of bytes. */
+    AmqpBinaryData(std::vector<std::uint8_t>&& values) : AmqpCollectionBase(std::move(values)){};
 
     /** @brief Copy constructor */
     AmqpBinaryData(const AmqpBinaryData& other) = default;
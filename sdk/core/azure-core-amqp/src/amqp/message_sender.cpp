@@ -17,6 +17,7 @@
 #include <azure/core/internal/diagnostics/log.hpp>
 #include <azure/core/platform.hpp>
 
+#include <future>
 #include <memory>
 
 using namespace Azure::Core::Diagnostics;
@@ -64,6 +65,30 @@ namespace Azure { namespace Core { namespace Amqp { namespace _internal {
   {
     return m_impl->Send(message, context);
   }
+
+  void MessageSender::SendAsync(
+      Models::AmqpMessage const& message,
+      MessageSendResultCallback onSendComplete,
+      Context const& context)
+  {
+    m_impl->SendAsync(message, std::move(onSendComplete), context);
+  }
+
+  std::future<std::tuple<MessageSendStatus, Models::_internal::AmqpError>> MessageSender::SendAsync(
+      Models::AmqpMessage const& message,
+      Context const& context)
+  {
+    using SendResult = std::tuple<MessageSendStatus, Models::_internal::AmqpError>;
+    auto promise = std::make_shared<std::promise<SendResult>>();
+    auto result = promise->get_future();
+    m_impl->SendAsync(
+        message,
+        [promise](MessageSendStatus sendResult, Models::_internal::AmqpError const& error) {
+          promise->set_value(std::make_tuple(sendResult, error));
+        },
+        context);
+    return result;
+  }
 #elif ENABLE_RUST_AMQP
   Models::_internal::AmqpError MessageSender::Send(
       Models::AmqpMessage const& message,
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iomanip>
 #include <list>
 #include <mutex>
@@ -31,6 +32,13 @@ using namespace Azure::Core::Diagnostics;
 namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace _detail {
 
 #if ENABLE_UAMQP
+  namespace {
+    // The polling thread polls again after MinimumPollInterval when it has been told about new
+    // work, and doubles the interval on every idle pass up to MaximumPollInterval.
+    constexpr std::chrono::milliseconds MinimumPollInterval{1};
+    constexpr std::chrono::milliseconds MaximumPollInterval{100};
+  } // namespace
+
   // Logging callback for uAMQP and azure-c-shared-utility.
   void AmqpLogFunction(
       LOG_CATEGORY logCategory,
@@ -107,19 +115,15 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     xlogging_set_log_function(AmqpLogFunction);
 
     m_pollingThread = std::thread([this]() {
+      auto pollInterval = MaximumPollInterval;
       do
       {
         {
           std::list<std::shared_ptr<Pollable>> capturedList;
           {
             std::unique_lock<std::mutex> lock{m_pollablesMutex};
-            // If there are no pollables, there's no point in doing any work.
-            if (m_pollables.empty())
-            {
-              continue;
-            }
             capturedList = m_pollables;
-            m_activelyPolling = true;
+            m_activelyPolling = !capturedList.empty();
           }
 
           for (auto const& pollable : capturedList)
@@ -128,8 +132,27 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
           }
         }
         m_activelyPolling = false;
-        //        std::this_thread::yield();
-        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        // uAMQP does not expose the underlying sockets, so we cannot wait for them to become
+        // ready. Instead, wait until either a caller reports new work or the poll interval
+        // elapses. Back off while the connections are idle so that they don't burn CPU.
+        {
+          std::unique_lock<std::mutex> lock{m_wakeMutex};
+          if (!m_workPending && !m_stopped)
+          {
+            m_wakeCondition.wait_for(
+                lock, pollInterval, [this]() { return m_workPending || m_stopped.load(); });
+          }
+          if (m_workPending)
+          {
+            m_workPending = false;
+            pollInterval = MinimumPollInterval;
+          }
+          else
+          {
+            pollInterval = (std::min)(pollInterval * 2, MaximumPollInterval);
+          }
+        }
       } while (!m_stopped);
     });
 #endif
@@ -138,7 +161,11 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
   GlobalStateHolder::~GlobalStateHolder()
   {
 #if ENABLE_UAMQP
-    m_stopped = true;
+    {
+      std::lock_guard<std::mutex> lock(m_wakeMutex);
+      m_stopped = true;
+    }
+    m_wakeCondition.notify_one();
     if (m_pollingThread.joinable())
     {
       m_pollingThread.join();
@@ -171,6 +198,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     {
       m_pollables.push_back(pollable);
     }
+    NotifyPendingWork();
   }
 
   void GlobalStateHolder::RemovePollable(std::shared_ptr<Pollable> pollable)
@@ -201,6 +229,15 @@ namespace Azure { namespace Core { namespace Amqp { namespace Common { namespace
     while (m_activelyPolling.load())
       ;
   }
+
+  void GlobalStateHolder::NotifyPendingWork()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_wakeMutex);
+      m_workPending = true;
+    }
+    m_wakeCondition.notify_one();
+  }
 #endif
 
   GlobalStateHolder* GlobalStateHolder::GlobalStateInstance()
@@ -133,17 +133,20 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     // the message receiver is open before attempting to process the incoming message.
     if (receiver->m_receiverOpen)
     {
-      auto incomingMessage(Models::_detail::AmqpMessageFactory::FromImplementation(message));
+      // Incoming traffic is usually followed by more of it (and by dispositions from the
+      // application), keep the polling thread on its short interval while it lasts.
+      Common::_detail::GlobalStateHolder::GlobalStateInstance()->NotifyPendingWork();
+
       Models::AmqpValue rv;
       if (receiver->m_eventHandler)
       {
         rv = receiver->m_eventHandler->OnMessageReceived(
             MessageReceiverFactory::CreateFromInternal(receiver->shared_from_this()),
-            incomingMessage);
+            Models::_detail::AmqpMessageFactory::FromImplementation(message));
       }
       else
       {
-        rv = receiver->OnMessageReceived(incomingMessage);
+        rv = receiver->OnMessageReceived(message);
       }
       return amqpvalue_clone(Models::_detail::AmqpValueFactory::ToImplementation(rv));
     }
@@ -155,10 +158,20 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
             {})));
   }
 
-  Models::AmqpValue MessageReceiverImpl::OnMessageReceived(
-      std::shared_ptr<Models::AmqpMessage> const& message)
+  Models::AmqpValue MessageReceiverImpl::OnMessageReceived(MESSAGE_HANDLE message)
   {
-    m_messageQueue.CompleteOperation(message, Models::_internal::AmqpError{});
+    // This runs on the thread polling every connection, so the message is only cloned here: the
+    // clone shares the AMQP values of the message and copies its body. It is converted to an
+    // AmqpMessage by the thread which receives it.
+    Models::_detail::UniqueMessageHandle clone{message_clone(message)};
+    if (!clone)
+    {
+      return Models::_internal::Messaging::DeliveryRejected(
+          Models::_internal::AmqpErrorCondition::InternalError.ToString(),
+          "Could not copy the received message.",
+          {});
+    }
+    m_messageQueue.CompleteOperation(std::move(clone), Models::_internal::AmqpError{});
     return Models::_internal::Messaging::DeliveryAccepted();
   }
 
@@ -198,10 +211,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     if (result)
     {
       std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError> rv;
-      std::shared_ptr<Models::AmqpMessage> message{std::move(std::get<0>(*result))};
+      auto const& message = std::get<0>(*result);
       if (message)
       {
-        rv.first = std::move(message);
+        rv.first = Models::_detail::AmqpMessageFactory::FromImplementation(message.get());
       }
       rv.second = std::move(std::get<1>(*result));
       return rv;
@@ -223,10 +236,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     if (result)
     {
       std::pair<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError> rv;
-      std::shared_ptr<Models::AmqpMessage> message{std::move(std::get<0>(*result))};
+      auto const& message = std::get<0>(*result);
       if (message)
       {
-        rv.first = std::move(message);
+        rv.first = Models::_detail::AmqpMessageFactory::FromImplementation(message.get());
       }
       rv.second = std::move(std::get<1>(*result));
       return rv;
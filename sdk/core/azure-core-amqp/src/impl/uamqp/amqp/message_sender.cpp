@@ -19,7 +19,9 @@
 
 #include <azure_uamqp_c/message_sender.h>
 
+#include <chrono>
 #include <memory>
+#include <vector>
 
 using namespace Azure::Core::Diagnostics;
 using namespace Azure::Core::Diagnostics::_internal;
@@ -125,6 +127,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
       Azure::Core::_internal::AzureNoReturnPath("MessageSenderImpl is being destroyed while open.");
     }
 
+    // Close normally fails any outstanding sends; this covers a sender whose Close did not get
+    // that far. No send callback may run once the link and message sender are gone.
+    FailPendingSends();
+
     if (m_link)
     {
       // Unsubscribe from any detach events before clearing out the event handler to short-circuit
@@ -403,6 +409,10 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
           throw std::runtime_error("Could not close message sender");
         }
       }
+      // Closing the message sender fails the messages it was still sending. Anything sent with
+      // SendAsync which has not completed by now never will, so fail it before the link goes.
+      FailPendingSends();
+
       // The message sender (and it's underlying link) is in the half open state. Wait until the
       // link has fully closed.
       if (shouldWaitForClose)
@@ -513,7 +523,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     }
   };
 
-  void MessageSenderImpl::QueueSendInternal(
+  bool MessageSenderImpl::QueueSendInternal(
       Models::AmqpMessage const& message,
       Azure::Core::Amqp::_internal::MessageSender::MessageSendCompleteCallback onSendComplete,
       Context const& context)
@@ -522,22 +532,74 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     // Note that normally this would be handled via uAMQP's async operation cancellation, but if the
     // remote node sends an incoming frame, the async operation completion handler will be called
     // twice, which results in a double free of the underlying operation.
-    if (!context.IsCancelled())
-    {
-      auto operation(std::make_unique<Azure::Core::Amqp::Common::_internal::CompletionOperation<
-                         decltype(onSendComplete),
-                         RewriteSendComplete<decltype(onSendComplete)>>>(onSendComplete));
-      auto result = messagesender_send_async(
-          m_messageSender.get(),
-          Models::_detail::AmqpMessageFactory::ToImplementation(message).get(),
-          std::remove_pointer<decltype(operation)::element_type>::type::OnOperationFn,
-          operation.release(),
-          0 /*timeout*/);
-      if (result == nullptr)
+    if (context.IsCancelled())
+    {
+      return false;
+    }
+    auto operation(std::make_unique<Azure::Core::Amqp::Common::_internal::CompletionOperation<
+                       decltype(onSendComplete),
+                       RewriteSendComplete<decltype(onSendComplete)>>>(onSendComplete));
+    auto result = messagesender_send_async(
+        m_messageSender.get(),
+        Models::_detail::AmqpMessageFactory::ToImplementation(message).get(),
+        std::remove_pointer<decltype(operation)::element_type>::type::OnOperationFn,
+        operation.release(),
+        0 /*timeout*/);
+    if (result == nullptr)
+    {
+      throw std::runtime_error("Could not send message");
+    }
+    // Wake the polling thread so the message goes out on the wire now instead of on the next
+    // poll interval.
+    Common::_detail::GlobalStateHolder::GlobalStateInstance()->NotifyPendingWork();
+    return true;
+  }
+
+  Models::_internal::AmqpError MessageSenderImpl::GetSendError(
+      _internal::MessageSendStatus sendResult,
+      Models::AmqpValue const& deliveryStatus)
+  {
+    Models::_internal::AmqpError error;
+
+    // If the send failed. then we need to return the error. If the send completed because
+    // of an error, it's possible that the deliveryStatus provided is null. In that case,
+    // we use the cached saved error because it is highly likely to be better than
+    // nothing.
+    if (sendResult != _internal::MessageSendStatus::Ok)
+    {
+      if (deliveryStatus.IsNull())
       {
-        throw std::runtime_error("Could not send message");
+        error = m_savedMessageError;
       }
+      else
+      {
+        if (deliveryStatus.GetType() != Models::AmqpValueType::List)
+        {
+          throw std::runtime_error("Delivery status is not a list");
+        }
+        auto deliveryStatusAsList{deliveryStatus.AsList()};
+        if (deliveryStatusAsList.size() != 1)
+        {
+          throw std::runtime_error("Delivery Status list is not of size 1");
+        }
+        Models::AmqpValue firstState{deliveryStatusAsList[0]};
+        ERROR_HANDLE errorHandle;
+        if (!amqpvalue_get_error(
+                Models::_detail::AmqpValueFactory::ToImplementation(firstState), &errorHandle))
+        {
+          Models::_detail::UniqueAmqpErrorHandle uniqueError{
+              errorHandle}; // This will free the error handle when it goes out of scope.
+          error = Models::_detail::AmqpErrorFactory::FromImplementation(errorHandle);
+        }
+      }
+    }
+    else
+    {
+      // If we successfully sent the message, then whatever saved error should be cleared,
+      // it's no longer valid.
+      m_savedMessageError = Models::_internal::AmqpError();
     }
+    return error;
   }
 
   std::tuple<_internal::MessageSendStatus, Models::_internal::AmqpError> MessageSenderImpl::Send(
@@ -552,47 +614,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
           [this](
               Azure::Core::Amqp::_internal::MessageSendStatus sendResult,
               Models::AmqpValue deliveryStatus) {
-            Models::_internal::AmqpError error;
-
-            // If the send failed. then we need to return the error. If the send completed because
-            // of an error, it's possible that the deliveryStatus provided is null. In that case,
-            // we use the cached saved error because it is highly likely to be better than
-            // nothing.
-            if (sendResult != _internal::MessageSendStatus::Ok)
-            {
-              if (deliveryStatus.IsNull())
-              {
-                error = m_savedMessageError;
-              }
-              else
-              {
-                if (deliveryStatus.GetType() != Models::AmqpValueType::List)
-                {
-                  throw std::runtime_error("Delivery status is not a list");
-                }
-                auto deliveryStatusAsList{deliveryStatus.AsList()};
-                if (deliveryStatusAsList.size() != 1)
-                {
-                  throw std::runtime_error("Delivery Status list is not of size 1");
-                }
-                Models::AmqpValue firstState{deliveryStatusAsList[0]};
-                ERROR_HANDLE errorHandle;
-                if (!amqpvalue_get_error(
-                        Models::_detail::AmqpValueFactory::ToImplementation(firstState),
-                        &errorHandle))
-                {
-                  Models::_detail::UniqueAmqpErrorHandle uniqueError{
-                      errorHandle}; // This will free the error handle when it goes out of scope.
-                  error = Models::_detail::AmqpErrorFactory::FromImplementation(errorHandle);
-                }
-              }
-            }
-            else
-            {
-              // If we successfully sent the message, then whatever saved error should be cleared,
-              // it's no longer valid.
-              m_savedMessageError = Models::_internal::AmqpError();
-            }
+            auto error = GetSendError(sendResult, deliveryStatus);
             m_sendCompleteQueue.CompleteOperation(sendResult, error);
           },
           context);
@@ -612,6 +634,152 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     }
   }
 
+  void MessageSenderImpl::SendAsync(
+      Models::AmqpMessage const& message,
+      _internal::MessageSender::MessageSendResultCallback onSendComplete,
+      Context const& context)
+  {
+    auto const maxInFlight = m_options.MaxUnsettledDeliveries != 0
+        ? m_options.MaxUnsettledDeliveries
+        : m_options.MaxLinkCredits;
+
+    auto pendingSend = std::make_shared<PendingSend>();
+    pendingSend->OnSendComplete = std::move(onSendComplete);
+    {
+      std::unique_lock<std::mutex> lock(m_pendingSendsLock);
+      while (maxInFlight != 0 && m_pendingSends.size() >= maxInFlight)
+      {
+        if (context.IsCancelled())
+        {
+          throw Azure::Core::OperationCancelledException("Message send operation cancelled.");
+        }
+        // The context can't signal the condition variable, so check it periodically.
+        m_pendingSendCompleted.wait_for(lock, std::chrono::milliseconds(100));
+      }
+      m_pendingSends.push_back(pendingSend);
+    }
+
+    bool queued{};
+    try
+    {
+      auto lock{m_session->GetConnection()->Lock()};
+      queued = QueueSendInternal(
+          message,
+          [weakSender = std::weak_ptr<MessageSenderImpl>(shared_from_this()), pendingSend](
+              Azure::Core::Amqp::_internal::MessageSendStatus sendResult,
+              Models::AmqpValue deliveryStatus) {
+            // The sender fails its outstanding sends before it is destroyed, so if it has gone
+            // away there is nothing left to report.
+            auto sender = weakSender.lock();
+            if (!sender)
+            {
+              return;
+            }
+            Models::_internal::AmqpError error;
+            try
+            {
+              error = sender->GetSendError(sendResult, deliveryStatus);
+            }
+            catch (std::exception const& ex)
+            {
+              // The entry must still complete, or the sends queued after it would never be
+              // reported.
+              sendResult = _internal::MessageSendStatus::Error;
+              error = {Models::_internal::AmqpErrorCondition::InternalError, ex.what(), {}};
+            }
+            sender->CompletePendingSend(pendingSend, sendResult, std::move(error));
+          },
+          context);
+    }
+    catch (std::exception const& ex)
+    {
+      CompletePendingSend(
+          pendingSend,
+          _internal::MessageSendStatus::Error,
+          {Models::_internal::AmqpErrorCondition::InternalError, ex.what(), {}});
+      return;
+    }
+    if (!queued)
+    {
+      CompletePendingSend(
+          pendingSend,
+          _internal::MessageSendStatus::Cancelled,
+          {Models::_internal::AmqpErrorCondition::OperationCancelled,
+           "Message send operation cancelled.",
+           {}});
+    }
+  }
+
+  void MessageSenderImpl::CompletePendingSend(
+      std::shared_ptr<PendingSend> const& pendingSend,
+      _internal::MessageSendStatus sendResult,
+      Models::_internal::AmqpError error)
+  {
+    std::unique_lock<std::mutex> lock(m_pendingSendsLock);
+    if (pendingSend->Completed)
+    {
+      // The send was already failed by FailPendingSends.
+      return;
+    }
+    pendingSend->Completed = true;
+    pendingSend->Status = sendResult;
+    pendingSend->Error = std::move(error);
+
+    // Only one thread reports completions at a time; it picks up the entries completed by other
+    // threads (or by its own callbacks) while it reports, so they are reported in send order.
+    if (m_reportingCompletions)
+    {
+      return;
+    }
+    m_reportingCompletions = true;
+    while (!m_pendingSends.empty() && m_pendingSends.front()->Completed)
+    {
+      auto completed = std::move(m_pendingSends.front());
+      m_pendingSends.pop_front();
+      lock.unlock();
+      m_pendingSendCompleted.notify_all();
+
+      if (completed->OnSendComplete)
+      {
+        try
+        {
+          completed->OnSendComplete(completed->Status, completed->Error);
+        }
+        catch (std::exception const& ex)
+        {
+          Log::Stream(Logger::Level::Warning)
+              << "Message send completion callback threw an exception: " << ex.what();
+        }
+      }
+      lock.lock();
+    }
+    m_reportingCompletions = false;
+  }
+
+  void MessageSenderImpl::FailPendingSends()
+  {
+    std::vector<std::shared_ptr<PendingSend>> outstandingSends;
+    {
+      std::unique_lock<std::mutex> lock(m_pendingSendsLock);
+      for (auto const& pendingSend : m_pendingSends)
+      {
+        if (!pendingSend->Completed)
+        {
+          outstandingSends.push_back(pendingSend);
+        }
+      }
+    }
+    for (auto const& pendingSend : outstandingSends)
+    {
+      CompletePendingSend(
+          pendingSend,
+          _internal::MessageSendStatus::Cancelled,
+          {Models::_internal::AmqpErrorCondition::OperationCancelled,
+           "Message sender was closed before the send completed.",
+           {}});
+    }
+  }
+
   std::string MessageSenderImpl::GetLinkName() const { return m_link->GetName(); }
 
 }}}} // namespace Azure::Core::Amqp::_detail
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "../../../../amqp/private/unique_handle.hpp"
+#include "../../../../models/private/message_impl.hpp"
 #include "azure/core/amqp/internal/message_receiver.hpp"
 #include "link_impl.hpp"
 #include "session_impl.hpp"
@@ -82,8 +83,9 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     bool m_linkPollingEnabled{false};
     std::mutex m_mutableState;
 
+    // Received messages are queued as uAMQP messages, and converted when they are dequeued.
     Azure::Core::Amqp::Common::_internal::
-        AsyncOperationQueue<std::shared_ptr<Models::AmqpMessage>, Models::_internal::AmqpError>
+        AsyncOperationQueue<Models::_detail::UniqueMessageHandle, Models::_internal::AmqpError>
             m_messageQueue;
 
     // When we close a uAMQP messagereceiver, the link is left in the half closed state. We need to
@@ -95,8 +97,7 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     _internal::MessageReceiverEvents* m_eventHandler{};
     static AMQP_VALUE OnMessageReceivedFn(const void* context, MESSAGE_HANDLE message);
 
-    virtual Models::AmqpValue OnMessageReceived(
-        std::shared_ptr<Models::AmqpMessage> const& message);
+    Models::AmqpValue OnMessageReceived(MESSAGE_HANDLE message);
 
     void OnLinkDetached(Models::_internal::AmqpError const& error);
 
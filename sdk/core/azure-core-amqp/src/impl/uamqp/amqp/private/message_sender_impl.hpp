@@ -9,6 +9,11 @@
 
 #include <azure_uamqp_c/message_sender.h>
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
 namespace Azure { namespace Core { namespace Amqp { namespace _detail {
   template <> struct UniqueHandleHelper<MESSAGE_SENDER_INSTANCE_TAG>
   {
@@ -55,12 +60,25 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     std::tuple<_internal::MessageSendStatus, Models::_internal::AmqpError> Send(
         Models::AmqpMessage const& message,
         Context const& context);
+    void SendAsync(
+        Models::AmqpMessage const& message,
+        _internal::MessageSender::MessageSendResultCallback onSendComplete,
+        Context const& context);
 
     std::uint64_t GetMaxMessageSize() const;
 
     std::string GetLinkName() const;
 
   private:
+    // A message sent with SendAsync whose completion has not been reported yet.
+    struct PendingSend final
+    {
+      _internal::MessageSender::MessageSendResultCallback OnSendComplete;
+      bool Completed{false};
+      _internal::MessageSendStatus Status{};
+      Models::_internal::AmqpError Error;
+    };
+
     static void OnMessageSenderStateChangedFn(
         void* context,
         MESSAGE_SENDER_STATE newState,
@@ -68,10 +86,19 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
     void CreateLink();
     void CreateLink(_internal::LinkEndpoint& endpoint);
     void PopulateLinkProperties();
-    void QueueSendInternal(
+    bool QueueSendInternal(
         Models::AmqpMessage const& message,
         Azure::Core::Amqp::_internal::MessageSender::MessageSendCompleteCallback onSendComplete,
         Context const& context);
+    Models::_internal::AmqpError GetSendError(
+        _internal::MessageSendStatus sendResult,
+        Models::AmqpValue const& deliveryStatus);
+    void CompletePendingSend(
+        std::shared_ptr<PendingSend> const& pendingSend,
+        _internal::MessageSendStatus sendResult,
+        Models::_internal::AmqpError error);
+    // Completes every outstanding SendAsync entry as cancelled.
+    void FailPendingSends();
     void OnLinkDetached(Models::_internal::AmqpError const& error);
 
     bool m_senderOpen{false};
@@ -90,6 +117,13 @@ namespace Azure { namespace Core { namespace Amqp { namespace _detail {
         m_closeQueue;
     _internal::MessageSenderState m_currentState{};
 
+    // Messages sent with SendAsync, in the order they were sent. Completed entries stay in the
+    // queue until the entries before them have completed, so completions are reported in order.
+    std::mutex m_pendingSendsLock;
+    std::condition_variable m_pendingSendCompleted;
+    std::deque<std::shared_ptr<PendingSend>> m_pendingSends;
+    bool m_reportingCompletions{false};
+
     std::shared_ptr<_detail::SessionImpl> m_session;
     Models::_internal::MessageTarget m_target;
     _internal::MessageSenderOptions m_options;
@@ -543,6 +543,11 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
     BodyType = MessageBodyType::Data;
     m_binaryDataBody = value;
   }
+  void AmqpMessage::SetBody(std::vector<AmqpBinaryData>&& value)
+  {
+    BodyType = MessageBodyType::Data;
+    m_binaryDataBody = std::move(value);
+  }
   void AmqpMessage::SetBody(AmqpValue const& value)
   {
     BodyType = MessageBodyType::Value;
@@ -589,37 +594,42 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
   std::vector<uint8_t> AmqpMessage::Serialize(AmqpMessage const& message)
   {
     std::vector<uint8_t> rv;
+    Serialize(message, rv);
+    return rv;
+  }
+
+  void AmqpMessage::Serialize(AmqpMessage const& message, std::vector<uint8_t>& buffer)
+  {
+    // Build each section of the message first so that the buffer can be sized once, and each
+    // section then encoded straight into it.
+    std::vector<AmqpValue> sections;
 
-    // Append the message Header to the serialized message.
     if (message.Header.ShouldSerialize())
     {
-      auto serializedHeader = MessageHeader::Serialize(message.Header);
-      rv.insert(rv.end(), serializedHeader.begin(), serializedHeader.end());
+      auto handle = _detail::MessageHeaderFactory::ToImplementation(message.Header);
+      sections.emplace_back(_detail::AmqpValueFactory::FromImplementation(
+          _detail::UniqueAmqpValueHandle{amqpvalue_create_header(handle.get())}));
     }
     if (!message.DeliveryAnnotations.empty())
     {
-      AmqpValue deliveryAnnotations{
+      sections.emplace_back(
           _detail::AmqpValueFactory::FromImplementation(_detail::UniqueAmqpValueHandle{
               amqpvalue_create_delivery_annotations(_detail::AmqpValueFactory::ToImplementation(
-                  message.DeliveryAnnotations.AsAmqpValue()))})};
-      auto serializedDeliveryAnnotations = AmqpValue::Serialize(deliveryAnnotations);
-      rv.insert(
-          rv.end(), serializedDeliveryAnnotations.begin(), serializedDeliveryAnnotations.end());
+                  message.DeliveryAnnotations.AsAmqpValue()))}));
     }
     if (!message.MessageAnnotations.empty())
     {
-      AmqpValue messageAnnotations{
+      sections.emplace_back(
           _detail::AmqpValueFactory::FromImplementation(_detail::UniqueAmqpValueHandle{
               amqpvalue_create_message_annotations(_detail::AmqpValueFactory::ToImplementation(
-                  message.MessageAnnotations.AsAmqpValue()))})};
-      auto serializedAnnotations = AmqpValue::Serialize(messageAnnotations);
-      rv.insert(rv.end(), serializedAnnotations.begin(), serializedAnnotations.end());
+                  message.MessageAnnotations.AsAmqpValue()))}));
     }
 
     if (message.Properties.ShouldSerialize())
     {
-      auto serializedMessageProperties = MessageProperties::Serialize(message.Properties);
-      rv.insert(rv.end(), serializedMessageProperties.begin(), serializedMessageProperties.end());
+      auto handle = _detail::MessagePropertiesFactory::ToImplementation(message.Properties);
+      sections.emplace_back(_detail::AmqpValueFactory::FromImplementation(
+          _detail::UniqueAmqpValueHandle{amqpvalue_create_properties(handle.get())}));
     }
 
     if (!message.ApplicationProperties.empty())
@@ -637,12 +647,9 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
         }
         appProperties.emplace(val);
       }
-      AmqpValue propertiesValue{Models::_detail::AmqpValueFactory::FromImplementation(
+      sections.emplace_back(Models::_detail::AmqpValueFactory::FromImplementation(
           Models::_detail::UniqueAmqpValueHandle{amqpvalue_create_application_properties(
-              Models::_detail::AmqpValueFactory::ToImplementation(appProperties.AsAmqpValue()))})};
-      auto serializedApplicationProperties = AmqpValue::Serialize(propertiesValue);
-      rv.insert(
-          rv.end(), serializedApplicationProperties.begin(), serializedApplicationProperties.end());
+              Models::_detail::AmqpValueFactory::ToImplementation(appProperties.AsAmqpValue()))}));
     }
 
     switch (message.BodyType)
@@ -651,44 +658,60 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
       case MessageBodyType::Invalid:
         throw std::runtime_error("Invalid message body type.");
 
-      case MessageBodyType::Value: {
+      case MessageBodyType::Value:
         // The message body element is an AMQP Described type, create one and serialize the
         // described body.
-        AmqpDescribed describedBody(
-            static_cast<std::uint64_t>(AmqpDescriptors::DataAmqpValue), message.m_amqpValueBody);
-        auto serializedBodyValue = AmqpValue::Serialize(describedBody.AsAmqpValue());
-        rv.insert(rv.end(), serializedBodyValue.begin(), serializedBodyValue.end());
-      }
-      break;
+        sections.emplace_back(AmqpDescribed(
+                                  static_cast<std::uint64_t>(AmqpDescriptors::DataAmqpValue),
+                                  message.m_amqpValueBody)
+                                  .AsAmqpValue());
+        break;
       case MessageBodyType::Data:
         for (auto const& val : message.m_binaryDataBody)
         {
-          AmqpDescribed describedBody(
-              static_cast<std::uint64_t>(AmqpDescriptors::DataBinary), val.AsAmqpValue());
-          auto serializedBodyValue = AmqpValue::Serialize(describedBody.AsAmqpValue());
-          rv.insert(rv.end(), serializedBodyValue.begin(), serializedBodyValue.end());
+          sections.emplace_back(
+              AmqpDescribed(
+                  static_cast<std::uint64_t>(AmqpDescriptors::DataBinary), val.AsAmqpValue())
+                  .AsAmqpValue());
         }
         break;
-      case MessageBodyType::Sequence: {
+      case MessageBodyType::Sequence:
         for (auto const& val : message.m_amqpSequenceBody)
         {
-          AmqpDescribed describedBody(
-              static_cast<std::uint64_t>(AmqpDescriptors::DataAmqpSequence), val.AsAmqpValue());
-          auto serializedBodyValue = AmqpValue::Serialize(describedBody.AsAmqpValue());
-          rv.insert(rv.end(), serializedBodyValue.begin(), serializedBodyValue.end());
+          sections.emplace_back(
+              AmqpDescribed(
+                  static_cast<std::uint64_t>(AmqpDescriptors::DataAmqpSequence), val.AsAmqpValue())
+                  .AsAmqpValue());
         }
-      }
+        break;
     }
     if (!message.Footer.empty())
     {
-      AmqpValue footer{Models::_detail::AmqpValueFactory::FromImplementation(
+      sections.emplace_back(Models::_detail::AmqpValueFactory::FromImplementation(
           Models::_detail::UniqueAmqpValueHandle{amqpvalue_create_footer(
-              Models::_detail::AmqpValueFactory::ToImplementation(message.Footer.AsAmqpValue()))})};
-      auto serializedFooter = AmqpValue::Serialize(footer);
-      rv.insert(rv.end(), serializedFooter.begin(), serializedFooter.end());
+              Models::_detail::AmqpValueFactory::ToImplementation(message.Footer.AsAmqpValue()))}));
     }
 
-    return rv;
+    size_t serializedSize{};
+    for (auto const& section : sections)
+    {
+      serializedSize += AmqpValue::GetSerializedSize(section);
+    }
+
+    auto const initialSize = buffer.size();
+    buffer.reserve(initialSize + serializedSize);
+    try
+    {
+      for (auto const& section : sections)
+      {
+        AmqpValue::Serialize(section, buffer);
+      }
+    }
+    catch (...)
+    {
+      buffer.resize(initialSize);
+      throw;
+    }
   }
 
 #if ENABLE_UAMQP
@@ -823,21 +823,19 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
 
     class AmqpValueSerializer final {
     public:
-      AmqpValueSerializer() = default;
+      AmqpValueSerializer(std::vector<uint8_t>& encodedValue) : m_encodedValue{encodedValue} {}
 
-      std::vector<uint8_t> operator()(AmqpValue const& value)
+      void operator()(AmqpValue const& value)
       {
         if (amqpvalue_encode(
                 _detail::AmqpValueFactory::ToImplementation(value), OnAmqpValueEncoded, this))
         {
           throw std::runtime_error("Could not encode object");
         }
-        (void)value;
-        return m_encodedValue;
       }
 
     private:
-      std::vector<uint8_t> m_encodedValue;
+      std::vector<uint8_t>& m_encodedValue;
 
       // The OnAmqpValueEncoded callback appends the array provided to the existing encoded
       // value, extending as needed.
@@ -891,25 +889,34 @@ namespace Azure { namespace Core { namespace Amqp { namespace Models {
 
   std::vector<uint8_t> AmqpValue::Serialize(AmqpValue const& value)
   {
+    std::vector<uint8_t> encodedValue;
+    Serialize(value, encodedValue);
+    return encodedValue;
+  }
+
+  void AmqpValue::Serialize(AmqpValue const& value, std::vector<uint8_t>& buffer)
+  {
+    auto const initialSize = buffer.size();
+    try
+    {
 #if ENABLE_UAMQP
-    return AmqpValueSerializer{}(value);
+      AmqpValueSerializer{buffer}(value);
 #elif ENABLE_RUST_AMQP
-    size_t encodedSize;
-    if (amqpvalue_get_encoded_size(
-            _detail::AmqpValueFactory::ToImplementation(value), &encodedSize))
-    {
-      throw std::runtime_error("Could not get encoded size for value.");
+      buffer.resize(initialSize + GetSerializedSize(value));
+      if (amqpvalue_encode(
+              _detail::AmqpValueFactory::ToImplementation(value),
+              buffer.data() + initialSize,
+              buffer.size() - initialSize))
+      {
+        throw std::runtime_error("Could not encode object");
+      }
+#endif
     }
-    std::vector<uint8_t> encodedValue(encodedSize);
-    if (amqpvalue_encode(
-            _detail::AmqpValueFactory::ToImplementation(value),
-            encodedValue.data(),
-            encodedValue.size()))
+    catch (...)
     {
-      throw std::runtime_error("Could not encode object");
+      buffer.resize(initialSize);
+      throw;
     }
-    return encodedValue;
-#endif
   }
 
   size_t AmqpValue::GetSerializedSize(AmqpValue const& value)
@@ -4,6 +4,8 @@
 #include "../src/models/private/message_impl.hpp"
 #include "azure/core/amqp/models/amqp_message.hpp"
 
+#include <algorithm>
+
 #include <gtest/gtest.h>
 
 using namespace Azure::Core::Amqp::Models;
@@ -240,6 +242,24 @@ TEST_F(TestMessage, TestBodyAmqpData)
   EXPECT_EQ(message, *round_trip_message.get());
 }
 
+TEST_F(TestMessage, TestBodyAmqpDataMoved)
+{
+  std::vector<uint8_t> bytes{1, 3, 5, 7, 9, 10};
+  auto const* bytesData = bytes.data();
+
+  std::vector<AmqpBinaryData> body;
+  body.emplace_back(std::move(bytes));
+  body.emplace_back(std::vector<uint8_t>{2, 4, 6, 8});
+
+  AmqpMessage message;
+  message.SetBody(std::move(body));
+  EXPECT_EQ(message.BodyType, MessageBodyType::Data);
+  ASSERT_EQ(message.GetBodyAsBinary().size(), 2);
+  // The bytes were moved into the message body rather than copied.
+  EXPECT_EQ(message.GetBodyAsBinary()[0].data(), bytesData);
+  EXPECT_EQ(message.GetBodyAsBinary()[1], (AmqpBinaryData{2, 4, 6, 8}));
+}
+
 class MessageSerialization : public testing::Test {
 protected:
   void SetUp() override {}
@@ -437,3 +457,32 @@ TEST_F(MessageSerialization, SerializeMessageWithFooter)
     EXPECT_EQ(message, deserialized);
   }
 }
+TEST_F(MessageSerialization, SerializeMessageAppendsToBuffer)
+{
+  AmqpMessage message;
+  message.Header.Priority = 5;
+  message.Properties.MessageId = "12345";
+  message.MessageAnnotations["annotation1"] = "value1";
+  message.Footer["footer1"] = "value1";
+  message.SetBody(std::vector<AmqpBinaryData>{
+      AmqpBinaryData{'T', 'e', 's', 't', ' ', 'b', 'o', 'd', 'y', 0},
+      AmqpBinaryData{1, 3, 5, 7, 9, 10}});
+
+  std::vector<uint8_t> const expected = AmqpMessage::Serialize(message);
+
+  std::vector<uint8_t> buffer{0xde, 0xad};
+  AmqpMessage::Serialize(message, buffer);
+  ASSERT_EQ(expected.size() + 2u, buffer.size());
+  EXPECT_EQ(uint8_t{0xde}, buffer[0]);
+  EXPECT_EQ(uint8_t{0xad}, buffer[1]);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), buffer.begin() + 2));
+
+  AmqpMessage deserialized = AmqpMessage::Deserialize(buffer.data() + 2, buffer.size() - 2);
+  EXPECT_EQ(message, deserialized);
+
+  // A message which cannot be serialized leaves the buffer untouched.
+  AmqpMessage invalidMessage;
+  invalidMessage.BodyType = MessageBodyType::Invalid;
+  EXPECT_ANY_THROW(AmqpMessage::Serialize(invalidMessage, buffer));
+  EXPECT_EQ(expected.size() + 2u, buffer.size());
+}
@@ -27,8 +27,13 @@
 #include <azure/core/platform.hpp>
 #include <azure/core/url.hpp>
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <future>
+#include <mutex>
 #include <random>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -569,6 +574,168 @@ namespace Azure { namespace Core { namespace Amqp { namespace Tests {
   }
 
 #if ENABLE_UAMQP
+  TEST_F(TestMessageSendReceive, SenderSendAsyncPipelined)
+  {
+#if !defined(USE_NATIVE_BROKER)
+    class SenderLinkEndpoint final : public MessageTests::MockServiceEndpoint {
+    public:
+      SenderLinkEndpoint(
+          std::string const& name,
+          MessageTests::MockServiceEndpointOptions const& options)
+          : MockServiceEndpoint(name, options)
+      {
+      }
+
+      virtual ~SenderLinkEndpoint() = default;
+
+    private:
+      void MessageReceived(
+          std::string const& linkName,
+          std::shared_ptr<Azure::Core::Amqp::Models::AmqpMessage> const& message) override
+      {
+        GTEST_LOG_(INFO) << "Message received on link " << linkName << ": " << *message;
+      }
+    };
+
+    MessageTests::MockServiceEndpointOptions mockServiceEndpointOptions{};
+    auto senderEndpoint
+        = std::make_shared<SenderLinkEndpoint>("localhost/ingress", mockServiceEndpointOptions);
+    m_mockServer.AddServiceEndpoint(senderEndpoint);
+#endif
+
+    auto connection{CreateAmqpConnection({})};
+    auto session{CreateAmqpSession(connection)};
+
+    Azure::Core::Context sendContext
+        = Azure::Core::Context{Azure::DateTime::clock::now() + std::chrono::seconds(15)};
+
+    // Ensure that the thread is started before we start using the message sender.
+    StartServerListening();
+
+    {
+      MessageSenderOptions options;
+      options.SettleMode = SenderSettleMode::Settled;
+      options.MaxMessageSize = 65536;
+      options.MessageSource = "ingress";
+      options.Name = "sender-link";
+      options.MaxUnsettledDeliveries = 4;
+      MessageSender sender(session.CreateMessageSender("localhost/ingress", options));
+      EXPECT_FALSE(sender.Open(sendContext));
+
+      constexpr int messageCount = 20;
+      std::mutex completionLock;
+      std::condition_variable allCompleted;
+      std::vector<int> completionOrder;
+      for (int i = 0; i < messageCount; i += 1)
+      {
+        Azure::Core::Amqp::Models::AmqpMessage message;
+        message.SetBody(Azure::Core::Amqp::Models::AmqpValue{i});
+        sender.SendAsync(
+            message,
+            [&, i](MessageSendStatus sendResult, Models::_internal::AmqpError const&) {
+              EXPECT_EQ(sendResult, MessageSendStatus::Ok);
+              std::lock_guard<std::mutex> lock(completionLock);
+              completionOrder.push_back(i);
+              allCompleted.notify_one();
+            },
+            sendContext);
+      }
+      {
+        std::unique_lock<std::mutex> lock(completionLock);
+        EXPECT_TRUE(allCompleted.wait_for(lock, std::chrono::seconds(10), [&]() {
+          return completionOrder.size() == static_cast<std::size_t>(messageCount);
+        }));
+        for (int i = 0; i < static_cast<int>(completionOrder.size()); i += 1)
+        {
+          EXPECT_EQ(completionOrder[i], i);
+        }
+      }
+
+      Azure::Core::Amqp::Models::AmqpMessage message;
+      message.SetBody(Azure::Core::Amqp::Models::AmqpValue{"Hello"});
+      auto result = sender.SendAsync(message, sendContext);
+      ASSERT_EQ(result.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+      EXPECT_EQ(std::get<0>(result.get()), MessageSendStatus::Ok);
+
+      sender.Close();
+    }
+    StopServerListening();
+
+    EndAmqpSession(session);
+    CloseAmqpConnection(connection);
+  }
+
+  // Every message sent with SendAsync must be reported by the time Close returns, so that no
+  // completion callback can run after the sender has been closed and destroyed.
+  TEST_F(TestMessageSendReceive, SenderSendAsyncCompletesOnClose)
+  {
+#if !defined(USE_NATIVE_BROKER)
+    class SenderLinkEndpoint final : public MessageTests::MockServiceEndpoint {
+    public:
+      SenderLinkEndpoint(
+          std::string const& name,
+          MessageTests::MockServiceEndpointOptions const& options)
+          : MockServiceEndpoint(name, options)
+      {
+      }
+
+      virtual ~SenderLinkEndpoint() = default;
+
+    private:
+      void MessageReceived(
+          std::string const& linkName,
+          std::shared_ptr<Azure::Core::Amqp::Models::AmqpMessage> const& message) override
+      {
+        GTEST_LOG_(INFO) << "Message received on link " << linkName << ": " << *message;
+      }
+    };
+
+    MessageTests::MockServiceEndpointOptions mockServiceEndpointOptions{};
+    auto senderEndpoint
+        = std::make_shared<SenderLinkEndpoint>("localhost/ingress", mockServiceEndpointOptions);
+    m_mockServer.AddServiceEndpoint(senderEndpoint);
+#endif
+
+    auto connection{CreateAmqpConnection({})};
+    auto session{CreateAmqpSession(connection)};
+
+    Azure::Core::Context sendContext
+        = Azure::Core::Context{Azure::DateTime::clock::now() + std::chrono::seconds(15)};
+
+    // Ensure that the thread is started before we start using the message sender.
+    StartServerListening();
+
+    constexpr int messageCount = 20;
+    std::atomic<int> completedCount{0};
+    {
+      MessageSenderOptions options;
+      options.SettleMode = SenderSettleMode::Unsettled;
+      options.MaxMessageSize = 65536;
+      options.MessageSource = "ingress";
+      options.Name = "sender-link";
+      MessageSender sender(session.CreateMessageSender("localhost/ingress", options));
+      EXPECT_FALSE(sender.Open(sendContext));
+
+      for (int i = 0; i < messageCount; i += 1)
+      {
+        Azure::Core::Amqp::Models::AmqpMessage message;
+        message.SetBody(Azure::Core::Amqp::Models::AmqpValue{i});
+        sender.SendAsync(
+            message,
+            [&](MessageSendStatus, Models::_internal::AmqpError const&) { completedCount += 1; },
+            sendContext);
+      }
+
+      sender.Close();
+      EXPECT_EQ(messageCount, completedCount.load());
+    }
+    StopServerListening();
+    EXPECT_EQ(messageCount, completedCount.load());
+
+    EndAmqpSession(session);
+    CloseAmqpConnection(connection);
+  }
+
   TEST_F(TestMessageSendReceive, AuthenticatedSender)
   {
 #if !defined(USE_NATIVE_BROKER)
@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -106,8 +107,16 @@ namespace Azure { namespace Core {
     struct ContextSharedState final
     {
       std::shared_ptr<ContextSharedState> Parent;
-      std::atomic<DateTime::rep> Deadline;
-      std::shared_ptr<Azure::Core::Tracing::TracerProvider> TraceProvider;
+      // The nearest context in the branch (this one included) that holds a value, so that value
+      // lookups skip the contexts that only carry a deadline.
+      ContextSharedState const* ValueState;
+      // The earliest deadline of this context and its parents. Deadlines never change once a
+      // context is created; cancellation is tracked separately.
+      DateTime::rep const EffectiveDeadline;
+      // Set when this context, or (once observed) one of its parents, is cancelled.
+      mutable std::atomic<bool> Cancelled;
+      // The cancellation generation at which the parents were last found not to be cancelled.
+      mutable std::atomic<std::uint64_t> CheckedGeneration;
       Context::Key Key;
       std::shared_ptr<void> Value;
 #if defined(AZ_CORE_RTTI)
@@ -123,6 +132,15 @@ namespace Azure { namespace Core {
         return DateTime(DateTime::time_point(DateTime::duration(dtRepresentation)));
       }
 
+      static DateTime::rep CombineDeadlines(
+          const std::shared_ptr<ContextSharedState>& parent,
+          DateTime const& deadline)
+      {
+        auto const representation = ToDateTimeRepresentation(deadline);
+        return (parent && parent->EffectiveDeadline < representation) ? parent->EffectiveDeadline
+                                                                      : representation;
+      }
+
       ContextSharedState(ContextSharedState const&) = delete;
       ContextSharedState(ContextSharedState&&) = delete;
       ContextSharedState& operator=(ContextSharedState const&) = delete;
@@ -132,7 +150,8 @@ namespace Azure { namespace Core {
        * @brief Creates a new ContextSharedState object with no deadline and no value.
        */
       explicit ContextSharedState()
-          : Deadline(ToDateTimeRepresentation((DateTime::max)())), Value(nullptr)
+          : ValueState(nullptr), EffectiveDeadline(ToDateTimeRepresentation((DateTime::max)())),
+            Cancelled(false), CheckedGeneration(0), Value(nullptr)
 #if defined(AZ_CORE_RTTI)
             ,
             ValueType(typeid(std::nullptr_t))
@@ -150,7 +169,9 @@ namespace Azure { namespace Core {
       explicit ContextSharedState(
           const std::shared_ptr<ContextSharedState>& parent,
           DateTime const& deadline = (DateTime::max)())
-          : Parent(parent), Deadline(ToDateTimeRepresentation(deadline)), Value(nullptr)
+          : Parent(parent), ValueState(parent ? parent->ValueState : nullptr),
+            EffectiveDeadline(CombineDeadlines(parent, deadline)), Cancelled(false),
+            CheckedGeneration(0), Value(nullptr)
 #if defined(AZ_CORE_RTTI)
             ,
             ValueType(typeid(std::nullptr_t))
@@ -175,16 +196,67 @@ namespace Azure { namespace Core {
           DateTime const& deadline,
           Context::Key const& key,
           T value) // NOTE, should this be T&&
-          : Parent(parent), Deadline(ToDateTimeRepresentation(deadline)), Key(key),
-            Value(std::make_shared<T>(std::move(value)))
+          : Parent(parent), ValueState(this),
+            EffectiveDeadline(CombineDeadlines(parent, deadline)), Cancelled(false),
+            CheckedGeneration(0), Key(key), Value(std::make_shared<T>(std::move(value)))
 #if defined(AZ_CORE_RTTI)
             ,
             ValueType(typeid(T))
 #endif
       {
       }
+
+      /**
+       * @brief The nearest context above this one in the branch that holds a value.
+       */
+      ContextSharedState const* NextValueState() const
+      {
+        return Parent ? Parent->ValueState : nullptr;
+      }
+
+      /**
+       * @brief Checks whether this context or one of its parents has been cancelled.
+       *
+       * @remark The parents are only visited when a context anywhere in the process has been
+       * cancelled since this context last checked them, so the check is usually a couple of
+       * atomic loads.
+       */
+      bool IsCancelled() const
+      {
+        if (Cancelled.load(std::memory_order_acquire))
+        {
+          return true;
+        }
+        auto const generation = CancellationGeneration.load(std::memory_order_acquire);
+        if (CheckedGeneration.load(std::memory_order_acquire) == generation)
+        {
+          return false;
+        }
+        for (auto parent = Parent.get(); parent; parent = parent->Parent.get())
+        {
+          if (parent->Cancelled.load(std::memory_order_acquire))
+          {
+            // Cancellation can't be undone, so it can be cached on this context.
+            Cancelled.store(true, std::memory_order_release);
+            return true;
+          }
+          if (parent->CheckedGeneration.load(std::memory_order_acquire) == generation)
+          {
+            // The rest of the branch was checked at this generation already.
+            break;
+          }
+        }
+        CheckedGeneration.store(generation, std::memory_order_release);
+        return false;
+      }
     };
 
+    /**
+     * @brief Incremented every time a context is cancelled, so that contexts know when their
+     * parents need to be checked for cancellation again.
+     */
+    static AZ_CORE_DLLEXPORT std::atomic<std::uint64_t> CancellationGeneration;
+
     std::shared_ptr<ContextSharedState> m_contextSharedState;
 
     explicit Context(std::shared_ptr<ContextSharedState> impl)
@@ -318,7 +390,7 @@ namespace Azure { namespace Core {
      */
     template <class T> bool TryGetValue(Key const& key, T& outputValue) const
     {
-      for (std::shared_ptr<ContextSharedState> ptr = m_contextSharedState; ptr; ptr = ptr->Parent)
+      for (auto ptr = m_contextSharedState->ValueState; ptr; ptr = ptr->NextValueState())
       {
         if (ptr->Key == key)
         {
@@ -347,15 +419,27 @@ namespace Azure { namespace Core {
      */
     void Cancel()
     {
-      m_contextSharedState->Deadline
-          = ContextSharedState::ToDateTimeRepresentation((DateTime::min)());
+      if (!m_contextSharedState->Cancelled.exchange(true, std::memory_order_acq_rel))
+      {
+        CancellationGeneration.fetch_add(1, std::memory_order_acq_rel);
+      }
     }
 
     /**
      * @brief Checks if the context is cancelled.
      * @return `true` if this context is cancelled; otherwise, `false`.
      */
-    bool IsCancelled() const { return GetDeadline() < std::chrono::system_clock::now(); }
+    bool IsCancelled() const
+    {
+      if (m_contextSharedState->IsCancelled())
+      {
+        return true;
+      }
+      auto const deadline = m_contextSharedState->EffectiveDeadline;
+      return deadline != ContextSharedState::ToDateTimeRepresentation((DateTime::max)())
+          && ContextSharedState::FromDateTimeRepresentation(deadline)
+          < std::chrono::system_clock::now();
+    }
 
     /** @brief Throws if the context is cancelled.
      *
@@ -11,6 +11,7 @@
 #include "azure/core/dll_import_export.hpp"
 
 #include <chrono>
+#include <cstddef>
 #include <ostream>
 #include <string>
 
@@ -43,6 +44,10 @@ namespace _detail {
   };
 } // namespace _detail
 
+namespace Core { namespace _internal {
+  class DateTimeFormatter;
+}} // namespace Core::_internal
+
 /**
  * @brief Manages date and time in standardized string formats.
  * @details Supports date range from year 0001 to end of year 9999 with 100ns (7 decimal places
@@ -52,6 +57,7 @@ namespace _detail {
  * @remark This class is supposed to be able to handle a DateTime that comes over the wire.
  */
 class DateTime final : public _detail::Clock::time_point {
+  friend class Core::_internal::DateTimeFormatter;
 
 private:
   AZ_CORE_DLLEXPORT static DateTime const SystemClockEpoch;
@@ -324,6 +330,78 @@ namespace Core { namespace _internal {
      */
     ~PosixTimeConverter() = delete;
   };
+
+  /**
+   * @brief Formats an #Azure::DateTime into a caller-provided buffer, without allocating.
+   *
+   */
+  class DateTimeFormatter final {
+  public:
+    /**
+     * @brief The length of an RFC 1123 date string, such as `Tue, 19 Nov 2013 14:30:59 GMT`.
+     *
+     */
+    static constexpr std::size_t Rfc1123Length = 29;
+
+    /**
+     * @brief The maximum length of an RFC 3339 date string, such as
+     * `2013-11-19T14:30:59.1234567Z`.
+     *
+     */
+    static constexpr std::size_t MaxRfc3339Length = 28;
+
+    /**
+     * @brief Formats a date and time as an RFC 1123 string.
+     *
+     * @param dateTime The date and time to format.
+     * @param buffer The buffer to write to, at least #Rfc1123Length characters long. The string
+     * is not null-terminated.
+     * @return The number of characters written.
+     *
+     * @throw std::invalid_argument If the year of \p dateTime is before 0001 or after 9999.
+     */
+    static std::size_t FormatRfc1123(DateTime const& dateTime, char* buffer);
+
+    /**
+     * @brief Formats a date and time as an RFC 3339 string.
+     *
+     * @param dateTime The date and time to format.
+     * @param fractionFormat How to format the fractional part of the seconds.
+     * @param buffer The buffer to write to, at least #MaxRfc3339Length characters long. The
+     * string is not null-terminated.
+     * @return The number of characters written.
+     *
+     * @throw std::invalid_argument If the year of \p dateTime is before 0001 or after 9999, or if
+     * \p fractionFormat is not recognized.
+     */
+    static std::size_t FormatRfc3339(
+        DateTime const& dateTime,
+        DateTime::TimeFractionFormat fractionFormat,
+        char* buffer);
+
+    /**
+     * @brief Gets the current time as an RFC 1123 string, for the `Date` header of a request.
+     *
+     * @remark The string is formatted at most once per second on each thread.
+     *
+     * @return The current time, such as `Tue, 19 Nov 2013 14:30:59 GMT`.
+     */
+    static std::string GetCurrentTimeRfc1123();
+
+  private:
+    /**
+     * @brief An instance of `%DateTimeFormatter` class cannot be created.
+     *
+     */
+    DateTimeFormatter() = delete;
+
+    /**
+     * @brief An instance of `%DateTimeFormatter` class cannot be destructed, because no instance
+     * can be created.
+     *
+     */
+    ~DateTimeFormatter() = delete;
+  };
 }} // namespace Core::_internal
 
 } // namespace Azure
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
 
@@ -37,6 +39,39 @@ namespace Azure { namespace Core { namespace Diagnostics {
       Error = 4,
     };
 
+    /**
+     * @brief What happens to a log message when the queue of asynchronous log messages is full.
+     *
+     */
+    enum class QueueFullBehavior
+    {
+      /// The message is discarded and counted by #GetDroppedMessageCount().
+      DropMessage,
+
+      /// The thread writing the message waits until there is space in the queue.
+      Block,
+    };
+
+    /**
+     * @brief Options for delivering log messages asynchronously.
+     *
+     */
+    struct AsynchronousOptions final
+    {
+      /**
+       * @brief The number of log messages that can wait to be delivered. It is rounded up to a
+       * power of two.
+       *
+       */
+      std::size_t QueueCapacity = 1024;
+
+      /**
+       * @brief What happens to a log message when the queue is full.
+       *
+       */
+      QueueFullBehavior WhenQueueIsFull = QueueFullBehavior::DropMessage;
+    };
+
     /**
      * @brief Sets the function that will be invoked to report an Azure SDK log message.
      *
@@ -53,6 +88,43 @@ namespace Azure { namespace Core { namespace Diagnostics {
      */
     static void SetLevel(Level level);
 
+    /**
+     * @brief Delivers log messages to the listener on a background thread instead of on the thread
+     * that writes them.
+     *
+     * @details Log messages are queued without taking a lock, and the messages of the HTTP logging
+     * policy are formatted on the background thread. The listener is always called from the
+     * background thread, one message at a time, so it doesn't need to be thread-safe.
+     *
+     * If asynchronous logging is already enabled, the queued messages are delivered before the
+     * new options take effect.
+     *
+     * @param options Options for the queue of log messages.
+     */
+    static void EnableAsynchronousLogging(AsynchronousOptions const& options);
+
+    /**
+     * @brief Delivers the queued log messages, stops the background thread, and goes back to
+     * calling the listener on the thread that writes each message.
+     *
+     */
+    static void DisableAsynchronousLogging();
+
+    /**
+     * @brief Waits until the log messages that have been queued so far are delivered to the
+     * listener. It returns immediately when asynchronous logging is not enabled.
+     *
+     * @remark This function must not be called from the listener.
+     */
+    static void Flush();
+
+    /**
+     * @brief Gets the number of log messages that were discarded because the asynchronous queue
+     * was full.
+     *
+     */
+    static std::uint64_t GetDroppedMessageCount();
+
   private:
     /**
      * @brief An instance of `%Logger` class cannot be created.
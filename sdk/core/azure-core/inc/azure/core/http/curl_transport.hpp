@@ -13,6 +13,8 @@
 #include "azure/core/nullable.hpp"
 
 #include <chrono>
+#include <cstddef>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -26,6 +28,18 @@ namespace Azure { namespace Core { namespace Http {
      *
      */
     constexpr std::chrono::milliseconds DefaultConnectionTimeout = std::chrono::minutes(5);
+
+    /**
+     * @brief Default maximum number of idle connections kept in the connection pool for a host.
+     *
+     */
+    constexpr size_t DefaultMaxIdleConnectionsPerHost = 1024;
+
+    /**
+     * @brief Default size in bytes of the buffer used to receive an HTTP response.
+     *
+     */
+    constexpr size_t DefaultReceiveBufferSize = 64 * 1024;
   } // namespace _detail
 
   /**
@@ -194,6 +208,45 @@ namespace Azure { namespace Core { namespace Http {
      * @brief If set, integrates libcurl's internal tracing with Azure logging.
      */
     bool EnableCurlTracing = false;
+
+    /**
+     * @brief The maximum number of idle connections kept in the connection pool for each host.
+     *
+     * @details When a connection is released and the pool for its host is full, the connection
+     * which has been idle the longest is closed.
+     *
+     * @remark The default value is 1024.
+     *
+     */
+    size_t MaxIdleConnectionsPerHost = _detail::DefaultMaxIdleConnectionsPerHost;
+
+    /**
+     * @brief The number of idle connections kept in the connection pool for each host.
+     *
+     * @details Connections which are not re-used for 60 seconds are closed, because the server has
+     * probably closed them too. The ones needed to keep this many connections in the pool are
+     * replaced by new connections in the background, which avoids paying for a new TLS handshake
+     * after a quiet period. When several transports with different values use the same host, the
+     * largest value is used.
+     *
+     * @remark The default value is 0.
+     *
+     */
+    size_t MinIdleConnectionsPerHost = 0;
+
+    /**
+     * @brief The size in bytes of the buffer used to receive the status line, the headers and
+     * small reads of the body of an HTTP response.
+     *
+     * @details Reads from the response body stream which are at least this large are copied from
+     * the socket straight into the caller's buffer. A bigger buffer means fewer calls to the
+     * socket when the body is read in small pieces. The buffer is kept with the connection and
+     * re-used by the next request sent on it.
+     *
+     * @remark The default value is 64 KiB and using `0` would set this default value.
+     *
+     */
+    size_t ReceiveBufferSize = _detail::DefaultReceiveBufferSize;
   };
 
   /**
@@ -202,6 +255,8 @@ namespace Azure { namespace Core { namespace Http {
   class CurlTransport : public HttpTransport {
   private:
     CurlTransportOptions m_options;
+    // The part of the connection pool key which depends on m_options.
+    std::string m_connectionKeySuffix;
 
     /**
      * @brief Called when an HTTP response indicates the connection should be upgraded to
@@ -215,9 +270,7 @@ namespace Azure { namespace Core { namespace Http {
      *
      * @param options Optional parameter to override the default options.
      */
-    CurlTransport(CurlTransportOptions const& options = CurlTransportOptions()) : m_options(options)
-    {
-    }
+    CurlTransport(CurlTransportOptions const& options = CurlTransportOptions());
 
     /**
      * @brief Construct a new CurlTransport object based on common Azure HTTP Transport Options
@@ -245,6 +298,45 @@ namespace Azure { namespace Core { namespace Http {
      * @return unique ptr to an HTTP RawResponse.
      */
     std::unique_ptr<RawResponse> Send(Request& request, Context const& context) override;
+
+    /**
+     * @brief Sends an HTTP Request without blocking the calling thread.
+     *
+     * @details Requests are multiplexed by a single background thread which drives a libcurl multi
+     * handle, so many requests can be in flight without dedicating a thread to each of them. The
+     * response body is downloaded into the RawResponse before the returned future is ready.
+     *
+     * @remark No pipeline policies are applied, see #Azure::Core::Http::HttpTransport::SendAsync.
+     *
+     * @remark Connections used by this method are cached separately from the connections used by
+     * #Send. Requests which don't buffer their response, and requests sent while the certificate
+     * revocation list check is enabled on Linux, are sent with #Send on a separate thread instead.
+     *
+     * @param request an HTTP Request to be send. It must outlive the returned future.
+     * @param context A context to control the request lifetime.
+     *
+     * @return A future for the HTTP RawResponse.
+     */
+    std::future<std::unique_ptr<RawResponse>> SendAsync(Request& request, Context const& context)
+        override;
+
+    /**
+     * @brief Opens connections to a host ahead of time and adds them to the connection pool.
+     *
+     * @details Call this at startup so that the first requests to the host don't pay for the TCP
+     * and TLS handshakes. The connections are opened in parallel and are shared with every
+     * #CurlTransport which uses the same options.
+     *
+     * @remark No more than #CurlTransportOptions::MaxIdleConnectionsPerHost connections are kept.
+     * They expire like any other idle connection, and are replaced by new ones if
+     * #CurlTransportOptions::MinIdleConnectionsPerHost is set.
+     *
+     * @param url The URL of the host to connect to. Only the scheme, host and port are used.
+     * @param connectionCount The number of connections to open.
+     *
+     * @throw Azure::Core::Http::TransportException if a connection can't be opened.
+     */
+    void PrewarmConnections(Azure::Core::Url const& url, size_t connectionCount);
   };
 
 }}} // namespace Azure::Core::Http
@@ -14,6 +14,7 @@
 #include "azure/core/http/http_status_code.hpp"
 #include "azure/core/http/raw_response.hpp"
 #include "azure/core/internal/contract.hpp"
+#include "azure/core/internal/http/header_list.hpp"
 #include "azure/core/io/body_stream.hpp"
 #include "azure/core/nullable.hpp"
 #include "azure/core/url.hpp"
@@ -174,6 +175,10 @@ namespace Azure { namespace Core { namespace Http {
     class RetryPolicy;
   }} // namespace Policies::_internal
 
+  namespace _detail {
+    struct RequestHeaders;
+  } // namespace _detail
+
   /**
    * @brief A request message from a client to a server.
    *
@@ -182,6 +187,7 @@ namespace Azure { namespace Core { namespace Http {
    */
   class Request final {
     friend class Azure::Core::Http::Policies::_internal::RetryPolicy;
+    friend struct _detail::RequestHeaders;
 #if defined(_azure_TESTING_BUILD)
     // make tests classes friends to validate set Retry
     friend class Azure::Core::Test::TestHttp_getters_Test;
@@ -203,8 +209,8 @@ namespace Azure { namespace Core { namespace Http {
   private:
     HttpMethod m_method;
     Url m_url;
-    CaseInsensitiveMap m_headers;
-    CaseInsensitiveMap m_retryHeaders;
+    _detail::HeaderList m_headers;
+    _detail::HeaderList m_retryHeaders;
 
     Azure::Core::IO::BodyStream* m_bodyStream;
 
@@ -344,6 +350,43 @@ namespace Azure { namespace Core { namespace Http {
   };
 
   namespace _detail {
+    /**
+     * @brief Gives the transport adapters access to the headers of a request without copying them
+     * into a map.
+     */
+    struct RequestHeaders final
+    {
+      /**
+       * @brief Calls \p fn with the name and value of each header of \p request.
+       *
+       * @details The headers set during the current try come first and take precedence over the
+       * headers with the same name set before it, as in Request::GetHeaders().
+       */
+      template <typename Fn> static void ForEach(Request const& request, Fn&& fn)
+      {
+        for (auto const& header : request.m_retryHeaders)
+        {
+          fn(header.Name, header.Value);
+        }
+        for (auto const& header : request.m_headers)
+        {
+          if (request.m_retryHeaders.Size() == 0 || !request.m_retryHeaders.Find(header.Name))
+          {
+            fn(header.Name, header.Value);
+          }
+        }
+      }
+
+      /**
+       * @brief Returns whether \p request has a header named \p name, ignoring case.
+       */
+      static bool Contains(Request const& request, std::string const& name)
+      {
+        return request.m_retryHeaders.Find(name) != nullptr
+            || request.m_headers.Find(name) != nullptr;
+      }
+    };
+
     struct RawResponseHelpers final
     {
       /**
@@ -361,6 +404,21 @@ namespace Azure { namespace Core { namespace Http {
           std::string const& headerName,
           std::string const& headerValue);
 
+      /**
+       * @brief Insert a header into \p headers checking that \p headerName does not contain invalid
+       * characters.
+       *
+       * @param headers The header list where to insert header.
+       * @param headerName The header name for the header to be inserted.
+       * @param headerValue The header value for the header to be inserted.
+       *
+       * @throw if \p headerName is invalid.
+       */
+      static void InsertHeaderWithValidation(
+          HeaderList& headers,
+          std::string headerName,
+          std::string headerValue);
+
       static void inline SetHeader(
           Azure::Core::Http::RawResponse& response,
           uint8_t const* const first,
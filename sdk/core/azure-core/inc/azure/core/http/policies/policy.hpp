@@ -98,6 +98,48 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         ;
   };
 
+  /**
+   * @brief A token bucket which limits how many requests are retried, so that retries don't
+   * multiply the load on a service which is already failing.
+   *
+   * @details Every retry takes one token from the bucket and every request which succeeds puts
+   * back a fraction of a token. Retries are only allowed while the bucket is more than half full.
+   * Share one budget between the clients which talk to the same account, so that the retries of
+   * all of them are limited together.
+   *
+   */
+  class RetryBudget final {
+  public:
+    /**
+     * @brief Construct a full retry budget.
+     *
+     * @param maxTokens The capacity of the bucket. Half of it is the number of retries allowed in
+     * a burst of failures.
+     * @param tokensPerSuccess The fraction of a token put back in the bucket for each request which
+     * succeeds.
+     */
+    explicit RetryBudget(int32_t maxTokens = 20, double tokensPerSuccess = 0.1);
+
+    /**
+     * @brief Take a token for a retry.
+     *
+     * @return `true` if the request can be retried; otherwise, `false`.
+     */
+    bool TryAcquireRetry();
+
+    /**
+     * @brief Record a request which succeeded, which gives back a fraction of a token.
+     *
+     */
+    void RecordSuccess();
+
+  private:
+    // Tokens are counted in thousandths, so the bucket is a single lock-free counter.
+    int64_t const m_maxMilliTokens;
+    int64_t const m_milliTokensPerSuccess;
+    std::atomic<int64_t> m_milliTokens;
+  };
+
   /**
    * @brief The set of options that can be specified to influence how retry attempts are made, and a
    * failure is eligible to be retried.
@@ -397,14 +439,22 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
         : public HttpPolicy {
     private:
       RetryOptions m_retryOptions;
+      std::shared_ptr<RetryBudget> m_retryBudget;
+
+      bool AcquireRetryFromBudget() const;
 
     public:
       /**
        * Constructs HTTP retry policy with the provided #Azure::Core::Http::Policies::RetryOptions.
        *
        * @param options #Azure::Core::Http::Policies::RetryOptions.
+       * @param retryBudget The budget which limits the retries, or `nullptr` to always retry up
+       * to #Azure::Core::Http::Policies::RetryOptions::MaxRetries times.
        */
-      explicit RetryPolicy(RetryOptions options) : m_retryOptions(std::move(options)) {}
+      explicit RetryPolicy(RetryOptions options, std::shared_ptr<RetryBudget> retryBudget = nullptr)
+          : m_retryOptions(std::move(options)), m_retryBudget(std::move(retryBudget))
+      {
+      }
 
       std::unique_ptr<HttpPolicy> Clone() const override
       {
@@ -568,19 +618,35 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Context const& context) const override;
     };
 
+    /**
+     * @brief Options for #BearerTokenAuthenticationPolicy.
+     *
+     */
+    struct BearerTokenAuthenticationPolicyOptions final
+    {
+      /**
+       * @brief The fraction of the lifetime of a token after which the policy renews it in the
+       * background.
+       *
+       * @details Requests keep using the cached token while it is renewed, so they only wait for
+       * the credential when the token has expired. A value of 0, the default, disables the
+       * background refresh, and tokens are renewed by the first request which finds them expired.
+       *
+       */
+      double BackgroundRefreshRatio = 0;
+    };
+
     /**
      * @brief Bearer Token authentication policy.
      *
      */
     class BearerTokenAuthenticationPolicy : public HttpPolicy {
     private:
-      std::shared_ptr<const Credentials::TokenCredential> m_credential;
-      Credentials::TokenRequestContext m_tokenRequestContext;
+      struct TokenState;
 
-      mutable Credentials::AccessToken m_accessToken;
-      mutable std::shared_timed_mutex m_accessTokenMutex;
-      mutable Credentials::TokenRequestContext m_accessTokenContext;
-      mutable std::atomic<bool> m_invalidateToken = {false};
+      Credentials::TokenRequestContext m_tokenRequestContext;
+      // The token is shared with the background refresh, which can outlive the policy.
+      std::shared_ptr<TokenState> m_tokenState;
 
     public:
       /**
@@ -588,14 +654,14 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
        *
        * @param credential An #Azure::Core::TokenCredential to use with this policy.
        * @param tokenRequestContext A context to get the token in.
+       * @param options Options to configure the token refresh.
        */
       explicit BearerTokenAuthenticationPolicy(
           std::shared_ptr<const Credentials::TokenCredential> credential,
-          Credentials::TokenRequestContext tokenRequestContext)
-          : m_credential(std::move(credential)),
-            m_tokenRequestContext(std::move(tokenRequestContext))
-      {
-      }
+          Credentials::TokenRequestContext tokenRequestContext,
+          BearerTokenAuthenticationPolicyOptions const& options = {});
+
+      ~BearerTokenAuthenticationPolicy() override;
 
       std::unique_ptr<HttpPolicy> Clone() const override
       {
@@ -609,14 +675,7 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
           Context const& context) const override;
 
     protected:
-      BearerTokenAuthenticationPolicy(BearerTokenAuthenticationPolicy const& other)
-          : BearerTokenAuthenticationPolicy(other.m_credential, other.m_tokenRequestContext)
-      {
-        std::shared_lock<std::shared_timed_mutex> readLock(other.m_accessTokenMutex);
-        m_accessToken = other.m_accessToken;
-        m_accessTokenContext = other.m_accessTokenContext;
-        m_invalidateToken.store(other.m_invalidateToken.load());
-      }
+      BearerTokenAuthenticationPolicy(BearerTokenAuthenticationPolicy const& other);
 
       void operator=(BearerTokenAuthenticationPolicy const&) = delete;
 
@@ -644,7 +703,8 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
      */
     class LogPolicy final : public HttpPolicy {
       LogOptions m_options;
-      Azure::Core::Http::_internal::HttpSanitizer m_httpSanitizer;
+      // Shared with the log messages whose formatting is deferred, which may outlive the policy.
+      std::shared_ptr<Azure::Core::Http::_internal::HttpSanitizer const> m_httpSanitizer;
 
     public:
       /**
@@ -653,7 +713,9 @@ namespace Azure { namespace Core { namespace Http { namespace Policies {
        */
       explicit LogPolicy(LogOptions options)
           : m_options(std::move(options)),
-            m_httpSanitizer(m_options.AllowedHttpQueryParameters, m_options.AllowedHttpHeaders)
+            m_httpSanitizer(std::make_shared<Azure::Core::Http::_internal::HttpSanitizer>(
+                m_options.AllowedHttpQueryParameters,
+                m_options.AllowedHttpHeaders))
       {
       }
 
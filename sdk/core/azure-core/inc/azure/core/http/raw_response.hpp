@@ -104,8 +104,10 @@ namespace Azure { namespace Core { namespace Http {
     /**
      * @brief Destructs `%RawResponse`.
      *
+     * @remark The memory of the body is kept to buffer later responses.
+     *
      */
-    ~RawResponse() = default;
+    ~RawResponse();
 
     // ===== Methods used to build HTTP response =====
 
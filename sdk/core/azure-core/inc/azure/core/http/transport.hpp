@@ -12,6 +12,7 @@
 #include "azure/core/http/http.hpp"
 #include "azure/core/http/raw_response.hpp"
 
+#include <future>
 #include <memory>
 
 namespace Azure { namespace Core { namespace Http {
@@ -34,6 +35,44 @@ namespace Azure { namespace Core { namespace Http {
     // TODO - Should this be const
     virtual std::unique_ptr<RawResponse> Send(Request& request, Context const& context) = 0;
 
+    /**
+     * @brief Send an HTTP request over the wire without blocking the calling thread.
+     *
+     * @details The default implementation runs #Send on a separate thread. Transport adapters
+     * which are able to multiplex many requests over a shared event loop override this method.
+     *
+     * @remark This is a transport level operation: none of the pipeline policies (retry,
+     * authentication, logging, telemetry, ...) are applied, so \p request must already carry
+     * every header it needs. The request body stream is rewound before it is sent.
+     *
+     * @remark \p request must outlive the returned future. When
+     * #Azure::Core::Http::Request::ShouldBufferResponse is `true`, the response body is fully
+     * downloaded before the future becomes ready; otherwise it is returned as a body stream.
+     *
+     * @param request An #Azure::Core::Http::Request to send.
+     * @param context A context to control the request lifetime.
+     *
+     * @return A future which is satisfied with the response, or with the exception which would
+     * have been thrown by #Send.
+     */
+    virtual std::future<std::unique_ptr<RawResponse>> SendAsync(
+        Request& request,
+        Context const& context)
+    {
+      return std::async(std::launch::async, [this, &request, context]() {
+        request.GetBodyStream()->Rewind();
+        auto response = Send(request, context);
+        if (request.ShouldBufferResponse())
+        {
+          if (auto bodyStream = response->ExtractBodyStream())
+          {
+            response->SetBody(bodyStream->ReadToEnd(context));
+          }
+        }
+        return response;
+      });
+    }
+
     /**
      * @brief Destructs `%HttpTransport`.
      *
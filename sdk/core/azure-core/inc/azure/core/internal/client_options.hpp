@@ -71,6 +71,7 @@ namespace Azure { namespace Core { namespace _internal {
       this->Transport = other.Transport;
       this->Telemetry = other.Telemetry;
       this->Log = other.Log;
+      this->RetryBudget = other.RetryBudget;
       this->PerOperationPolicies.reserve(other.PerOperationPolicies.size());
       for (auto& policy : other.PerOperationPolicies)
       {
@@ -90,6 +91,15 @@ namespace Azure { namespace Core { namespace _internal {
      */
     Azure::Core::Http::Policies::RetryOptions Retry;
 
+    /**
+     * @brief The budget which limits the retries, shared with other clients if needed.
+     *
+     * @remark The default is no budget, and failed requests are always retried up to
+     * #Azure::Core::Http::Policies::RetryOptions::MaxRetries times.
+     *
+     */
+    std::shared_ptr<Azure::Core::Http::Policies::RetryBudget> RetryBudget;
+
     /**
      * @brief Customized HTTP client. We're going to use the default one if this is empty.
      *
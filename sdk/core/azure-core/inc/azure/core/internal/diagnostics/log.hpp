@@ -7,6 +7,7 @@
 #include "azure/core/dll_import_export.hpp"
 
 #include <atomic>
+#include <functional>
 #include <iostream>
 #include <mutex>
 #include <sstream>
@@ -148,6 +149,28 @@ namespace Azure { namespace Core { namespace Diagnostics { namespace _internal {
      */
     static void Write(Logger::Level level, std::string const& message);
 
+    /** @brief Write a message to the configured logger at the specified log level, formatting it
+     * only when it is delivered.
+     *
+     * When asynchronous logging is enabled, \p formatMessage is called on the background logging
+     * thread, so it must own everything it needs to produce the message. Otherwise, it is called
+     * immediately.
+     *
+     * @param level - log level to use for the message.
+     * @param formatMessage - function producing the message to write to the logger.
+     *
+     */
+    static void WriteDeferred(Logger::Level level, std::function<std::string()> formatMessage);
+
+    /** @brief Whether log messages are currently queued for the background logging thread.
+     *
+     * Callers can use this to capture the data for Log::WriteDeferred only when the message is
+     * going to be formatted later, and to format it in place otherwise.
+     *
+     * @return `true` if asynchronous logging is enabled.
+     */
+    static bool IsAsynchronous();
+
     /** @brief Enable logging.
      *
      * @param isEnabled - true if logging should be enabled, false if it should be disabled.
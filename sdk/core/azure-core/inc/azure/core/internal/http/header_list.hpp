@@ -0,0 +1,92 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief A flat list of HTTP headers with case-insensitive lookup.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Http { namespace _detail {
+
+  /**
+   * @brief Stores HTTP headers contiguously, in insertion order.
+   *
+   * @details A request carries a dozen or so headers, so a linear scan over a contiguous array is
+   * cheaper than walking a tree, and adding a header doesn't allocate a node. Each entry stores a
+   * case-insensitive hash of its name, so a lookup compares the names of the entries whose hash
+   * matches only.
+   */
+  class HeaderList final {
+  public:
+    /** @brief A header and the case-insensitive hash of its name. */
+    struct Header final
+    {
+      /** @brief The case-insensitive hash of #Name. */
+      std::uint32_t Hash;
+      /** @brief The header name. */
+      std::string Name;
+      /** @brief The header value. */
+      std::string Value;
+    };
+
+    /** @brief Iterator over the headers, in insertion order. */
+    using const_iterator = std::vector<Header>::const_iterator;
+
+    /**
+     * @brief Computes the case-insensitive hash of a header name.
+     *
+     * @param name The header name.
+     * @return The FNV-1a hash of the lowercase name.
+     */
+    static std::uint32_t Hash(std::string const& name) noexcept;
+
+    /**
+     * @brief Finds a header by name, ignoring case.
+     *
+     * @param name The header name.
+     * @return The header, or `nullptr` if there is no header with that name.
+     */
+    Header const* Find(std::string const& name) const noexcept;
+
+    /**
+     * @brief Sets the value of a header, adding the header if it is not in the list.
+     *
+     * @param name The header name.
+     * @param value The header value.
+     */
+    void Set(std::string name, std::string value);
+
+    /**
+     * @brief Removes a header, ignoring the case of its name.
+     *
+     * @param name The header name.
+     */
+    void Remove(std::string const& name);
+
+    /** @brief Removes all the headers. */
+    void Clear() noexcept { m_headers.clear(); }
+
+    /** @brief Returns the number of headers. */
+    std::size_t Size() const noexcept { return m_headers.size(); }
+
+    /** @brief Returns an iterator to the first header. */
+    const_iterator begin() const noexcept { return m_headers.begin(); }
+
+    /** @brief Returns an iterator past the last header. */
+    const_iterator end() const noexcept { return m_headers.end(); }
+
+  private:
+    std::vector<Header> m_headers;
+
+    // Returns the index of the header, or the number of headers if it is not in the list.
+    std::size_t FindIndex(std::string const& name, std::uint32_t hash) const noexcept;
+  };
+
+}}}} // namespace Azure::Core::Http::_detail
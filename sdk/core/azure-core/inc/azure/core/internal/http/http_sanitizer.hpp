@@ -15,19 +15,16 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
     Azure::Core::CaseInsensitiveSet m_allowedHttpHeaders;
 
     /**
-     * @brief HTTP query parameter names that are allowed to be logged.
+     * @brief URL-encoded names of the HTTP query parameters that are allowed to be logged. They
+     * are encoded once here rather than for every URL.
      */
-    std::set<std::string> m_allowedHttpQueryParameters;
+    std::set<std::string> m_encodedAllowedHttpQueryParameters;
 
   public:
     HttpSanitizer() = default;
     HttpSanitizer(
         std::set<std::string> const& allowedHttpQueryParameters,
-        Azure::Core::CaseInsensitiveSet const& allowedHttpHeaders)
-        : m_allowedHttpHeaders(allowedHttpHeaders),
-          m_allowedHttpQueryParameters(allowedHttpQueryParameters)
-    {
-    }
+        Azure::Core::CaseInsensitiveSet const& allowedHttpHeaders);
     /**
      * @brief Sanitizes the specified URL according to the sanitization rules configured.
      *
@@ -32,7 +32,10 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
    */
   class HttpPipeline final {
   protected:
-    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> m_policies;
+    // The policies never change once the pipeline is built, so copies of the pipeline share them
+    // instead of cloning every policy.
+    std::shared_ptr<std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> const>
+        m_policies;
 
   public:
     /**
@@ -51,11 +54,15 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
         throw std::invalid_argument("policies cannot be empty");
       }
 
-      m_policies.reserve(policies.size());
+      std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> clonedPolicies;
+      clonedPolicies.reserve(policies.size());
       for (auto& policy : policies)
       {
-        m_policies.emplace_back(policy->Clone());
+        clonedPolicies.emplace_back(policy->Clone());
       }
+      m_policies = std::make_shared<
+          std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> const>(
+          std::move(clonedPolicies));
     }
 
     /**
@@ -97,57 +104,62 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
       auto pipelineSize = perCallClientPolicies.size() + perRetryClientPolicies.size()
           + perRetryPolicies.size() + perCallPolicies.size() + 6;
 
-      m_policies.reserve(pipelineSize);
+      std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+      policies.reserve(pipelineSize);
 
       // service-specific per call policies
       for (auto& policy : perCallPolicies)
       {
-        m_policies.emplace_back(policy->Clone());
+        policies.emplace_back(policy->Clone());
       }
 
       // Request Id
-      m_policies.emplace_back(
+      policies.emplace_back(
           std::make_unique<Azure::Core::Http::Policies::_internal::RequestIdPolicy>());
 
       // Telemetry (user-agent header)
-      m_policies.emplace_back(
+      policies.emplace_back(
           std::make_unique<Azure::Core::Http::Policies::_internal::TelemetryPolicy>(
               telemetryPackageName, telemetryPackageVersion, clientOptions.Telemetry));
 
       // client-options per call policies.
       for (auto& policy : perCallClientPolicies)
       {
-        m_policies.emplace_back(policy->Clone());
+        policies.emplace_back(policy->Clone());
       }
 
       // Retry policy
-      m_policies.emplace_back(std::make_unique<Azure::Core::Http::Policies::_internal::RetryPolicy>(
-          clientOptions.Retry));
+      policies.emplace_back(std::make_unique<Azure::Core::Http::Policies::_internal::RetryPolicy>(
+          clientOptions.Retry, clientOptions.RetryBudget));
 
       // service-specific per retry policies.
       for (auto& policy : perRetryPolicies)
       {
-        m_policies.emplace_back(policy->Clone());
+        policies.emplace_back(policy->Clone());
       }
       // client options per retry policies.
       for (auto& policy : perRetryClientPolicies)
       {
-        m_policies.emplace_back(policy->Clone());
+        policies.emplace_back(policy->Clone());
       }
 
       // Add a request activity policy which will generate distributed traces for the pipeline.
-      m_policies.emplace_back(
+      policies.emplace_back(
           std::make_unique<Azure::Core::Http::Policies::_internal::RequestActivityPolicy>(
               httpSanitizer));
 
       // logging - won't update request
-      m_policies.emplace_back(
+      policies.emplace_back(
           std::make_unique<Azure::Core::Http::Policies::_internal::LogPolicy>(clientOptions.Log));
 
       // transport
-      m_policies.emplace_back(
+      policies.emplace_back(
           std::make_unique<Azure::Core::Http::Policies::_internal::TransportPolicy>(
               clientOptions.Transport));
+
+      m_policies = std::make_shared<
+          std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> const>(
+          std::move(policies));
     }
 
     /**
@@ -188,30 +200,26 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
      */
     explicit HttpPipeline(
         std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>>&& policies)
-        : m_policies(std::move(policies))
     {
-      if (m_policies.empty())
+      if (policies.empty())
       {
         throw std::invalid_argument("policies cannot be empty");
       }
+      m_policies = std::make_shared<
+          std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> const>(
+          std::move(policies));
     }
 
     /**
      * @brief Copy constructor.
      *
-     * @remark \p other is expected to have at least one policy.
+     * @remark The copy shares the policies of \p other, which are never modified once the
+     * pipeline is built.
      *
      * @param other Another instance of #Azure::Core::Http::_internal::HttpPipeline to create a copy
      * of.
      */
-    HttpPipeline(const HttpPipeline& other)
-    {
-      m_policies.reserve(other.m_policies.size());
-      for (auto& policy : other.m_policies)
-      {
-        m_policies.emplace_back(policy->Clone());
-      }
-    }
+    HttpPipeline(const HttpPipeline& other) = default;
 
     /**
      * @brief Start the HTTP pipeline.
@@ -227,8 +235,8 @@ namespace Azure { namespace Core { namespace Http { namespace _internal {
     {
       // Accessing position zero is fine because pipeline must be constructed with at least one
       // policy.
-      return m_policies[0]->Send(
-          request, Azure::Core::Http::Policies::NextHttpPolicy(0, m_policies), context);
+      return (*m_policies)[0]->Send(
+          request, Azure::Core::Http::Policies::NextHttpPolicy(0, *m_policies), context);
     }
   };
 }}}} // namespace Azure::Core::Http::_internal
@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief A hierarchical timer wheel to run callbacks after a delay without dedicating a thread to
+ * each of them.
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Azure { namespace Core { namespace _internal {
+
+  /**
+   * @brief Runs callbacks after a delay, from a single background thread.
+   *
+   * @details Timers are kept in a hierarchy of wheels with a resolution of one millisecond.
+   * Scheduling and cancelling a timer take constant time, and the background thread only wakes up
+   * when a timer expires or when timers have to move to a finer wheel, so thousands of pending
+   * timers cost neither threads nor wake-ups.
+   *
+   * @remark Callbacks run on the thread of the wheel and delay each other, so they should only
+   * hand the work over to another thread, e.g. by satisfying a promise. Exceptions thrown by
+   * callbacks are ignored.
+   *
+   */
+  class TimerWheel final {
+  public:
+    /**
+     * @brief The identifier of a scheduled timer.
+     *
+     */
+    using TimerId = uint64_t;
+
+    /**
+     * @brief Get the timer wheel shared by the whole process.
+     *
+     */
+    static TimerWheel& GetDefault();
+
+    /**
+     * @brief Construct a timer wheel. The background thread is started by the first timer.
+     *
+     */
+    TimerWheel();
+
+    /**
+     * @brief Stop the background thread. Pending timers are dropped without running them.
+     *
+     */
+    ~TimerWheel();
+
+    TimerWheel(TimerWheel const&) = delete;
+    TimerWheel& operator=(TimerWheel const&) = delete;
+
+    /**
+     * @brief Run \p callback once \p delay has elapsed.
+     *
+     * @param delay The time to wait. Timers never fire early, and fire at most a millisecond late
+     * when the wheel is not busy running other callbacks.
+     * @param callback The function to run on the thread of the wheel.
+     *
+     * @return An identifier which can be passed to #Cancel.
+     */
+    TimerId Schedule(std::chrono::milliseconds delay, std::function<void()> callback);
+
+    /**
+     * @brief Cancel a timer.
+     *
+     * @param timerId The identifier returned by #Schedule.
+     *
+     * @return `true` if the timer was cancelled before its callback started; otherwise, `false`.
+     */
+    bool Cancel(TimerId timerId);
+
+  private:
+    static constexpr size_t LevelBits = 6;
+    static constexpr size_t SlotCount = size_t(1) << LevelBits;
+    static constexpr size_t LevelCount = 4;
+
+    struct Entry final
+    {
+      TimerId Id;
+      uint64_t ExpiryTick;
+    };
+
+    using Slot = std::vector<Entry>;
+
+    void Insert(Entry entry);
+    void Advance(std::vector<std::function<void()>>& expired);
+    uint64_t GetNextWakeUpTick() const;
+    uint64_t GetTick(std::chrono::steady_clock::time_point time) const;
+    void Run();
+
+    std::chrono::steady_clock::time_point const m_start;
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::array<std::array<Slot, SlotCount>, LevelCount> m_wheels;
+    // The callbacks of the pending timers. Cancelled timers are only removed from here, and are
+    // skipped when their slot expires.
+    std::unordered_map<TimerId, std::function<void()>> m_callbacks;
+    uint64_t m_currentTick = 0;
+    TimerId m_nextId = 1;
+    bool m_stopped = false;
+    std::thread m_thread;
+  };
+}}} // namespace Azure::Core::_internal
@@ -294,6 +294,13 @@ namespace Azure { namespace Core { namespace Tracing { namespace _internal {
 
     static std::unique_ptr<TracingContextFactory> CreateFromContext(
         Azure::Core::Context const& context);
+
+    /** @brief Returns the TracingContextFactory stored in \p context, or null if there is none.
+     *
+     * @remark Unlike CreateFromContext, this doesn't copy the factory. The factory is owned by the
+     * context and lives as long as it does.
+     */
+    static TracingContextFactory const* GetFromContext(Azure::Core::Context const& context);
   };
 
   /**
@@ -0,0 +1,182 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "private/async_log_queue.hpp"
+
+#include <cstddef>
+
+using Azure::Core::Diagnostics::Logger;
+using Azure::Core::Diagnostics::_detail::AsyncLogQueue;
+
+namespace {
+std::size_t RoundUpToPowerOfTwo(std::size_t value)
+{
+  // The ring needs at least two slots to tell a full slot from an empty one.
+  std::size_t result = 2;
+  while (result < value)
+  {
+    result <<= 1;
+  }
+  return result;
+}
+} // namespace
+
+AsyncLogQueue::AsyncLogQueue(
+    Logger::AsynchronousOptions const& options,
+    DeliverFunction deliver,
+    std::atomic<std::uint64_t>& droppedMessageCount)
+    : m_mask(RoundUpToPowerOfTwo(options.QueueCapacity) - 1),
+      m_block(options.WhenQueueIsFull == Logger::QueueFullBehavior::Block),
+      m_deliver(std::move(deliver)), m_droppedMessageCount(droppedMessageCount),
+      m_slots(new Slot[m_mask + 1])
+{
+  for (std::size_t i = 0; i <= m_mask; ++i)
+  {
+    m_slots[i].Sequence.store(i, std::memory_order_relaxed);
+  }
+  m_thread = std::thread([this]() { Run(); });
+}
+
+AsyncLogQueue::~AsyncLogQueue()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_messageQueued.notify_one();
+  m_thread.join();
+}
+
+void AsyncLogQueue::Push(Logger::Level level, std::string message)
+{
+  Enqueue(level, std::move(message), nullptr);
+}
+
+void AsyncLogQueue::Push(Logger::Level level, FormatFunction format)
+{
+  Enqueue(level, {}, std::move(format));
+}
+
+void AsyncLogQueue::Enqueue(Logger::Level level, std::string&& message, FormatFunction&& format)
+{
+  auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+  for (;;)
+  {
+    auto& slot = m_slots[position & m_mask];
+    auto const sequence = slot.Sequence.load(std::memory_order_acquire);
+    if (sequence == position)
+    {
+      if (m_enqueuePosition.compare_exchange_weak(
+              position, position + 1, std::memory_order_relaxed))
+      {
+        slot.Level = level;
+        slot.Message = std::move(message);
+        slot.Format = std::move(format);
+        slot.Sequence.store(position + 1, std::memory_order_release);
+        break;
+      }
+    }
+    else if (static_cast<std::ptrdiff_t>(sequence - position) < 0)
+    {
+      // The slot still holds the message from the previous lap: the ring is full. The background
+      // thread can't wait for itself, so messages logged by the listener are dropped.
+      if (!m_block || std::this_thread::get_id() == m_thread.get_id())
+      {
+        m_droppedMessageCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+      }
+      std::this_thread::yield();
+      position = m_enqueuePosition.load(std::memory_order_relaxed);
+    }
+    else
+    {
+      position = m_enqueuePosition.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Pairs with the fence in Run(): either the consumer sees the slot before it sleeps, or this
+  // thread sees that it is waiting and wakes it up.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_consumerWaiting.load(std::memory_order_relaxed))
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_messageQueued.notify_one();
+  }
+}
+
+bool AsyncLogQueue::IsNextSlotReady() const
+{
+  auto const position = m_deliveredPosition.load(std::memory_order_relaxed);
+  return m_slots[position & m_mask].Sequence.load(std::memory_order_acquire) == position + 1;
+}
+
+void AsyncLogQueue::Flush()
+{
+  if (std::this_thread::get_id() == m_thread.get_id())
+  {
+    return;
+  }
+
+  auto const target = m_enqueuePosition.load(std::memory_order_relaxed);
+  m_flushWaiters.fetch_add(1);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_messagesDelivered.wait(lock, [&]() {
+      return m_deliveredPosition.load(std::memory_order_acquire) >= target;
+    });
+  }
+  m_flushWaiters.fetch_sub(1);
+}
+
+void AsyncLogQueue::Run()
+{
+  for (;;)
+  {
+    if (IsNextSlotReady())
+    {
+      auto const position = m_deliveredPosition.load(std::memory_order_relaxed);
+      auto& slot = m_slots[position & m_mask];
+      auto const level = slot.Level;
+      auto message = std::move(slot.Message);
+      auto format = std::move(slot.Format);
+      slot.Format = nullptr;
+      slot.Sequence.store(position + m_mask + 1, std::memory_order_release);
+
+      try
+      {
+        if (format)
+        {
+          message = format();
+        }
+        if (!message.empty())
+        {
+          m_deliver(level, message);
+        }
+      }
+      catch (...)
+      {
+        // There is no caller to report the error to; the message is lost.
+      }
+
+      m_deliveredPosition.store(position + 1, std::memory_order_release);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (m_flushWaiters.load(std::memory_order_relaxed) != 0)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_messagesDelivered.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_consumerWaiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    m_messageQueued.wait(lock, [this]() { return m_stopping || IsNextSlotReady(); });
+    m_consumerWaiting.store(false, std::memory_order_relaxed);
+    if (m_stopping && !IsNextSlotReady())
+    {
+      return;
+    }
+  }
+}
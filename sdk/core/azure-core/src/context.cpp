@@ -27,19 +27,15 @@ const Context Context::ApplicationContext;
 #pragma GCC diagnostic pop
 #endif // _MSC_VER
 
+std::atomic<std::uint64_t> Context::CancellationGeneration{0};
+
 Azure::DateTime Azure::Core::Context::GetDeadline() const
 {
-  // Contexts form a tree. Here, we walk from a node all the way back to the root in order to find
-  // the earliest deadline value.
-  auto result = (DateTime::max)();
-  for (std::shared_ptr<ContextSharedState> ptr = m_contextSharedState; ptr; ptr = ptr->Parent)
+  // A cancelled context reports the earliest possible deadline; otherwise the deadline is the
+  // earliest one in the branch, which was computed when the context was created.
+  if (m_contextSharedState->IsCancelled())
   {
-    auto deadline = ContextSharedState::FromDateTimeRepresentation(ptr->Deadline);
-    if (result > deadline)
-    {
-      result = deadline;
-    }
+    return (DateTime::min)();
   }
-
-  return result;
+  return ContextSharedState::FromDateTimeRepresentation(m_contextSharedState->EffectiveDeadline);
 }
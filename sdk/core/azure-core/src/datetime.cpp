@@ -7,9 +7,7 @@
 
 #include <algorithm>
 #include <ctime>
-#include <iomanip>
 #include <limits>
-#include <sstream>
 #include <stdexcept>
 #include <type_traits>
 
@@ -60,7 +58,7 @@ void ValidateDateElementRange(
     T value,
     decltype(value) minValue,
     decltype(value) maxValue,
-    std::string const& valueName)
+    char const* valueName)
 {
   auto outOfRange = 0;
 
@@ -76,7 +74,7 @@ void ValidateDateElementRange(
   if (outOfRange != 0)
   {
     throw std::invalid_argument(
-        "Azure::DateTime " + valueName + " (" + std::to_string(value) + ") cannot be "
+        std::string("Azure::DateTime ") + valueName + " (" + std::to_string(value) + ") cannot be "
         + (outOfRange < 0 ? std::string("less than ") + std::to_string(minValue)
                           : std::string("greater than ") + std::to_string(maxValue))
         + ".");
@@ -384,6 +382,171 @@ void ParseSingleOptionalChar(
     IncreaseAndCheckMinLength(minLength, actualLength, 1);
   }
 }
+
+// The date and time parts read by the fast parsers. They are validated by the DateTime
+// constructor, as the parts read by the general parser are.
+struct DateTimeParts final
+{
+  int16_t Year;
+  int8_t Month;
+  int8_t Day;
+  int8_t Hour;
+  int8_t Minute;
+  int8_t Second;
+  int32_t FracSec;
+  int8_t DayOfWeek;
+};
+
+// Returns the value of a digit, and sets *invalid if the character is not a digit. The fast
+// parsers check all the digits of a string this way, and test *invalid once.
+inline int ReadDigit(char ch, unsigned* invalid)
+{
+  auto const digit = static_cast<unsigned>(static_cast<unsigned char>(ch)) - '0';
+  *invalid |= static_cast<unsigned>(digit > 9);
+  return static_cast<int>(digit);
+}
+
+inline int ReadTwoDigits(char const* str, unsigned* invalid)
+{
+  return ReadDigit(str[0], invalid) * 10 + ReadDigit(str[1], invalid);
+}
+
+inline int ReadFourDigits(char const* str, unsigned* invalid)
+{
+  return ReadTwoDigits(str, invalid) * 100 + ReadTwoDigits(str + 2, invalid);
+}
+
+constexpr uint32_t PackName(char const* name)
+{
+  return (static_cast<uint32_t>(static_cast<unsigned char>(name[0])) << 16)
+      | (static_cast<uint32_t>(static_cast<unsigned char>(name[1])) << 8)
+      | static_cast<uint32_t>(static_cast<unsigned char>(name[2]));
+}
+
+constexpr uint32_t PackedDayNames[7] = {
+    PackName("Sun"),
+    PackName("Mon"),
+    PackName("Tue"),
+    PackName("Wed"),
+    PackName("Thu"),
+    PackName("Fri"),
+    PackName("Sat"),
+};
+
+constexpr uint32_t PackedMonthNames[12] = {
+    PackName("Jan"),
+    PackName("Feb"),
+    PackName("Mar"),
+    PackName("Apr"),
+    PackName("May"),
+    PackName("Jun"),
+    PackName("Jul"),
+    PackName("Aug"),
+    PackName("Sep"),
+    PackName("Oct"),
+    PackName("Nov"),
+    PackName("Dec"),
+};
+
+// Returns the index of the three-letter name at str, or -1.
+template <int8_t N>
+int8_t FindPackedName(char const* str, uint32_t const (&names)[N])
+{
+  auto const packed = PackName(str);
+  int8_t index = -1;
+  for (int8_t i = 0; i < N; ++i)
+  {
+    index = (names[i] == packed) ? i : index;
+  }
+  return index;
+}
+
+// Parses "Www, DD Mon YYYY HH:MM:SS GMT", the form the services send and ToString() produces.
+// Returns false, leaving the string to the general parser, if the string has any other form.
+bool TryParseRfc1123Canonical(std::string const& dateTime, DateTimeParts* parts)
+{
+  if (dateTime.length() != Core::_internal::DateTimeFormatter::Rfc1123Length)
+  {
+    return false;
+  }
+
+  auto const str = dateTime.data();
+  auto const separatorsMatch = (str[3] == ',') & (str[4] == ' ') & (str[7] == ' ')
+      & (str[11] == ' ') & (str[16] == ' ') & (str[19] == ':') & (str[22] == ':')
+      & (str[25] == ' ') & (str[26] == 'G') & (str[27] == 'M') & (str[28] == 'T');
+
+  unsigned invalid = 0;
+  parts->Day = static_cast<int8_t>(ReadTwoDigits(str + 5, &invalid));
+  parts->Year = static_cast<int16_t>(ReadFourDigits(str + 12, &invalid));
+  parts->Hour = static_cast<int8_t>(ReadTwoDigits(str + 17, &invalid));
+  parts->Minute = static_cast<int8_t>(ReadTwoDigits(str + 20, &invalid));
+  parts->Second = static_cast<int8_t>(ReadTwoDigits(str + 23, &invalid));
+  parts->FracSec = 0;
+  parts->DayOfWeek = FindPackedName(str, PackedDayNames);
+  parts->Month = static_cast<int8_t>(1 + FindPackedName(str + 8, PackedMonthNames));
+
+  return separatorsMatch && invalid == 0 && parts->DayOfWeek >= 0 && parts->Month > 0;
+}
+
+// Parses "YYYY-MM-DDTHH:MM:SSZ" and "YYYY-MM-DDTHH:MM:SS.fffffffZ" with 1 to 7 fraction digits.
+// Returns false, leaving the string to the general parser, if the string has any other form.
+bool TryParseRfc3339Canonical(std::string const& dateTime, DateTimeParts* parts)
+{
+  constexpr std::string::size_type NoFractionLength = 20;
+  auto const length = dateTime.length();
+  if (length < NoFractionLength || length > Core::_internal::DateTimeFormatter::MaxRfc3339Length
+      || length == NoFractionLength + 1)
+  {
+    return false;
+  }
+
+  auto const str = dateTime.data();
+  auto const separatorsMatch = (str[4] == '-') & (str[7] == '-') & (str[10] == 'T')
+      & (str[13] == ':') & (str[16] == ':') & (str[length - 1] == 'Z')
+      & (length == NoFractionLength || str[19] == '.');
+
+  unsigned invalid = 0;
+  parts->Year = static_cast<int16_t>(ReadFourDigits(str, &invalid));
+  parts->Month = static_cast<int8_t>(ReadTwoDigits(str + 5, &invalid));
+  parts->Day = static_cast<int8_t>(ReadTwoDigits(str + 8, &invalid));
+  parts->Hour = static_cast<int8_t>(ReadTwoDigits(str + 11, &invalid));
+  parts->Minute = static_cast<int8_t>(ReadTwoDigits(str + 14, &invalid));
+  parts->Second = static_cast<int8_t>(ReadTwoDigits(str + 17, &invalid));
+  parts->DayOfWeek = -1;
+
+  // Missing fraction digits are zeros: ".12" is 1200000 in 10^-7 seconds.
+  auto const fractionEnd = length - 1;
+  int32_t fracSec = 0;
+  for (auto i = NoFractionLength; i < fractionEnd; ++i)
+  {
+    fracSec = fracSec * 10 + ReadDigit(str[i], &invalid);
+  }
+  for (auto i = fractionEnd; i < Core::_internal::DateTimeFormatter::MaxRfc3339Length - 1; ++i)
+  {
+    fracSec *= 10;
+  }
+  parts->FracSec = fracSec;
+
+  return separatorsMatch && invalid == 0;
+}
+
+inline char* WriteDigits(char* buffer, int value, int width)
+{
+  for (auto i = width - 1; i >= 0; --i)
+  {
+    buffer[i] = static_cast<char>('0' + (value % 10));
+    value /= 10;
+  }
+  return buffer + width;
+}
+
+inline char* WriteName(char* buffer, std::string const& name)
+{
+  buffer[0] = name[0];
+  buffer[1] = name[1];
+  buffer[2] = name[2];
+  return buffer + 3;
+}
 } // namespace
 
 DateTime const DateTime::SystemClockEpoch = GetSystemClockEpoch();
@@ -449,6 +612,25 @@ DateTime::operator std::chrono::system_clock::time_point() const
 
 DateTime DateTime::Parse(std::string const& dateTime, DateFormat format)
 {
+  {
+    DateTimeParts parts{};
+    if ((format == DateFormat::Rfc1123 && TryParseRfc1123Canonical(dateTime, &parts))
+        || (format == DateFormat::Rfc3339 && TryParseRfc3339Canonical(dateTime, &parts)))
+    {
+      return DateTime(
+          parts.Year,
+          parts.Month,
+          parts.Day,
+          parts.Hour,
+          parts.Minute,
+          parts.Second,
+          parts.FracSec,
+          parts.DayOfWeek,
+          0,
+          0);
+    }
+  }
+
   // The values that are not supposed to be read before they are written are set to -123... to avoid
   // warnings on some compilers, yet provide a clearly bad value to make it obvious if things don't
   // work as expected.
@@ -818,32 +1000,8 @@ void DateTime::GetDateTimeParts(
 
 std::string DateTime::ToStringRfc1123() const
 {
-  ThrowIfUnsupportedYear();
-
-  int16_t year = 1;
-
-  // The values that are not supposed to be read before they are written are set to -123... to
-  // avoid warnings on some compilers, yet provide a clearly bad value to make it obvious if
-  // things don't work as expected.
-  int8_t month = -123;
-  int8_t day = -123;
-  int8_t hour = -123;
-  int8_t minute = -123;
-  int8_t second = -123;
-  int32_t fracSec = -1234567890;
-  int8_t dayOfWeek = -123;
-
-  GetDateTimeParts(&year, &month, &day, &hour, &minute, &second, &fracSec, &dayOfWeek);
-
-  std::ostringstream dateString;
-
-  dateString << DayNames[dayOfWeek] << ", " << std::setfill('0') << std::setw(2)
-             << static_cast<int>(day) << ' ' << MonthNames[month - 1] << ' ' << std::setw(4)
-             << static_cast<int>(year) << ' ' << std::setw(2) << static_cast<int>(hour) << ':'
-             << std::setw(2) << static_cast<int>(minute) << ':' << std::setw(2)
-             << static_cast<int>(second) << " GMT";
-
-  return dateString.str();
+  char buffer[Core::_internal::DateTimeFormatter::Rfc1123Length];
+  return std::string(buffer, Core::_internal::DateTimeFormatter::FormatRfc1123(*this, buffer));
 }
 
 std::string DateTime::ToString(DateFormat format) const
@@ -863,6 +1021,63 @@ std::string DateTime::ToString(DateFormat format, TimeFractionFormat fractionFor
         "Unrecognized date format (" + std::to_string(static_cast<int64_t>(format)) + ").");
   }
 
+  char buffer[Core::_internal::DateTimeFormatter::MaxRfc3339Length];
+  return std::string(
+      buffer, Core::_internal::DateTimeFormatter::FormatRfc3339(*this, fractionFormat, buffer));
+}
+
+constexpr std::size_t Core::_internal::DateTimeFormatter::Rfc1123Length;
+constexpr std::size_t Core::_internal::DateTimeFormatter::MaxRfc3339Length;
+
+std::size_t Core::_internal::DateTimeFormatter::FormatRfc1123(
+    DateTime const& dateTime,
+    char* buffer)
+{
+  dateTime.ThrowIfUnsupportedYear();
+
+  int16_t year = 1;
+
+  // The values that are not supposed to be read before they are written are set to -123... to
+  // avoid warnings on some compilers, yet provide a clearly bad value to make it obvious if
+  // things don't work as expected.
+  int8_t month = -123;
+  int8_t day = -123;
+  int8_t hour = -123;
+  int8_t minute = -123;
+  int8_t second = -123;
+  int32_t fracSec = -1234567890;
+  int8_t dayOfWeek = -123;
+
+  dateTime.GetDateTimeParts(&year, &month, &day, &hour, &minute, &second, &fracSec, &dayOfWeek);
+
+  auto out = WriteName(buffer, DayNames[dayOfWeek]);
+  *out++ = ',';
+  *out++ = ' ';
+  out = WriteDigits(out, day, 2);
+  *out++ = ' ';
+  out = WriteName(out, MonthNames[month - 1]);
+  *out++ = ' ';
+  out = WriteDigits(out, year, 4);
+  *out++ = ' ';
+  out = WriteDigits(out, hour, 2);
+  *out++ = ':';
+  out = WriteDigits(out, minute, 2);
+  *out++ = ':';
+  out = WriteDigits(out, second, 2);
+  *out++ = ' ';
+  *out++ = 'G';
+  *out++ = 'M';
+  *out++ = 'T';
+
+  return static_cast<std::size_t>(out - buffer);
+}
+
+std::size_t Core::_internal::DateTimeFormatter::FormatRfc3339(
+    DateTime const& dateTime,
+    DateTime::TimeFractionFormat fractionFormat,
+    char* buffer)
+{
+  using TimeFractionFormat = DateTime::TimeFractionFormat;
   switch (fractionFormat)
   {
     case TimeFractionFormat::DropTrailingZeros:
@@ -877,7 +1092,7 @@ std::string DateTime::ToString(DateFormat format, TimeFractionFormat fractionFor
           + ").");
   }
 
-  ThrowIfUnsupportedYear();
+  dateTime.ThrowIfUnsupportedYear();
 
   int16_t year = 1;
 
@@ -892,39 +1107,64 @@ std::string DateTime::ToString(DateFormat format, TimeFractionFormat fractionFor
   int32_t fracSec = -1234567890;
   int8_t dayOfWeek = -123;
 
-  GetDateTimeParts(&year, &month, &day, &hour, &minute, &second, &fracSec, &dayOfWeek);
-
-  std::ostringstream dateString;
+  dateTime.GetDateTimeParts(&year, &month, &day, &hour, &minute, &second, &fracSec, &dayOfWeek);
 
-  dateString << std::setfill('0') << std::setw(4) << static_cast<int>(year) << '-' << std::setw(2)
-             << static_cast<int>(month) << '-' << std::setw(2) << static_cast<int>(day) << 'T'
-             << std::setw(2) << static_cast<int>(hour) << ':' << std::setw(2)
-             << static_cast<int>(minute) << ':' << std::setw(2) << static_cast<int>(second);
+  auto out = WriteDigits(buffer, year, 4);
+  *out++ = '-';
+  out = WriteDigits(out, month, 2);
+  *out++ = '-';
+  out = WriteDigits(out, day, 2);
+  *out++ = 'T';
+  out = WriteDigits(out, hour, 2);
+  *out++ = ':';
+  out = WriteDigits(out, minute, 2);
+  *out++ = ':';
+  out = WriteDigits(out, second, 2);
 
   if (fractionFormat == TimeFractionFormat::AllDigits)
   {
-    dateString << '.' << std::setw(7) << static_cast<int>(fracSec);
+    *out++ = '.';
+    out = WriteDigits(out, fracSec, 7);
   }
   else if (fracSec != 0 && fractionFormat != TimeFractionFormat::Truncate)
   {
     // Append fractional second, which is a 7-digit value with no trailing zeros
     // This way, '0001200' becomes '00012'
-    auto setw = 1;
+    auto digits = 7;
     auto frac = fracSec;
-    for (auto div = 1000000; div >= 1; div /= 10)
+    while (frac % 10 == 0)
     {
-      if ((fracSec % div) == 0)
-      {
-        frac /= div;
-        break;
-      }
-      ++setw;
+      frac /= 10;
+      --digits;
     }
 
-    dateString << '.' << std::setw(setw) << static_cast<int>(frac);
+    *out++ = '.';
+    out = WriteDigits(out, frac, digits);
   }
 
-  dateString << 'Z';
+  *out++ = 'Z';
+
+  return static_cast<std::size_t>(out - buffer);
+}
+
+std::string Core::_internal::DateTimeFormatter::GetCurrentTimeRfc1123()
+{
+  // RFC 1123 strings have no fraction of a second, so the string only changes once per second.
+  struct CachedTime final
+  {
+    int64_t Second = -1;
+    char Value[Rfc1123Length];
+  };
+  thread_local CachedTime cache;
+
+  auto const now = std::chrono::system_clock::now();
+  auto const second
+      = std::chrono::duration_cast<std::chrono::seconds>(now.time_since_epoch()).count();
+  if (second != cache.Second)
+  {
+    FormatRfc1123(DateTime(now), cache.Value);
+    cache.Second = second;
+  }
 
-  return dateString.str();
+  return std::string(cache.Value, Rfc1123Length);
 }
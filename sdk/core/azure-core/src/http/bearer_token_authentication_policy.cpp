@@ -4,19 +4,222 @@
 #include "azure/core/credentials/credentials.hpp"
 #include "azure/core/http/policies/policy.hpp"
 #include "azure/core/internal/credentials/authorization_challenge_parser.hpp"
+#include "azure/core/internal/timer_wheel.hpp"
 
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 using Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy;
+using Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicyOptions;
 
+using Azure::DateTime;
 using Azure::Core::Context;
+using Azure::Core::_internal::TimerWheel;
+using Azure::Core::Credentials::AccessToken;
 using Azure::Core::Credentials::AuthenticationException;
+using Azure::Core::Credentials::TokenCredential;
 using Azure::Core::Credentials::TokenRequestContext;
 using Azure::Core::Credentials::_detail::AuthorizationChallengeHelper;
 using Azure::Core::Http::RawResponse;
 using Azure::Core::Http::Request;
 using Azure::Core::Http::Policies::NextHttpPolicy;
 
+struct BearerTokenAuthenticationPolicy::TokenState final
+    : public std::enable_shared_from_this<TokenState>
+{
+  struct CachedToken final
+  {
+    AccessToken Token;
+    TokenRequestContext RequestContext;
+  };
+
+  std::shared_ptr<TokenCredential const> const Credential;
+  double const BackgroundRefreshRatio;
+
+  // Only read and replaced with std::atomic_load() and std::atomic_store(), so that requests never
+  // wait for a refresh while the cached token is valid.
+  std::shared_ptr<CachedToken const> Token = std::make_shared<CachedToken const>();
+  std::atomic<bool> InvalidateToken = {false};
+  // Serializes the refreshes made by requests.
+  std::mutex RefreshMutex;
+
+  // Getting a token can take a network round trip, which must not hold up the timer wheel, so the
+  // timer only wakes this thread, which makes the background refreshes one at a time. The worker
+  // is shared with its thread, because the last reference to the state can be released on it.
+  struct RefreshWorker final
+  {
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    bool RefreshPending = false;
+    bool Stopped = false;
+    std::thread Thread;
+  };
+
+  std::mutex TimerMutex;
+  TimerWheel::TimerId RefreshTimer = 0;
+  std::shared_ptr<RefreshWorker> Worker;
+
+  TokenState(std::shared_ptr<TokenCredential const> credential, double backgroundRefreshRatio)
+      : Credential(std::move(credential)), BackgroundRefreshRatio(backgroundRefreshRatio)
+  {
+  }
+
+  ~TokenState()
+  {
+    std::lock_guard<std::mutex> lock(TimerMutex);
+    if (RefreshTimer != 0)
+    {
+      TimerWheel::GetDefault().Cancel(RefreshTimer);
+    }
+    if (Worker)
+    {
+      {
+        std::lock_guard<std::mutex> workerLock(Worker->Mutex);
+        Worker->Stopped = true;
+      }
+      Worker->Condition.notify_one();
+      if (Worker->Thread.get_id() == std::this_thread::get_id())
+      {
+        // The refresh which just finished released the last reference to the state, and the
+        // thread exits as soon as it is back in its loop.
+        Worker->Thread.detach();
+      }
+      else
+      {
+        Worker->Thread.join();
+      }
+    }
+  }
+
+  std::shared_ptr<CachedToken const> Load() const { return std::atomic_load(&Token); }
+
+  void Store(std::shared_ptr<CachedToken const> token)
+  {
+    std::atomic_store(&Token, token);
+    ScheduleRefresh(*token);
+  }
+
+  // Schedules the background refresh of the token once the configured fraction of its remaining
+  // lifetime has elapsed. The refresh is skipped when it would only happen after requests refresh
+  // the token themselves.
+  void ScheduleRefresh(CachedToken const& token)
+  {
+    if (BackgroundRefreshRatio <= 0 || BackgroundRefreshRatio >= 1)
+    {
+      return;
+    }
+
+    DateTime const now = std::chrono::system_clock::now();
+    if (token.Token.ExpiresOn <= now)
+    {
+      return;
+    }
+    auto const delay = std::chrono::duration_cast<std::chrono::milliseconds>(
+        (token.Token.ExpiresOn - now) * BackgroundRefreshRatio);
+    if (delay.count() <= 0
+        || now + delay >= token.Token.ExpiresOn - token.RequestContext.MinimumExpiration)
+    {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(TimerMutex);
+    if (!Worker)
+    {
+      Worker = std::make_shared<RefreshWorker>();
+      Worker->Thread = std::thread(
+          [worker = Worker, weakState = std::weak_ptr<TokenState>(shared_from_this())]() {
+            for (;;)
+            {
+              {
+                std::unique_lock<std::mutex> workerLock(worker->Mutex);
+                worker->Condition.wait(
+                    workerLock, [&]() { return worker->RefreshPending || worker->Stopped; });
+                if (worker->Stopped)
+                {
+                  return;
+                }
+                worker->RefreshPending = false;
+              }
+              if (auto state = weakState.lock())
+              {
+                state->RefreshInBackground();
+              }
+            }
+          });
+    }
+    if (RefreshTimer != 0)
+    {
+      TimerWheel::GetDefault().Cancel(RefreshTimer);
+    }
+    RefreshTimer = TimerWheel::GetDefault().Schedule(
+        delay, [weakWorker = std::weak_ptr<RefreshWorker>(Worker)]() {
+          if (auto worker = weakWorker.lock())
+          {
+            {
+              std::lock_guard<std::mutex> workerLock(worker->Mutex);
+              worker->RefreshPending = true;
+            }
+            worker->Condition.notify_one();
+          }
+        });
+  }
+
+  void RefreshInBackground()
+  {
+    auto cached = Load();
+    // The cached token is still valid, so a credential which caches tokens would return it again.
+    // As for an invalidated token, ask for one which outlives any cached token.
+    TokenRequestContext renewalContext = cached->RequestContext;
+    renewalContext.MinimumExpiration = DateTime::duration::max();
+
+    std::shared_ptr<CachedToken const> refreshed;
+    try
+    {
+      refreshed = std::make_shared<CachedToken const>(CachedToken{
+          Credential->GetToken(renewalContext, Context{}), cached->RequestContext});
+    }
+    catch (...)
+    {
+      // Keep the cached token, which is still valid, and try again later. As the delay is a
+      // fraction of the remaining lifetime, attempts get closer until requests refresh the token.
+      ScheduleRefresh(*cached);
+      return;
+    }
+
+    // A request could have replaced the token in the meantime, e.g. with a token for another
+    // tenant, in which case the refreshed token is dropped.
+    if (std::atomic_compare_exchange_strong(&Token, &cached, refreshed))
+    {
+      ScheduleRefresh(*refreshed);
+    }
+  }
+};
+
+BearerTokenAuthenticationPolicy::BearerTokenAuthenticationPolicy(
+    std::shared_ptr<const TokenCredential> credential,
+    TokenRequestContext tokenRequestContext,
+    BearerTokenAuthenticationPolicyOptions const& options)
+    : m_tokenRequestContext(std::move(tokenRequestContext)),
+      m_tokenState(
+          std::make_shared<TokenState>(std::move(credential), options.BackgroundRefreshRatio))
+{
+}
+
+BearerTokenAuthenticationPolicy::BearerTokenAuthenticationPolicy(
+    BearerTokenAuthenticationPolicy const& other)
+    : m_tokenRequestContext(other.m_tokenRequestContext),
+      m_tokenState(std::make_shared<TokenState>(
+          other.m_tokenState->Credential,
+          other.m_tokenState->BackgroundRefreshRatio))
+{
+  m_tokenState->Token = other.m_tokenState->Load();
+  m_tokenState->InvalidateToken.store(other.m_tokenState->InvalidateToken.load());
+}
+
+BearerTokenAuthenticationPolicy::~BearerTokenAuthenticationPolicy() = default;
+
 std::unique_ptr<RawResponse> BearerTokenAuthenticationPolicy::Send(
     Request& request,
     NextHttpPolicy nextPolicy,
@@ -31,7 +234,8 @@ std::unique_ptr<RawResponse> BearerTokenAuthenticationPolicy::Send(
   auto result = AuthorizeAndSendRequest(request, nextPolicy, context);
   {
     auto const& response = *result;
-    m_invalidateToken = (response.GetStatusCode() == HttpStatusCode::Unauthorized);
+    m_tokenState->InvalidateToken
+        = (response.GetStatusCode() == HttpStatusCode::Unauthorized);
     auto const& challenge = AuthorizationChallengeHelper::GetChallenge(response);
     if (!challenge.empty() && AuthorizeRequestOnChallenge(challenge, request, context))
     {
@@ -90,38 +294,45 @@ void BearerTokenAuthenticationPolicy::AuthenticateAndAuthorizeRequest(
     Context const& context) const
 {
   DateTime const currentTime = std::chrono::system_clock::now();
+  auto& state = *m_tokenState;
 
   {
-    std::shared_lock<std::shared_timed_mutex> readLock(m_accessTokenMutex);
+    auto const cached = state.Load();
     if (!TokenNeedsRefresh(
-            m_accessToken,
-            m_accessTokenContext,
+            cached->Token,
+            cached->RequestContext,
             currentTime,
             tokenRequestContext,
-            m_invalidateToken))
+            state.InvalidateToken))
     {
-      ApplyBearerToken(request, m_accessToken);
+      ApplyBearerToken(request, cached->Token);
       return;
     }
   }
 
-  std::unique_lock<std::shared_timed_mutex> writeLock(m_accessTokenMutex);
+  std::lock_guard<std::mutex> refreshLock(state.RefreshMutex);
   // Check if token needs refresh for the second time in case another thread has just updated it.
+  auto cached = state.Load();
   if (TokenNeedsRefresh(
-          m_accessToken, m_accessTokenContext, currentTime, tokenRequestContext, m_invalidateToken))
+          cached->Token,
+          cached->RequestContext,
+          currentTime,
+          tokenRequestContext,
+          state.InvalidateToken))
   {
     TokenRequestContext trcCopy = tokenRequestContext;
-    if (m_invalidateToken)
+    if (state.InvalidateToken)
     {
       // Need to set this to invalidate the credential's token cache to ensure we fetch a new token
       // on subsequent GetToken calls.
       trcCopy.MinimumExpiration = DateTime::duration::max();
     }
 
-    m_accessToken = m_credential->GetToken(trcCopy, context);
-    m_accessTokenContext = tokenRequestContext;
-    m_invalidateToken = false;
+    cached = std::make_shared<TokenState::CachedToken const>(TokenState::CachedToken{
+        state.Credential->GetToken(trcCopy, context), tokenRequestContext});
+    state.Store(cached);
+    state.InvalidateToken = false;
   }
 
-  ApplyBearerToken(request, m_accessToken);
+  ApplyBearerToken(request, cached->Token);
 }
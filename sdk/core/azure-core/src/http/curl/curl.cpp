@@ -23,6 +23,7 @@
 // Private include
 #include "curl_connection_pool_private.hpp"
 #include "curl_connection_private.hpp"
+#include "curl_multi_private.hpp"
 #include "curl_session_private.hpp"
 
 #if defined(AZ_PLATFORM_POSIX)
@@ -59,6 +60,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -188,81 +190,6 @@ void WinSocketSetBuffSize(curl_socket_t socket)
 }
 #endif
 
-static void CleanupThread()
-{
-  // NOTE: Avoid using Log::Write in here as it may fail on macOS,
-  // see issue: https://github.com/Azure/azure-sdk-for-cpp/issues/3224
-  // This method can wake up in de-attached mode after the application has been terminated.
-  // If that happens, trying to use `Log` would cause `abort` as it was previously deallocated.
-  using namespace Azure::Core::Http::_detail;
-  for (;;)
-  {
-    // Won't continue until the ConnectionPoolMutex is released from MoveConnectionBackToPool
-    std::unique_lock<std::mutex> lockForPoolCleaning(
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-
-    // Wait for the default time OR to the signal from the conditional variable.
-    // wait_for releases the mutex lock when it goes to sleep and it takes the lock again when it
-    // wakes up (or it's cancelled).
-    if (CurlConnectionPool::g_curlConnectionPool.ConditionalVariableForCleanThread.wait_for(
-            lockForPoolCleaning,
-            std::chrono::milliseconds(DefaultCleanerIntervalMilliseconds),
-            []() {
-              return CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size() == 0;
-            }))
-    {
-      // Cancelled by another thread or no connections on wakeup
-      CurlConnectionPool::g_curlConnectionPool.IsCleanThreadRunning = false;
-      break;
-    }
-
-    decltype(CurlConnectionPool::g_curlConnectionPool
-                 .ConnectionPoolIndex)::mapped_type connectionsToBeCleaned;
-
-    // loop the connection pool index - Note: lock is re-taken for the mutex
-    // Notes: The size of each host-index is always expected to be greater than 0 because the
-    // host-index is removed anytime it becomes empty.
-    for (auto index = CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.begin();
-         index != CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.end();)
-    {
-      // Each pool index behaves as a Last-in-First-out (connections are added to the pool with
-      // push_front). The last connection moved to the pool will be the first to be re-used. Because
-      // of this, the oldest connection in the pool can be found at the end of the list. Looping the
-      // connection pool backwards until a connection that is not expired is found or until all
-      // connections are removed.
-      auto& connectionList = index->second;
-      auto connectionIter = connectionList.end();
-      while (connectionIter != connectionList.begin())
-      {
-        --connectionIter;
-        if ((*connectionIter)->IsExpired())
-        {
-          // remove connection from the pool and update the connection to the next one
-          // which is going to be list.end()
-          connectionsToBeCleaned.emplace_back(std::move(*connectionIter));
-          connectionIter = connectionList.erase(connectionIter);
-        }
-        else
-        {
-          break;
-        }
-      }
-
-      if (connectionList.empty())
-      {
-        index = CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.erase(index);
-      }
-      else
-      {
-        ++index;
-      }
-    }
-
-    lockForPoolCleaning.unlock();
-    // Do actual connections release work here, without holding the mutex.
-  }
-}
-
 // This function is only used when ExpectedTlsRootCertificate transport options is set to non empty.
 // And that capability only impacts the curl transport behavior in versions of libcurl >= 7.77.0.
 #if LIBCURL_VERSION_NUM >= 0x074D00 // 7.77.0
@@ -324,15 +251,28 @@ using Azure::Core::Http::RawResponse;
 using Azure::Core::Http::Request;
 using Azure::Core::Http::TransportException;
 using Azure::Core::Http::_detail::CurlConnectionPool;
+using Azure::Core::Http::_detail::RequestHeaders;
 
 Azure::Core::Http::_detail::CurlConnectionPool
     Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool;
 
+CurlTransport::CurlTransport(CurlTransportOptions const& options)
+    : m_options(options),
+      m_connectionKeySuffix(CurlConnectionPool::GetConnectionKeySuffix(m_options))
+{
+}
+
 CurlTransport::CurlTransport(Azure::Core::Http::Policies::TransportOptions const& options)
     : CurlTransport(CurlTransportOptionsFromTransportOptions(options))
 {
 }
 
+void CurlTransport::PrewarmConnections(Azure::Core::Url const& url, size_t connectionCount)
+{
+  Request request(Azure::Core::Http::HttpMethod::Get, url);
+  CurlConnectionPool::g_curlConnectionPool.PrewarmConnections(request, m_options, connectionCount);
+}
+
 std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const& context)
 {
   // Create CurlSession to perform request
@@ -340,7 +280,8 @@ std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const
 
   auto session = std::make_unique<CurlSession>(
       request,
-      CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(request, m_options),
+      CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
+          request, m_options, m_connectionKeySuffix),
       m_options);
 
   CURLcode performing;
@@ -369,6 +310,7 @@ std::unique_ptr<RawResponse> CurlTransport::Send(Request& request, Context const
         CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(
             request,
             m_options,
+            m_connectionKeySuffix,
             getConnectionOpenIntent + 1 >= _detail::RequestPoolResetAfterConnectionFailed),
         m_options);
   }
@@ -405,9 +347,7 @@ CURLcode CurlSession::Perform(Context const& context)
 
   // libcurl settings after connection is open (headers)
   {
-    auto headers = this->m_request.GetHeaders();
-    auto hostHeader = headers.find("Host");
-    if (hostHeader == headers.end())
+    if (!RequestHeaders::Contains(this->m_request, "Host"))
     {
       Log::Write(Logger::Level::Verbose, LogMsgPrefix + "No Host in request headers. Adding it");
       std::string hostName = this->m_request.GetUrl().GetHost();
@@ -421,7 +361,7 @@ CURLcode CurlSession::Perform(Context const& context)
     if (this->m_request.GetMethod() != HttpMethod::Get
         && this->m_request.GetMethod() != HttpMethod::Head
         && this->m_request.GetMethod() != HttpMethod::Delete
-        && headers.find("content-length") == headers.end())
+        && !RequestHeaders::Contains(this->m_request, "content-length"))
     {
       Log::Write(Logger::Level::Verbose, LogMsgPrefix + "No content-length in headers. Adding it");
       this->m_request.SetHeader(
@@ -700,13 +640,13 @@ inline std::string CurlSession::GetHeadersAsString(Azure::Core::Http::Request co
 {
   std::string requestHeaderString;
 
-  for (auto const& header : request.GetHeaders())
-  {
-    requestHeaderString += header.first; // string (key)
-    requestHeaderString += ": ";
-    requestHeaderString += header.second; // string's value
-    requestHeaderString += "\r\n";
-  }
+  RequestHeaders::ForEach(
+      request, [&requestHeaderString](std::string const& name, std::string const& value) {
+        requestHeaderString += name; // string (key)
+        requestHeaderString += ": ";
+        requestHeaderString += value; // string's value
+        requestHeaderString += "\r\n";
+      });
   requestHeaderString += "\r\n";
 
   return requestHeaderString;
@@ -749,11 +689,11 @@ void CurlSession::ParseChunkSize(Context const& context)
   // Move to after chunk size
   for (bool keepPolling = true; keepPolling;)
   {
-    for (size_t index = this->m_bodyStartInBuffer, iteration = 0; index < this->m_innerBufferSize;
-         index++, iteration++)
+    for (size_t index = this->m_bodyStartInBuffer; index < this->m_innerBufferSize; index++)
     {
       strChunkSize.append(reinterpret_cast<char*>(&this->m_readBuffer[index]), 1);
-      if (iteration > 1 && this->m_readBuffer[index] == '\n')
+      // The chunk size line can be split across reads, so count what was taken from all of them.
+      if (strChunkSize.size() > 2 && this->m_readBuffer[index] == '\n')
       {
         // get chunk size. Chunk size comes in Hex value
         try
@@ -791,7 +731,7 @@ void CurlSession::ParseChunkSize(Context const& context)
            * indicate the the next read call should read from the inner buffer start.
            */
           this->m_innerBufferSize = m_connection->ReadFromSocket(
-              this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+              this->m_readBuffer.get(), m_readBufferSize, context);
           this->m_bodyStartInBuffer = 0;
         }
         else
@@ -811,7 +751,7 @@ void CurlSession::ParseChunkSize(Context const& context)
     if (keepPolling)
     { // Read all internal buffer and \n was not found, pull from wire
       this->m_innerBufferSize = m_connection->ReadFromSocket(
-          this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+          this->m_readBuffer.get(), m_readBufferSize, context);
       this->m_bodyStartInBuffer = 0;
     }
   }
@@ -835,18 +775,18 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       // parse from internal buffer. This means previous read from server got more than one
       // response. This happens when Server returns a 100-continue plus an error code
       bufferSize = this->m_innerBufferSize - this->m_bodyStartInBuffer;
-      bytesParsed = parser.Parse(this->m_readBuffer + this->m_bodyStartInBuffer, bufferSize);
+      bytesParsed = parser.Parse(this->m_readBuffer.get() + this->m_bodyStartInBuffer, bufferSize);
       // if parsing from internal buffer is not enough, do next read from wire
       reuseInternalBuffer = false;
       // reset body start
-      this->m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+      this->m_bodyStartInBuffer = m_readBufferSize;
     }
     else
     {
       // Try to fill internal buffer from socket.
       // If response is smaller than buffer, we will get back the size of the response
       bufferSize = m_connection->ReadFromSocket(
-          this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+          this->m_readBuffer.get(), m_readBufferSize, context);
       if (bufferSize == 0)
       {
         // closed connection, prevent application from keep trying to pull more bytes from the wire
@@ -854,7 +794,7 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
         return CURLE_RECV_ERROR;
       }
       // returns the number of bytes parsed up to the body Start
-      bytesParsed = parser.Parse(this->m_readBuffer, bufferSize);
+      bytesParsed = parser.Parse(this->m_readBuffer.get(), bufferSize);
     }
 
     if (bytesParsed < bufferSize)
@@ -986,7 +926,7 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       || this->m_lastStatusCode == HttpStatusCode::NotModified)
   {
     this->m_contentLength = 0;
-    this->m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+    this->m_bodyStartInBuffer = m_readBufferSize;
     return CURLE_OK;
   }
 
@@ -1040,7 +980,7 @@ CURLcode CurlSession::ReadStatusLineAndHeadersFromRawResponse(
       if (this->m_bodyStartInBuffer >= this->m_innerBufferSize)
       { // if nothing on inner buffer, pull from wire
         this->m_innerBufferSize = m_connection->ReadFromSocket(
-            this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+            this->m_readBuffer.get(), m_readBufferSize, context);
         if (this->m_innerBufferSize == 0)
         {
           // closed connection, prevent application from keep trying to pull more bytes from the
@@ -1077,7 +1017,7 @@ void CurlSession::ReadExpected(uint8_t expected, Context const& context)
   {
     // end of buffer, pull data from wire
     this->m_innerBufferSize = m_connection->ReadFromSocket(
-        this->m_readBuffer, _detail::DefaultLibcurlReaderSize, context);
+        this->m_readBuffer.get(), m_readBufferSize, context);
     if (this->m_innerBufferSize == 0)
     {
       // closed connection, prevent application from keep trying to pull more bytes from the wire
@@ -1150,7 +1090,7 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   {
     // still have data to take from innerbuffer
     Azure::Core::IO::MemoryBodyStream innerBufferMemoryStream(
-        this->m_readBuffer + this->m_bodyStartInBuffer,
+        this->m_readBuffer.get() + this->m_bodyStartInBuffer,
         this->m_innerBufferSize - this->m_bodyStartInBuffer);
 
     // From code inspection, it is guaranteed that the readRequestLength will fit within size_t
@@ -1174,9 +1114,45 @@ size_t CurlSession::OnRead(uint8_t* buffer, size_t count, Context const& context
   {
     return 0;
   }
-  // Read from socket when no more data on internal buffer
-  // For chunk request, read a chunk based on chunk size
-  totalRead = m_connection->ReadFromSocket(buffer, static_cast<size_t>(readRequestLength), context);
+  if (readRequestLength < m_readBufferSize)
+  {
+    // Small reads are served from the internal buffer, which is refilled with whatever the socket
+    // has, so reading the body in small pieces doesn't cost one socket read per piece.
+    size_t fillLength = m_readBufferSize;
+    if (this->m_contentLength > 0)
+    {
+      fillLength = (std::min)(
+          fillLength, static_cast<size_t>(this->m_contentLength) - this->m_sessionTotalRead);
+    }
+    auto const received = m_connection->ReadFromSocket(m_readBuffer.get(), fillLength, context);
+    if (received > 0)
+    {
+      totalRead = (std::min)(readRequestLength, received);
+      std::memcpy(buffer, m_readBuffer.get(), totalRead);
+      this->m_innerBufferSize = received;
+      this->m_bodyStartInBuffer = totalRead;
+      this->m_sessionTotalRead += totalRead;
+      return totalRead;
+    }
+  }
+  else
+  {
+    // Read from socket when no more data on internal buffer
+    // For chunk request, read a chunk based on chunk size
+    totalRead = m_connection->ReadFromSocket(buffer, readRequestLength, context);
+    // Large reads go straight to the caller's buffer. Take whatever else the socket has already
+    // received as well, so the caller gets as much data as possible per call.
+    while (totalRead > 0 && totalRead < readRequestLength)
+    {
+      auto const available = m_connection->ReadAvailableFromSocket(
+          buffer + totalRead, readRequestLength - totalRead);
+      if (available == 0)
+      {
+        break;
+      }
+      totalRead += available;
+    }
+  }
   this->m_sessionTotalRead += totalRead;
 
   // Reading 0 bytes means closed connection.
@@ -1253,6 +1229,26 @@ size_t CurlConnection::ReadFromSocket(uint8_t* buffer, size_t bufferSize, Contex
   return readBytes;
 }
 
+size_t CurlConnection::ReadAvailableFromSocket(uint8_t* buffer, size_t bufferSize)
+{
+  size_t readBytes = 0;
+  auto readResult = curl_easy_recv(m_handle.get(), buffer, bufferSize, &readBytes);
+  switch (readResult)
+  {
+    case CURLE_AGAIN: {
+      return 0;
+    }
+    case CURLE_OK: {
+      return readBytes;
+    }
+    default: {
+      throw TransportException(
+          "Error while reading from network socket. CURLE code: " + std::to_string(readResult)
+          + ". " + std::string(curl_easy_strerror(readResult)));
+    }
+  }
+}
+
 std::unique_ptr<RawResponse> CurlSession::ExtractResponse() { return std::move(this->m_response); }
 
 size_t CurlSession::ResponseBufferParser::Parse(
@@ -1375,53 +1371,6 @@ size_t CurlSession::ResponseBufferParser::Parse(
 }
 
 namespace {
-// Calculate the connection key.
-// The connection key is a tuple of host, proxy info, TLS info, etc. Basically any characteristics
-// of the connection that should indicate that the connection shouldn't be re-used should be listed
-// the connection key.
-inline std::string GetConnectionKey(std::string const& host, CurlTransportOptions const& options)
-{
-  std::string key(host);
-  key.append(",");
-  key.append(!options.CAInfo.empty() ? options.CAInfo : "0");
-  key.append(",");
-  key.append(!options.CAPath.empty() ? options.CAPath : "0");
-  key.append(",");
-  key.append(
-      options.Proxy.HasValue() ? (options.Proxy.Value().empty() ? "NoProxy" : options.Proxy.Value())
-                               : "0");
-  key.append(",");
-  key.append(options.ProxyUsername.ValueOr("0"));
-  key.append(",");
-  key.append(options.ProxyPassword.ValueOr("0"));
-  key.append(",");
-  key.append(!options.SslOptions.EnableCertificateRevocationListCheck ? "1" : "0");
-  key.append(",");
-  key.append(options.SslVerifyPeer ? "1" : "0");
-  key.append(",");
-  key.append(options.NoSignal ? "1" : "0");
-  key.append(",");
-  key.append(options.SslOptions.AllowFailedCrlRetrieval ? "FC" : "0");
-  key.append(",");
-#if LIBCURL_VERSION_NUM >= 0x074D00 // 7.77.0
-  key.append(
-      !options.SslOptions.PemEncodedExpectedRootCertificates.empty() ? std::to_string(
-          std::hash<std::string>{}(options.SslOptions.PemEncodedExpectedRootCertificates))
-                                                                     : "0");
-#else
-  key.append("0");
-#endif
-  key.append(",");
-  // using DefaultConnectionTimeout or 0 result in the same setting
-  key.append(
-      (options.ConnectionTimeout == Azure::Core::Http::_detail::DefaultConnectionTimeout
-       || options.ConnectionTimeout == std::chrono::milliseconds(0))
-          ? "0"
-          : std::to_string(options.ConnectionTimeout.count()));
-
-  return key;
-}
-
 void DumpCurlInfoToLog(std::string const& text, uint8_t* ptr, size_t size)
 {
 
@@ -2164,55 +2113,156 @@ int CurlConnection::SslCtxCallback(CURL*, void* sslctx)
 }
 #endif
 
+// Calculate the connection key suffix.
+// The connection key is a tuple of host, proxy info, TLS info, etc. Basically any characteristics
+// of the connection that should indicate that the connection shouldn't be re-used should be listed
+// the connection key.
+std::string CurlConnectionPool::GetConnectionKeySuffix(CurlTransportOptions const& options)
+{
+  std::string key(",");
+  key.append(!options.CAInfo.empty() ? options.CAInfo : "0");
+  key.append(",");
+  key.append(!options.CAPath.empty() ? options.CAPath : "0");
+  key.append(",");
+  key.append(
+      options.Proxy.HasValue() ? (options.Proxy.Value().empty() ? "NoProxy" : options.Proxy.Value())
+                               : "0");
+  key.append(",");
+  key.append(options.ProxyUsername.ValueOr("0"));
+  key.append(",");
+  key.append(options.ProxyPassword.ValueOr("0"));
+  key.append(",");
+  key.append(!options.SslOptions.EnableCertificateRevocationListCheck ? "1" : "0");
+  key.append(",");
+  key.append(options.SslVerifyPeer ? "1" : "0");
+  key.append(",");
+  key.append(options.NoSignal ? "1" : "0");
+  key.append(",");
+  key.append(options.SslOptions.AllowFailedCrlRetrieval ? "FC" : "0");
+  key.append(",");
+#if LIBCURL_VERSION_NUM >= 0x074D00 // 7.77.0
+  key.append(
+      !options.SslOptions.PemEncodedExpectedRootCertificates.empty() ? std::to_string(
+          std::hash<std::string>{}(options.SslOptions.PemEncodedExpectedRootCertificates))
+                                                                     : "0");
+#else
+  key.append("0");
+#endif
+  key.append(",");
+  // using DefaultConnectionTimeout or 0 result in the same setting
+  key.append(
+      (options.ConnectionTimeout == Azure::Core::Http::_detail::DefaultConnectionTimeout
+       || options.ConnectionTimeout == std::chrono::milliseconds(0))
+          ? "0"
+          : std::to_string(options.ConnectionTimeout.count()));
+
+  return key;
+}
+
+namespace {
+// Generate a display name for the host being connected to
+inline std::string GetHostDisplayName(Azure::Core::Url const& url)
+{
+  uint16_t port = url.GetPort();
+  std::string const portText = port != 0 ? std::to_string(port) : std::string();
+  std::string hostDisplayName;
+  hostDisplayName.reserve(url.GetScheme().size() + 4 + url.GetHost().size() + portText.size());
+  hostDisplayName.append(url.GetScheme()).append("://").append(url.GetHost());
+  if (port != 0)
+  {
+    hostDisplayName.append(":").append(portText);
+  }
+  return hostDisplayName;
+}
+
+inline std::string GetConnectionKey(
+    std::string const& hostDisplayName,
+    std::string const& connectionKeySuffix)
+{
+  std::string connectionKey;
+  connectionKey.reserve(hostDisplayName.size() + connectionKeySuffix.size());
+  connectionKey.append(hostDisplayName).append(connectionKeySuffix);
+  return connectionKey;
+}
+
+// Records the minimum number of idle connections of the options for the host of a request, with
+// what the pool needs to open new connections to that host.
+void KeepMinIdleConnections(
+    CurlConnectionPool& pool,
+    Request const& request,
+    CurlTransportOptions const& options,
+    std::string const& hostDisplayName,
+    std::string const& connectionKey)
+{
+  if (options.MinIdleConnectionsPerHost == 0
+      || pool.GetMinIdleConnections(connectionKey) >= options.MinIdleConnectionsPerHost)
+  {
+    return;
+  }
+
+  pool.SetMinIdleConnections(
+      connectionKey,
+      options.MinIdleConnectionsPerHost,
+      options.MaxIdleConnectionsPerHost,
+      [url = request.GetUrl(), options, hostDisplayName, connectionKey]()
+          -> std::unique_ptr<CurlNetworkConnection> {
+        Request connectionRequest(Azure::Core::Http::HttpMethod::Get, url);
+        return std::make_unique<CurlConnection>(
+            connectionRequest, options, hostDisplayName, connectionKey);
+      });
+}
+} // namespace
+
 std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlConnection(
     Request& request,
     CurlTransportOptions const& options,
+    std::string const& connectionKeySuffix,
     bool resetPool)
 {
-  uint16_t port = request.GetUrl().GetPort();
-  // Generate a display name for the host being connected to
-  std::string const& hostDisplayName = request.GetUrl().GetScheme() + "://"
-      + request.GetUrl().GetHost() + (port != 0 ? ":" + std::to_string(port) : "");
-  std::string const connectionKey = GetConnectionKey(hostDisplayName, options);
+  std::string const hostDisplayName = GetHostDisplayName(request.GetUrl());
+  std::string const connectionKey = GetConnectionKey(hostDisplayName, connectionKeySuffix);
+  KeepMinIdleConnections(*this, request, options, hostDisplayName, connectionKey);
 
   {
-    decltype(CurlConnectionPool::g_curlConnectionPool
-                 .ConnectionPoolIndex)::mapped_type connectionsToBeReset;
+    decltype(HostConnections::Connections) connectionsToBeReset;
 
-    // Critical section. Needs to own ConnectionPoolMutex before executing
+    // Critical section. Needs to own the shard mutex before executing
     // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
-    std::unique_lock<std::mutex> lock(CurlConnectionPool::ConnectionPoolMutex);
+    auto& shard = GetShard(connectionKey);
+    std::unique_lock<std::mutex> lock(shard.Mutex);
 
     // get a ref to the pool from the map of pools
-    auto hostPoolIndex = g_curlConnectionPool.ConnectionPoolIndex.find(connectionKey);
+    auto hostPoolIndex = shard.ConnectionPoolIndex.find(connectionKey);
 
-    if (hostPoolIndex != g_curlConnectionPool.ConnectionPoolIndex.end()
-        && hostPoolIndex->second.size() > 0)
+    if (hostPoolIndex != shard.ConnectionPoolIndex.end()
+        && hostPoolIndex->second.Connections.size() > 0)
     {
+      auto& connections = hostPoolIndex->second.Connections;
       if (resetPool)
       {
-        connectionsToBeReset = std::move(hostPoolIndex->second);
+        connectionsToBeReset = std::move(connections);
         // clean the pool-index as requested in the call. Typically to force a new connection to be
         // created and to discard all current connections in the pool for the host-index. A caller
         // might request this after getting broken/closed connections multiple-times.
-        hostPoolIndex->second.clear();
+        shard.ConnectionPoolIndex.erase(hostPoolIndex);
         Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Reset connection pool requested.");
       }
       else
       {
         // get ref to first connection
-        auto fistConnectionIterator = hostPoolIndex->second.begin();
+        auto fistConnectionIterator = connections.begin();
         // move the connection ref to temp ref
         auto connection = std::move(*fistConnectionIterator);
         // Remove the connection ref from list
-        hostPoolIndex->second.erase(fistConnectionIterator);
+        connections.erase(fistConnectionIterator);
 
         // Remove index if there are no more connections
-        if (hostPoolIndex->second.size() == 0)
+        if (connections.size() == 0)
         {
-          g_curlConnectionPool.ConnectionPoolIndex.erase(hostPoolIndex);
+          shard.ConnectionPoolIndex.erase(hostPoolIndex);
         }
 
+        lock.unlock();
         Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Re-using connection from the pool.");
         // return connection ref
         return connection;
@@ -2231,14 +2281,15 @@ std::unique_ptr<CurlNetworkConnection> CurlConnectionPool::ExtractOrCreateCurlCo
 // first connection to be picked next time some one ask for a connection to the pool (LIFO)
 void CurlConnectionPool::MoveConnectionBackToPool(
     std::unique_ptr<CurlNetworkConnection> connection,
-    bool httpKeepAlive)
+    bool httpKeepAlive,
+    size_t maxIdleConnections)
 {
   if (!httpKeepAlive)
   {
     return; // The server has asked us to not re-use this connection.
   }
 
-  if (connection->IsShutdown())
+  if (connection->IsShutdown() || maxIdleConnections == 0)
   {
     // Can't re-used a shut down connection
     return;
@@ -2246,94 +2297,340 @@ void CurlConnectionPool::MoveConnectionBackToPool(
 
   Log::Write(Logger::Level::Verbose, "Moving connection to pool...");
 
-  decltype(CurlConnectionPool::g_curlConnectionPool
-               .ConnectionPoolIndex)::mapped_type::value_type connectionToBeRemoved;
+  AddConnectionToPool(std::move(connection), maxIdleConnections);
 
-  // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
-  std::unique_lock<std::mutex> lock(CurlConnectionPool::ConnectionPoolMutex);
-  auto& poolId = connection->GetConnectionKey();
-  auto& hostPool = g_curlConnectionPool.ConnectionPoolIndex[poolId];
+  // Cleanup will start a background thread which will close abandoned connections from the pool.
+  // This will free-up resources from the app
+  // This is the only call to cleanup.
+  StartCleanThread();
+}
+
+void CurlConnectionPool::AddConnectionToPool(
+    std::unique_ptr<CurlNetworkConnection> connection,
+    size_t maxIdleConnections)
+{
+  decltype(HostConnections::Connections)::value_type connectionToBeRemoved;
 
-  if (hostPool.size() >= _detail::MaxConnectionsPerIndex && !hostPool.empty())
   {
-    // Remove the last connection from the pool to insert this one.
-    auto lastConnection = --hostPool.end();
-    connectionToBeRemoved = std::move(*lastConnection);
-    hostPool.erase(lastConnection);
-  }
+    // Lock mutex to access connection pool. mutex is unlock as soon as lock is out of scope
+    auto& poolId = connection->GetConnectionKey();
+    auto& shard = GetShard(poolId);
+    std::unique_lock<std::mutex> lock(shard.Mutex);
+    auto& hostPool = shard.ConnectionPoolIndex[poolId];
 
-  // update the time when connection was moved back to pool
-  connection->UpdateLastUsageTime();
-  hostPool.push_front(std::move(connection));
+    if (hostPool.Connections.size() >= maxIdleConnections && !hostPool.Connections.empty())
+    {
+      // Remove the last connection from the pool to insert this one.
+      auto lastConnection = --hostPool.Connections.end();
+      connectionToBeRemoved = std::move(*lastConnection);
+      hostPool.Connections.erase(lastConnection);
+    }
 
-  if (m_cleanThread.joinable() && !IsCleanThreadRunning)
-  {
-    // Clean thread was running before but it's finished, join it to finalize
-    m_cleanThread.join();
+    // update the time when connection was moved back to pool
+    connection->UpdateLastUsageTime();
+    hostPool.Connections.push_front(std::move(connection));
   }
+}
 
-  // Cleanup will start a background thread which will close abandoned connections from the pool.
-  // This will free-up resources from the app
-  // This is the only call to cleanup.
-  if (!m_cleanThread.joinable())
-  {
-    Log::Write(Logger::Level::Verbose, "Start clean thread");
-    IsCleanThreadRunning = true;
-    m_cleanThread = std::thread(CleanupThread);
-  }
-  else
+size_t CurlConnectionPool::GetMinIdleConnections(std::string const& connectionKey)
+{
+  auto& shard = GetShard(connectionKey);
+  std::lock_guard<std::mutex> lock(shard.Mutex);
+  auto const minIdleHost = shard.MinIdleHosts.find(connectionKey);
+  return minIdleHost == shard.MinIdleHosts.end() ? 0 : minIdleHost->second.MinIdleConnections;
+}
+
+void CurlConnectionPool::SetMinIdleConnections(
+    std::string const& connectionKey,
+    size_t minIdleConnections,
+    size_t maxIdleConnections,
+    std::function<std::unique_ptr<CurlNetworkConnection>()> openConnection)
+{
+  auto& shard = GetShard(connectionKey);
+  std::lock_guard<std::mutex> lock(shard.Mutex);
+  auto& minIdleHost = shard.MinIdleHosts[connectionKey];
+  // Transports which share the host may have different minimums, keep the largest one.
+  if (minIdleConnections > minIdleHost.MinIdleConnections)
   {
-    Log::Write(Logger::Level::Verbose, "Clean thread running. Won't start a new one.");
+    minIdleHost.MinIdleConnections = minIdleConnections;
+    minIdleHost.MaxIdleConnections = maxIdleConnections;
+    minIdleHost.OpenConnection = std::move(openConnection);
   }
 }
 
-CurlConnection::CurlConnection(
+void CurlConnectionPool::PrewarmConnections(
     Request& request,
     CurlTransportOptions const& options,
-    std::string const& hostDisplayName,
-    std::string const& connectionPropertiesKey)
-    : m_connectionKey(connectionPropertiesKey)
+    size_t connectionCount)
 {
-  m_handle = Azure::Core::_internal::UniqueHandle<CURL>(curl_easy_init());
-  if (!m_handle)
-  {
-    throw Azure::Core::Http::TransportException(
-        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-        + std::string("curl_easy_init returned Null"));
-  }
-  CURLcode result;
+  // Each connection blocks a thread during the TCP and TLS handshakes, so cap the threads.
+  constexpr size_t MaxPrewarmThreads = 16;
 
-  if (options.EnableCurlTracing)
-  {
-    if (!SetLibcurlOption(
-            m_handle, CURLOPT_DEBUGFUNCTION, CurlConnection::CurlLoggingCallback, &result))
-    {
-      throw TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate
-          + std::string(". Could not enable logging callback.")
-          + std::string(curl_easy_strerror(result)));
-    }
-    if (!SetLibcurlOption(m_handle, CURLOPT_VERBOSE, 1, &result))
+  std::string const hostDisplayName = GetHostDisplayName(request.GetUrl());
+  std::string const connectionKey
+      = GetConnectionKey(hostDisplayName, GetConnectionKeySuffix(options));
+  KeepMinIdleConnections(*this, request, options, hostDisplayName, connectionKey);
+  Log::Write(
+      Logger::Level::Verbose,
+      LogMsgPrefix + "Opening " + std::to_string(connectionCount) + " connections to "
+          + hostDisplayName + ".");
+
+  std::atomic<size_t> nextConnection(0);
+  std::atomic<bool> failed(false);
+  std::mutex errorMutex;
+  std::exception_ptr error;
+  auto openConnections = [&]() {
+    while (!failed && nextConnection.fetch_add(1) < connectionCount)
     {
-      throw TransportException(
-          _detail::DefaultFailedToGetNewConnectionTemplate
-          + std::string(". Could not enable verbose logging.")
-          + std::string(curl_easy_strerror(result)));
+      try
+      {
+        // Always open a new connection, instead of getting one from the pool.
+        MoveConnectionBackToPool(
+            std::make_unique<CurlConnection>(request, options, hostDisplayName, connectionKey),
+            true,
+            options.MaxIdleConnectionsPerHost);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> guard(errorMutex);
+        if (!failed.exchange(true))
+        {
+          error = std::current_exception();
+        }
+      }
     }
-  }
+  };
 
-  // Libcurl setup before open connection (url, connect_only, timeout)
-  if (!SetLibcurlOption(m_handle, CURLOPT_URL, request.GetUrl().GetAbsoluteUrl().data(), &result))
+  std::vector<std::thread> threads;
+  auto const threadCount = (std::min)(connectionCount, MaxPrewarmThreads);
+  for (size_t i = 1; i < threadCount; ++i)
   {
-    throw Azure::Core::Http::TransportException(
-        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
-        + std::string(curl_easy_strerror(result)));
+    threads.emplace_back(openConnections);
+  }
+  openConnections();
+  for (auto& thread : threads)
+  {
+    thread.join();
   }
 
-  if (request.GetUrl().GetPort() != 0
-      && !SetLibcurlOption(m_handle, CURLOPT_PORT, request.GetUrl().GetPort(), &result))
+  if (error)
   {
-    throw Azure::Core::Http::TransportException(
+    std::rethrow_exception(error);
+  }
+}
+
+void CurlConnectionPool::Clear()
+{
+  for (auto& shard : m_shards)
+  {
+    decltype(shard.ConnectionPoolIndex) connectionsToBeRemoved;
+    decltype(shard.MinIdleHosts) minIdleHostsToBeRemoved;
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    connectionsToBeRemoved.swap(shard.ConnectionPoolIndex);
+    minIdleHostsToBeRemoved.swap(shard.MinIdleHosts);
+  }
+}
+
+size_t CurlConnectionPool::HostCount()
+{
+  size_t count = 0;
+  for (auto& shard : m_shards)
+  {
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    count += shard.ConnectionPoolIndex.size();
+  }
+  return count;
+}
+
+size_t CurlConnectionPool::ConnectionsOnPool(std::string const& connectionKey)
+{
+  auto& shard = GetShard(connectionKey);
+  std::lock_guard<std::mutex> lock(shard.Mutex);
+  auto hostPoolIndex = shard.ConnectionPoolIndex.find(connectionKey);
+  return hostPoolIndex == shard.ConnectionPoolIndex.end()
+      ? 0
+      : hostPoolIndex->second.Connections.size();
+}
+
+void CurlConnectionPool::StartCleanThread()
+{
+  std::lock_guard<std::mutex> lock(m_cleanThreadMutex);
+  if (IsCleanThreadRunning)
+  {
+    Log::Write(Logger::Level::Verbose, "Clean thread running. Won't start a new one.");
+    return;
+  }
+  if (m_cleanThread.joinable())
+  {
+    // Clean thread was running before but it's finished, join it to finalize
+    m_cleanThread.join();
+  }
+  Log::Write(Logger::Level::Verbose, "Start clean thread");
+  IsCleanThreadRunning = true;
+  m_cleanThread = std::thread([this]() { CleanThread(); });
+}
+
+void CurlConnectionPool::CloseExpiredConnections()
+{
+  struct Replacement final
+  {
+    std::function<std::unique_ptr<CurlNetworkConnection>()> OpenConnection;
+    size_t MaxIdleConnections;
+    size_t Count;
+  };
+  std::vector<Replacement> replacements;
+
+  for (auto& shard : m_shards)
+  {
+    decltype(HostConnections::Connections) connectionsToBeCleaned;
+    std::unique_lock<std::mutex> lockForPoolCleaning(shard.Mutex);
+
+    // Notes: The size of each host-index is always expected to be greater than 0 because the
+    // host-index is removed anytime it becomes empty.
+    for (auto index = shard.ConnectionPoolIndex.begin(); index != shard.ConnectionPoolIndex.end();)
+    {
+      // Each pool index behaves as a Last-in-First-out (connections are added to the pool with
+      // push_front). The last connection moved to the pool will be the first to be re-used.
+      // Because of this, the oldest connection in the pool can be found at the end of the list.
+      // Looping the connection pool backwards until a connection that is not expired is found or
+      // until all connections are removed.
+      auto& connectionList = index->second.Connections;
+      size_t expiredCount = 0;
+      while (!connectionList.empty() && connectionList.back()->IsExpired())
+      {
+        connectionsToBeCleaned.emplace_back(std::move(connectionList.back()));
+        connectionList.pop_back();
+        ++expiredCount;
+      }
+
+      // The server has probably closed the expired connections, so the ones needed to keep the
+      // minimum are replaced by new connections rather than kept.
+      auto const minIdleHost = shard.MinIdleHosts.find(index->first);
+      if (expiredCount > 0 && minIdleHost != shard.MinIdleHosts.end()
+          && connectionList.size() < minIdleHost->second.MinIdleConnections)
+      {
+        replacements.push_back(
+            {minIdleHost->second.OpenConnection,
+             minIdleHost->second.MaxIdleConnections,
+             (std::min)(
+                 expiredCount,
+                 minIdleHost->second.MinIdleConnections - connectionList.size())});
+      }
+
+      if (connectionList.empty())
+      {
+        index = shard.ConnectionPoolIndex.erase(index);
+      }
+      else
+      {
+        ++index;
+      }
+    }
+
+    lockForPoolCleaning.unlock();
+    // Do actual connections release work here, without holding the mutex.
+  }
+
+  for (auto const& replacement : replacements)
+  {
+    for (size_t i = 0; i < replacement.Count; ++i)
+    {
+      try
+      {
+        AddConnectionToPool(replacement.OpenConnection(), replacement.MaxIdleConnections);
+      }
+      catch (...)
+      {
+        // The host can't be reached right now. New connections are opened by the next requests.
+        break;
+      }
+    }
+  }
+}
+
+void CurlConnectionPool::CleanThread()
+{
+  // NOTE: Avoid using Log::Write in here as it may fail on macOS,
+  // see issue: https://github.com/Azure/azure-sdk-for-cpp/issues/3224
+  // This method can wake up in de-attached mode after the application has been terminated.
+  // If that happens, trying to use `Log` would cause `abort` as it was previously deallocated.
+  std::unique_lock<std::mutex> cleanThreadLock(m_cleanThreadMutex);
+  for (;;)
+  {
+    // Wait for the default time OR to the signal from the conditional variable.
+    // wait_for releases the mutex lock when it goes to sleep and it takes the lock again when it
+    // wakes up (or it's cancelled).
+    if (ConditionalVariableForCleanThread.wait_for(
+            cleanThreadLock,
+            std::chrono::milliseconds(DefaultCleanerIntervalMilliseconds),
+            [this]() { return m_stopCleanThread; }))
+    {
+      // Cancelled by the pool destructor
+      IsCleanThreadRunning = false;
+      break;
+    }
+    cleanThreadLock.unlock();
+
+    CloseExpiredConnections();
+
+    cleanThreadLock.lock();
+    // A connection moved to the pool after its shard was checked starts a new clean thread once
+    // this one is no longer running.
+    if (HostCount() == 0 || m_stopCleanThread)
+    {
+      IsCleanThreadRunning = false;
+      break;
+    }
+  }
+}
+
+CurlConnection::CurlConnection(
+    Request& request,
+    CurlTransportOptions const& options,
+    std::string const& hostDisplayName,
+    std::string const& connectionPropertiesKey)
+    : m_connectionKey(connectionPropertiesKey)
+{
+  m_handle = Azure::Core::_internal::UniqueHandle<CURL>(curl_easy_init());
+  if (!m_handle)
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string("curl_easy_init returned Null"));
+  }
+  CURLcode result;
+
+  if (options.EnableCurlTracing)
+  {
+    if (!SetLibcurlOption(
+            m_handle, CURLOPT_DEBUGFUNCTION, CurlConnection::CurlLoggingCallback, &result))
+    {
+      throw TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate
+          + std::string(". Could not enable logging callback.")
+          + std::string(curl_easy_strerror(result)));
+    }
+    if (!SetLibcurlOption(m_handle, CURLOPT_VERBOSE, 1, &result))
+    {
+      throw TransportException(
+          _detail::DefaultFailedToGetNewConnectionTemplate
+          + std::string(". Could not enable verbose logging.")
+          + std::string(curl_easy_strerror(result)));
+    }
+  }
+
+  // Libcurl setup before open connection (url, connect_only, timeout)
+  if (!SetLibcurlOption(m_handle, CURLOPT_URL, request.GetUrl().GetAbsoluteUrl().data(), &result))
+  {
+    throw Azure::Core::Http::TransportException(
+        _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  if (request.GetUrl().GetPort() != 0
+      && !SetLibcurlOption(m_handle, CURLOPT_PORT, request.GetUrl().GetPort(), &result))
+  {
+    throw Azure::Core::Http::TransportException(
         _detail::DefaultFailedToGetNewConnectionTemplate + hostDisplayName + ". "
         + std::string(curl_easy_strerror(result)));
   }
@@ -2566,3 +2863,482 @@ CurlConnection::CurlConnection(
         + std::string(curl_easy_strerror(result)));
   }
 }
+
+#if defined(AZ_CURL_MULTI_REACTOR_SUPPORTED)
+using Azure::Core::Http::HttpMethod;
+using Azure::Core::Http::_detail::CurlMultiReactor;
+
+namespace {
+// The copy constructor of RequestFailedException doesn't preserve what(), so exceptions are thrown
+// in place instead of being copied by std::make_exception_ptr().
+template <typename ExceptionT> std::exception_ptr CaptureException(std::string const& message)
+{
+  try
+  {
+    throw ExceptionT(message);
+  }
+  catch (...)
+  {
+    return std::current_exception();
+  }
+}
+
+// Applies the transport options which can be honored by a transfer driven from the multi handle.
+// Unlike CurlConnection, the transfer is a full request (not CONNECT_ONLY), so libcurl takes care
+// of writing the request and parsing the response framing.
+void SetMultiTransferOptions(
+    Azure::Core::_internal::UniqueHandle<CURL> const& handle,
+    Request& request,
+    CurlTransportOptions const& options,
+    curl_slist* headers)
+{
+  CURLcode result;
+  auto const throwOnFailure = [&result](bool succeeded, char const* what) {
+    if (!succeeded)
+    {
+      throw TransportException(
+          std::string("Failed to prepare async transfer. ") + what + ". "
+          + std::string(curl_easy_strerror(result)));
+    }
+  };
+
+  throwOnFailure(
+      SetLibcurlOption(handle, CURLOPT_URL, request.GetUrl().GetAbsoluteUrl().c_str(), &result),
+      "Could not set URL");
+  // The reactor thread must never be interrupted by libcurl signal handlers.
+  throwOnFailure(SetLibcurlOption(handle, CURLOPT_NOSIGNAL, 1L, &result), "Could not set NOSIGNAL");
+  throwOnFailure(
+      SetLibcurlOption(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1, &result),
+      "Could not set HTTP/1.1");
+  throwOnFailure(
+      SetLibcurlOption(handle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1_2, &result),
+      "Could not enforce TLS v1.2 or greater");
+  throwOnFailure(SetLibcurlOption(handle, CURLOPT_HTTPHEADER, headers, &result), "Invalid headers");
+
+  if (options.ConnectionTimeout != Azure::Core::Http::_detail::DefaultConnectionTimeout)
+  {
+    throwOnFailure(
+        SetLibcurlOption(
+            handle,
+            CURLOPT_CONNECTTIMEOUT_MS,
+            static_cast<long>(options.ConnectionTimeout.count()),
+            &result),
+        "Could not set connect timeout");
+  }
+  if (options.Proxy)
+  {
+    throwOnFailure(
+        SetLibcurlOption(handle, CURLOPT_PROXY, options.Proxy->c_str(), &result),
+        "Could not set proxy");
+  }
+  if (options.ProxyUsername.HasValue())
+  {
+    throwOnFailure(
+        SetLibcurlOption(
+            handle, CURLOPT_PROXYUSERNAME, options.ProxyUsername.Value().c_str(), &result),
+        "Could not set proxy username");
+  }
+  if (options.ProxyPassword.HasValue())
+  {
+    throwOnFailure(
+        SetLibcurlOption(
+            handle, CURLOPT_PROXYPASSWORD, options.ProxyPassword.Value().c_str(), &result),
+        "Could not set proxy password");
+  }
+  if (!options.CAInfo.empty())
+  {
+    throwOnFailure(
+        SetLibcurlOption(handle, CURLOPT_CAINFO, options.CAInfo.c_str(), &result),
+        "Could not set CA cert file");
+  }
+  if (!options.CAPath.empty())
+  {
+    throwOnFailure(
+        SetLibcurlOption(handle, CURLOPT_CAPATH, options.CAPath.c_str(), &result),
+        "Could not set CA path");
+  }
+#if LIBCURL_VERSION_NUM >= 0x074D00 // 7.77.0
+  if (!options.SslOptions.PemEncodedExpectedRootCertificates.empty())
+  {
+    curl_blob rootCertBlob
+        = {const_cast<void*>(reinterpret_cast<const void*>(
+               options.SslOptions.PemEncodedExpectedRootCertificates.c_str())),
+           options.SslOptions.PemEncodedExpectedRootCertificates.size(),
+           CURL_BLOB_COPY};
+    throwOnFailure(
+        SetLibcurlOption(handle, CURLOPT_CAINFO_BLOB, &rootCertBlob, &result),
+        "Could not set CA cert");
+  }
+#endif
+#if defined(AZ_PLATFORM_WINDOWS)
+  throwOnFailure(
+      SetLibcurlOption(
+          handle,
+          CURLOPT_SSL_OPTIONS,
+          options.SslOptions.EnableCertificateRevocationListCheck ? 0L : CURLSSLOPT_NO_REVOKE,
+          &result),
+      "Could not set ssl options");
+#endif
+  if (!options.SslVerifyPeer)
+  {
+    throwOnFailure(
+        SetLibcurlOption(handle, CURLOPT_SSL_VERIFYPEER, 0L, &result),
+        "Could not disable ssl verify peer");
+  }
+
+  auto const method = request.GetMethod();
+  if (method == HttpMethod::Head)
+  {
+    throwOnFailure(SetLibcurlOption(handle, CURLOPT_NOBODY, 1L, &result), "Could not set HEAD");
+  }
+  else if (method != HttpMethod::Get)
+  {
+    throwOnFailure(
+        SetLibcurlOption(handle, CURLOPT_CUSTOMREQUEST, method.ToString().c_str(), &result),
+        "Could not set HTTP method");
+    auto const bodyLength = request.GetBodyStream()->Length();
+    if (method != HttpMethod::Delete || bodyLength > 0)
+    {
+      throwOnFailure(SetLibcurlOption(handle, CURLOPT_UPLOAD, 1L, &result), "Could not set upload");
+      throwOnFailure(
+          SetLibcurlOption(
+              handle, CURLOPT_INFILESIZE_LARGE, static_cast<curl_off_t>(bodyLength), &result),
+          "Could not set upload size");
+    }
+  }
+}
+} // namespace
+
+struct CurlMultiReactor::Transfer final
+{
+  Azure::Core::_internal::UniqueHandle<CURL> Handle;
+  curl_slist* Headers = nullptr;
+  Request* HttpRequest;
+  Context RequestContext;
+  std::promise<std::unique_ptr<RawResponse>> Promise;
+  std::unique_ptr<RawResponse> Response;
+  std::vector<uint8_t> Body;
+  // Exceptions can't be thrown through libcurl, callbacks park them here instead.
+  std::exception_ptr CallbackError;
+
+  Transfer(Request& request, Context const& context)
+      : Handle(curl_easy_init()), HttpRequest(&request), RequestContext(context)
+  {
+  }
+
+  ~Transfer() { curl_slist_free_all(Headers); }
+
+  static size_t OnHeader(char* buffer, size_t size, size_t count, void* userData)
+  {
+    auto transfer = static_cast<Transfer*>(userData);
+    auto const length = size * count;
+    try
+    {
+      auto first = reinterpret_cast<uint8_t const*>(buffer);
+      auto last = first + length;
+      while (last != first && (*(last - 1) == '\r' || *(last - 1) == '\n'))
+      {
+        --last;
+      }
+
+      if (length > 5 && std::equal(buffer, buffer + 5, "HTTP/"))
+      {
+        // Interim responses (100-continue) are followed by another status line, the last one wins.
+        transfer->Response = CreateHTTPResponse(first, last);
+        transfer->Body.clear();
+      }
+      else if (first == last)
+      {
+        // End of headers. Use the content length, when present, to allocate the body once.
+        if (transfer->Response)
+        {
+          auto const& headers = transfer->Response->GetHeaders();
+          auto contentLength = headers.find("content-length");
+          if (contentLength != headers.end())
+          {
+            transfer->Body.reserve(static_cast<size_t>(std::stoull(contentLength->second)));
+          }
+        }
+      }
+      else if (transfer->Response)
+      {
+        Azure::Core::Http::_detail::RawResponseHelpers::SetHeader(
+            *transfer->Response, first, last);
+      }
+    }
+    catch (...)
+    {
+      transfer->CallbackError = std::current_exception();
+      return 0;
+    }
+    return length;
+  }
+
+  static size_t OnWrite(char* buffer, size_t size, size_t count, void* userData)
+  {
+    auto transfer = static_cast<Transfer*>(userData);
+    auto const length = size * count;
+    try
+    {
+      transfer->Body.insert(transfer->Body.end(), buffer, buffer + length);
+    }
+    catch (...)
+    {
+      transfer->CallbackError = std::current_exception();
+      return 0;
+    }
+    return length;
+  }
+
+  static size_t OnRead(char* buffer, size_t size, size_t count, void* userData)
+  {
+    auto transfer = static_cast<Transfer*>(userData);
+    try
+    {
+      return transfer->HttpRequest->GetBodyStream()->Read(
+          reinterpret_cast<uint8_t*>(buffer), size * count, transfer->RequestContext);
+    }
+    catch (...)
+    {
+      transfer->CallbackError = std::current_exception();
+      return CURL_READFUNC_ABORT;
+    }
+  }
+};
+
+CurlMultiReactor::CurlMultiReactor()
+    : m_multiHandle(curl_multi_init()), m_lastCancellationCheck(std::chrono::steady_clock::now())
+{
+  if (m_multiHandle == nullptr)
+  {
+    throw TransportException("Failed to create the libcurl multi handle. curl_multi_init failed.");
+  }
+  m_reactorThread = std::thread([this]() { Run(); });
+}
+
+CurlMultiReactor::~CurlMultiReactor()
+{
+  // NOTE: Avoid using Log::Write in here, see CleanupThread.
+  m_stopRequested = true;
+  curl_multi_wakeup(m_multiHandle);
+  if (m_reactorThread.joinable())
+  {
+    m_reactorThread.join();
+  }
+  curl_multi_cleanup(m_multiHandle);
+}
+
+CurlMultiReactor& CurlMultiReactor::GetInstance()
+{
+  // Since C++11, the initialization of a static local variable happens exactly once, even when
+  // several threads get here concurrently.
+  static CurlMultiReactor reactor;
+  return reactor;
+}
+
+std::future<std::unique_ptr<RawResponse>> CurlMultiReactor::Enqueue(
+    Request& request,
+    CurlTransportOptions const& options,
+    Context const& context)
+{
+  // The body may have been read by an earlier attempt.
+  request.GetBodyStream()->Rewind();
+
+  auto transfer = std::make_unique<Transfer>(request, context);
+  if (!transfer->Handle)
+  {
+    throw TransportException("Failed to prepare async transfer. curl_easy_init returned Null");
+  }
+
+  std::string line;
+  RequestHeaders::ForEach(
+      request, [&transfer, &line](std::string const& name, std::string const& value) {
+        line.assign(name).append(": ").append(value);
+        auto headers = curl_slist_append(transfer->Headers, line.c_str());
+        if (headers == nullptr)
+        {
+          throw TransportException("Failed to prepare async transfer. Could not add header.");
+        }
+        transfer->Headers = headers;
+      });
+  SetMultiTransferOptions(transfer->Handle, request, options, transfer->Headers);
+
+  CURLcode result;
+  if (options.EnableCurlTracing
+      && (!SetLibcurlOption(
+              transfer->Handle, CURLOPT_DEBUGFUNCTION, CurlConnection::CurlLoggingCallback, &result)
+          || !SetLibcurlOption(transfer->Handle, CURLOPT_VERBOSE, 1L, &result)))
+  {
+    throw TransportException(
+        "Failed to prepare async transfer. Could not enable logging. "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  auto const transferPointer = transfer.get();
+  if (!SetLibcurlOption(transfer->Handle, CURLOPT_HEADERFUNCTION, Transfer::OnHeader, &result)
+      || !SetLibcurlOption(transfer->Handle, CURLOPT_HEADERDATA, transferPointer, &result)
+      || !SetLibcurlOption(transfer->Handle, CURLOPT_WRITEFUNCTION, Transfer::OnWrite, &result)
+      || !SetLibcurlOption(transfer->Handle, CURLOPT_WRITEDATA, transferPointer, &result)
+      || !SetLibcurlOption(transfer->Handle, CURLOPT_READFUNCTION, Transfer::OnRead, &result)
+      || !SetLibcurlOption(transfer->Handle, CURLOPT_READDATA, transferPointer, &result))
+  {
+    throw TransportException(
+        "Failed to prepare async transfer. Could not set callbacks. "
+        + std::string(curl_easy_strerror(result)));
+  }
+
+  auto future = transfer->Promise.get_future();
+  {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    m_queuedTransfers.emplace_back(std::move(transfer));
+  }
+  ++m_pendingTransfers;
+  curl_multi_wakeup(m_multiHandle);
+  return future;
+}
+
+void CurlMultiReactor::Run()
+{
+  while (!m_stopRequested)
+  {
+    StartQueuedTransfers();
+
+    int runningHandles = 0;
+    curl_multi_perform(m_multiHandle, &runningHandles);
+
+    int messagesInQueue = 0;
+    while (CURLMsg* message = curl_multi_info_read(m_multiHandle, &messagesInQueue))
+    {
+      if (message->msg == CURLMSG_DONE)
+      {
+        CompleteTransfer(message->easy_handle, message->data.result);
+      }
+    }
+
+    auto const now = std::chrono::steady_clock::now();
+    if (now - m_lastCancellationCheck
+        >= std::chrono::milliseconds(DefaultMultiReactorPollIntervalMilliseconds))
+    {
+      CancelTransfers(false);
+      m_lastCancellationCheck = now;
+    }
+
+    // Sleeps until a socket is ready, curl needs to run a timeout, or curl_multi_wakeup() is
+    // called for a new transfer or shutdown.
+    curl_multi_poll(
+        m_multiHandle, nullptr, 0, DefaultMultiReactorPollIntervalMilliseconds, nullptr);
+  }
+
+  StartQueuedTransfers();
+  CancelTransfers(true);
+}
+
+void CurlMultiReactor::StartQueuedTransfers()
+{
+  std::vector<std::unique_ptr<Transfer>> queuedTransfers;
+  {
+    std::lock_guard<std::mutex> lock(m_queueMutex);
+    queuedTransfers.swap(m_queuedTransfers);
+  }
+
+  for (auto& transfer : queuedTransfers)
+  {
+    auto const handle = transfer->Handle.get();
+    auto const result = curl_multi_add_handle(m_multiHandle, handle);
+    if (result != CURLM_OK)
+    {
+      transfer->Promise.set_exception(CaptureException<TransportException>(
+          "Error while sending request. " + std::string(curl_multi_strerror(result))));
+      --m_pendingTransfers;
+      continue;
+    }
+    m_activeTransfers.emplace(handle, std::move(transfer));
+  }
+}
+
+void CurlMultiReactor::CompleteTransfer(CURL* handle, CURLcode result)
+{
+  auto transferIterator = m_activeTransfers.find(handle);
+  if (transferIterator == m_activeTransfers.end())
+  {
+    return;
+  }
+  auto transfer = std::move(transferIterator->second);
+  m_activeTransfers.erase(transferIterator);
+  curl_multi_remove_handle(m_multiHandle, handle);
+
+  if (transfer->CallbackError)
+  {
+    transfer->Promise.set_exception(transfer->CallbackError);
+  }
+  else if (result != CURLE_OK)
+  {
+    transfer->Promise.set_exception(CaptureException<TransportException>(
+        "Error while sending request. " + std::string(curl_easy_strerror(result))));
+  }
+  else if (!transfer->Response)
+  {
+    transfer->Promise.set_exception(CaptureException<TransportException>(
+        "Error while sending request. No HTTP status line was received."));
+  }
+  else
+  {
+    transfer->Response->SetBody(std::move(transfer->Body));
+    transfer->Promise.set_value(std::move(transfer->Response));
+  }
+  --m_pendingTransfers;
+}
+
+void CurlMultiReactor::CancelTransfers(bool shuttingDown)
+{
+  for (auto transferIterator = m_activeTransfers.begin();
+       transferIterator != m_activeTransfers.end();)
+  {
+    auto& transfer = transferIterator->second;
+    if (!shuttingDown && !transfer->RequestContext.IsCancelled())
+    {
+      ++transferIterator;
+      continue;
+    }
+
+    curl_multi_remove_handle(m_multiHandle, transferIterator->first);
+    if (shuttingDown)
+    {
+      transfer->Promise.set_exception(CaptureException<TransportException>(
+          "Error while sending request. The transport is shutting down."));
+    }
+    else
+    {
+      transfer->Promise.set_exception(CaptureException<Azure::Core::OperationCancelledException>(
+          "Request was cancelled by context."));
+    }
+    transferIterator = m_activeTransfers.erase(transferIterator);
+    --m_pendingTransfers;
+  }
+}
+#endif // AZ_CURL_MULTI_REACTOR_SUPPORTED
+
+std::future<std::unique_ptr<RawResponse>> CurlTransport::SendAsync(
+    Request& request,
+    Context const& context)
+{
+  // Before doing any work, check to make sure that the context hasn't already been cancelled.
+  context.ThrowIfCancelled();
+
+#if defined(AZ_CURL_MULTI_REACTOR_SUPPORTED)
+  // The reactor downloads the whole body, so a response returned as a stream needs the
+  // CurlSession of #Send to read from.
+  bool useReactor = request.ShouldBufferResponse();
+#if !defined(AZ_PLATFORM_WINDOWS) && !defined(AZ_PLATFORM_MAC)
+  // CRL validation hooks into the SSL context of a CurlConnection, which a multi transfer doesn't
+  // have.
+  useReactor = useReactor && !m_options.SslOptions.EnableCertificateRevocationListCheck;
+#endif
+  if (useReactor)
+  {
+    Log::Write(Logger::Level::Verbose, LogMsgPrefix + "Queueing async transfer.");
+    return CurlMultiReactor::GetInstance().Enqueue(request, m_options, context);
+  }
+#endif
+  return HttpTransport::SendAsync(request, context);
+}
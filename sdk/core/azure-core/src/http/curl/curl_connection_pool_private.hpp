@@ -15,8 +15,10 @@
 
 #include <azure/core/http/curl_transport.hpp>
 
+#include <array>
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -40,7 +42,8 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
    * more than one request. Use this component when connections are not re-used by default.
    *
    * This pool offers static methods and it is allocated statically. There can be only one
-   * connection pool per application.
+   * connection pool per application. The hosts are spread over a fixed number of shards, each with
+   * its own lock, so that concurrent requests to different hosts don't contend.
    */
   class CurlConnectionPool final {
 #if defined(_azure_TESTING_BUILD)
@@ -58,15 +61,16 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
       if (m_cleanThread.joinable())
       {
         {
-          std::unique_lock<std::mutex> lock(ConnectionPoolMutex);
-          // Remove all connections
-          g_curlConnectionPool.ConnectionPoolIndex.clear();
+          std::unique_lock<std::mutex> lock(m_cleanThreadMutex);
+          m_stopCleanThread = true;
         }
         // Signal clean thread to wake up
         ConditionalVariableForCleanThread.notify_one();
         // join thread
         m_cleanThread.join();
       }
+      // Remove all connections
+      Clear();
       curl_global_cleanup();
     }
 
@@ -85,6 +89,30 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
     std::unique_ptr<CurlNetworkConnection> ExtractOrCreateCurlConnection(
         Request& request,
         CurlTransportOptions const& options,
+        bool resetPool = false)
+    {
+      return ExtractOrCreateCurlConnection(
+          request, options, GetConnectionKeySuffix(options), resetPool);
+    }
+
+    /**
+     * @brief Finds a connection to be re-used from the connection pool.
+     * @remark If there is not any available connection, a new connection is created.
+     *
+     * @param request HTTP request to get #Azure::Core::Http::CurlNetworkConnection for.
+     * @param options The connection settings which includes host name and libcurl handle specific
+     * configuration.
+     * @param connectionKeySuffix The part of the connection key which depends on \p options, as
+     * returned by #GetConnectionKeySuffix.
+     * @param resetPool Request the pool to remove all current connections for the provided
+     * options to force the creation of a new connection.
+     *
+     * @return #Azure::Core::Http::CurlNetworkConnection to use.
+     */
+    std::unique_ptr<CurlNetworkConnection> ExtractOrCreateCurlConnection(
+        Request& request,
+        CurlTransportOptions const& options,
+        std::string const& connectionKeySuffix,
         bool resetPool = false);
 
     /**
@@ -93,23 +121,87 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
      * @param connection CURL HTTP connection to add to the pool.
      * @param httpKeepAlive The status of keep-alive behavior, based on HTTP protocol version and
      * the most recent response header received through the \p connection.
+     * @param maxIdleConnections The maximum number of connections kept in the pool for the host
+     * of the \p connection. The oldest connection is closed to make room for this one.
      */
     void MoveConnectionBackToPool(
         std::unique_ptr<CurlNetworkConnection> connection,
-        bool httpKeepAlive);
+        bool httpKeepAlive,
+        size_t maxIdleConnections = MaxConnectionsPerIndex);
+
+    /**
+     * @brief Gets the number of idle connections kept in the pool for a connection key.
+     *
+     */
+    size_t GetMinIdleConnections(std::string const& connectionKey);
+
+    /**
+     * @brief Keeps a number of idle connections in the pool for a connection key.
+     *
+     * @details Expired connections are closed like any other, and the ones needed to keep
+     * \p minIdleConnections in the pool are replaced by new connections, so that the connections
+     * kept idle are never ones which the server has probably closed. When several transports set
+     * a minimum for the same connection key, the largest one is kept.
+     *
+     * @param connectionKey The connection key of the host.
+     * @param minIdleConnections The number of idle connections to keep in the pool.
+     * @param maxIdleConnections The maximum number of connections kept in the pool for the host.
+     * @param openConnection Opens a new connection for the host. It's called by the clean thread.
+     */
+    void SetMinIdleConnections(
+        std::string const& connectionKey,
+        size_t minIdleConnections,
+        size_t maxIdleConnections,
+        std::function<std::unique_ptr<CurlNetworkConnection>()> openConnection);
+
+    /**
+     * @brief Closes the expired connections in the pool, and replaces the ones needed to keep the
+     * minimum number of idle connections of their host.
+     *
+     * @remark The clean thread calls this periodically.
+     */
+    void CloseExpiredConnections();
+
+    /**
+     * @brief Opens connections to the host of a request and adds them to the pool.
+     *
+     * @details Connections are opened in parallel. Each one is added to the pool as soon as it is
+     * open, so that it can be used before all the connections are ready.
+     *
+     * @param request HTTP request for the host to connect to.
+     * @param options The connection settings.
+     * @param connectionCount The number of connections to open.
+     */
+    void PrewarmConnections(
+        Request& request,
+        CurlTransportOptions const& options,
+        size_t connectionCount);
 
     /**
-     * @brief Keeps a unique key for each host and creates a connection pool for each key.
+     * @brief Calculates the part of the connection key which depends on the transport options.
      *
-     * @details This way getting a connection for a specific host can be done in O(1) instead of
-     * looping a single connection list to find the first connection for the required host.
+     * @details The connection key is the host followed by this suffix. Callers which reuse the
+     * same options can calculate it once.
+     */
+    static std::string GetConnectionKeySuffix(CurlTransportOptions const& options);
+
+    /**
+     * @brief Removes all the connections from the pool.
+     *
+     */
+    void Clear();
+
+    /**
+     * @brief Gets the number of hosts (connection keys) with connections in the pool.
      *
-     * @remark There might be multiple connections for each host.
      */
-    std::unordered_map<std::string, std::list<std::unique_ptr<CurlNetworkConnection>>>
-        ConnectionPoolIndex;
+    size_t HostCount();
 
-    std::mutex ConnectionPoolMutex;
+    /**
+     * @brief Gets the number of connections in the pool for a connection key.
+     *
+     */
+    size_t ConnectionsOnPool(std::string const& connectionKey);
 
     // This is used to put the cleaning pool thread to sleep and yet to be able to wake it if the
     // application finishes.
@@ -120,13 +212,70 @@ namespace Azure { namespace Core { namespace Http { namespace _detail {
     bool IsCleanThreadRunning = false;
 
   private:
+    /**
+     * @brief The connections in the pool for one connection key.
+     *
+     * @details Connections are added to the front of the list (LIFO), so the oldest connection
+     * is at the end.
+     */
+    struct HostConnections final
+    {
+      std::list<std::unique_ptr<CurlNetworkConnection>> Connections;
+    };
+
+    /**
+     * @brief The number of idle connections to keep for a connection key, and how to open them.
+     */
+    struct MinIdleHost final
+    {
+      size_t MinIdleConnections = 0;
+      size_t MaxIdleConnections = 0;
+      std::function<std::unique_ptr<CurlNetworkConnection>()> OpenConnection;
+    };
+
+    /**
+     * @brief A subset of the hosts in the pool, with its own lock.
+     *
+     * @details Keeps a unique key for each host and creates a connection list for each key. This
+     * way getting a connection for a specific host can be done in O(1), and requests to hosts in
+     * different shards don't contend for the same lock.
+     */
+    struct Shard final
+    {
+      std::mutex Mutex;
+      std::unordered_map<std::string, HostConnections> ConnectionPoolIndex;
+      // Only the connection keys with a minimum number of idle connections are in this map.
+      std::unordered_map<std::string, MinIdleHost> MinIdleHosts;
+    };
+
+    static constexpr size_t ShardCount = 16;
+
     // private constructor to keep this as singleton.
     CurlConnectionPool() { curl_global_init(CURL_GLOBAL_ALL); }
 
-    // Makes possible to know the number of current connections in the connection pool for an
-    // index
-    size_t ConnectionsOnPool(std::string const& host) { return ConnectionPoolIndex[host].size(); }
+    Shard& GetShard(std::string const& connectionKey)
+    {
+      return m_shards[std::hash<std::string>{}(connectionKey) % ShardCount];
+    }
+
+    // Adds a connection to the front of the pool for its host, and closes the oldest one if the
+    // host has maxIdleConnections already.
+    void AddConnectionToPool(
+        std::unique_ptr<CurlNetworkConnection> connection,
+        size_t maxIdleConnections);
+
+    // Starts the clean thread unless it's already running.
+    void StartCleanThread();
+
+    // Closes the expired connections every DefaultCleanerIntervalMilliseconds, until the pool is
+    // empty or the pool is destroyed.
+    void CleanThread();
+
+    std::array<Shard, ShardCount> m_shards;
 
+    // Guards the clean thread state: m_cleanThread, IsCleanThreadRunning and m_stopCleanThread.
+    std::mutex m_cleanThreadMutex;
+    bool m_stopCleanThread = false;
     std::thread m_cleanThread;
   };
 
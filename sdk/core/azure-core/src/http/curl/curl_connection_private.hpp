@@ -13,6 +13,7 @@
 #include "azure/core/internal/unique_handle.hpp"
 
 #include <chrono>
+#include <memory>
 #include <string>
 
 #if defined(_MSC_VER)
@@ -46,10 +47,11 @@ namespace Azure { namespace Core {
 
   namespace Http {
     namespace _detail {
+      class CurlMultiReactor;
+
       // libcurl CURL_MAX_WRITE_SIZE is 64k. Using same value for default uploading chunk size.
       // This can be customizable in the HttpRequest
       constexpr static size_t DefaultUploadChunkSize = 1024 * 64;
-      constexpr static size_t DefaultLibcurlReaderSize = 4 * 1024;
       // Run time error template
       constexpr static const char* DefaultFailedToGetNewConnectionTemplate
           = "Fail to get a new connection for: ";
@@ -78,6 +80,8 @@ namespace Azure { namespace Core {
     class CurlNetworkConnection {
     private:
       bool m_isShutDown = false;
+      std::unique_ptr<uint8_t[]> m_receiveBuffer;
+      size_t m_receiveBufferSize = 0;
 
     public:
       /**
@@ -112,6 +116,45 @@ namespace Azure { namespace Core {
        */
       virtual size_t ReadFromSocket(uint8_t* buffer, size_t bufferSize, Context const& context) = 0;
 
+      /**
+       * @brief Copy the data which has already been received by the socket, without waiting for
+       * more.
+       *
+       * @return The number of bytes copied, or 0 if no data is available.
+       */
+      virtual size_t ReadAvailableFromSocket(uint8_t* buffer, size_t bufferSize)
+      {
+        (void)buffer;
+        (void)bufferSize;
+        return 0;
+      }
+
+      /**
+       * @brief Take the receive buffer kept by the connection, or allocate a new one if there is
+       * none of the requested size.
+       *
+       */
+      std::unique_ptr<uint8_t[]> TakeReceiveBuffer(size_t bufferSize)
+      {
+        if (m_receiveBuffer && m_receiveBufferSize == bufferSize)
+        {
+          m_receiveBufferSize = 0;
+          return std::move(m_receiveBuffer);
+        }
+        return std::unique_ptr<uint8_t[]>(new uint8_t[bufferSize]);
+      }
+
+      /**
+       * @brief Keep a receive buffer with the connection, so the next session using the
+       * connection doesn't need to allocate one.
+       *
+       */
+      void ReturnReceiveBuffer(std::unique_ptr<uint8_t[]> buffer, size_t bufferSize)
+      {
+        m_receiveBuffer = std::move(buffer);
+        m_receiveBufferSize = bufferSize;
+      }
+
       /**
        * @brief This method will use libcurl socket to write all the bytes from buffer.
        *
@@ -150,6 +193,9 @@ namespace Azure { namespace Core {
       // Allow the connection to proceed if retrieving the CRL failed.
       bool m_allowFailedCrlRetrieval{true};
 
+      // The multi reactor reuses the libcurl tracing callback for its transfers.
+      friend class _detail::CurlMultiReactor;
+
       static int CurlLoggingCallback(
           CURL* handle,
           curl_infotype type,
@@ -218,6 +264,17 @@ namespace Azure { namespace Core {
        */
       size_t ReadFromSocket(uint8_t* buffer, size_t bufferSize, Context const& context) override;
 
+      /**
+       * @brief Copy the data which has already been received by the socket, without waiting for
+       * more.
+       *
+       * @param buffer ptr to buffer where to copy bytes from socket.
+       * @param bufferSize size of the buffer.
+       * @return The number of bytes copied, or 0 if no data is available or the connection was
+       * closed.
+       */
+      size_t ReadAvailableFromSocket(uint8_t* buffer, size_t bufferSize) override;
+
       /**
        * @brief This method will use libcurl socket to write all the bytes from buffer.
        *
@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief The curl multi reactor drives many concurrent transfers from one background thread using
+ * a single libcurl multi handle.
+ */
+
+#pragma once
+
+#include "azure/core/http/http.hpp"
+#include "curl_connection_private.hpp"
+
+#include <azure/core/http/curl_transport.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// curl_multi_poll() and curl_multi_wakeup() are required by the reactor.
+#if LIBCURL_VERSION_NUM >= 0x074400 // 7.68.0
+#define AZ_CURL_MULTI_REACTOR_SUPPORTED
+#endif
+
+namespace Azure { namespace Core { namespace Http { namespace _detail {
+
+  // Upper bound for how long the reactor thread sleeps in curl_multi_poll() before it checks the
+  // pending transfers for cancellation.
+  constexpr static int32_t DefaultMultiReactorPollIntervalMilliseconds = 100;
+
+  /**
+   * @brief A single background thread which owns a libcurl multi handle and completes HTTP
+   * transfers as their sockets become ready.
+   *
+   * @details Transfers are queued from any thread with #Enqueue and are picked up by the reactor on
+   * its next wake up. Connections are cached by the multi handle itself, so they are not shared
+   * with #Azure::Core::Http::_detail::CurlConnectionPool.
+   *
+   * There is one reactor per application; it is started on first use.
+   */
+  class CurlMultiReactor final {
+  public:
+    ~CurlMultiReactor();
+
+    /**
+     * @brief Gets the application wide reactor, starting its thread on first use.
+     */
+    static CurlMultiReactor& GetInstance();
+
+    /**
+     * @brief Queues \p request to be sent by the reactor thread.
+     *
+     * @remark The body stream of \p request is rewound before the transfer is queued.
+     *
+     * @param request HTTP request to send. It must outlive the returned future.
+     * @param options The libcurl settings to apply to the transfer.
+     * @param context A context to control the request lifetime.
+     *
+     * @return A future which is satisfied with a fully downloaded response.
+     */
+    std::future<std::unique_ptr<RawResponse>> Enqueue(
+        Request& request,
+        CurlTransportOptions const& options,
+        Context const& context);
+
+    /**
+     * @brief Number of transfers which have been queued and are not completed yet.
+     */
+    size_t PendingTransfers() const { return m_pendingTransfers.load(); }
+
+  private:
+    struct Transfer;
+
+    CurlMultiReactor();
+
+    void Run();
+    void StartQueuedTransfers();
+    void CompleteTransfer(CURL* handle, CURLcode result);
+    void CancelTransfers(bool shuttingDown);
+
+    CURLM* m_multiHandle;
+    std::thread m_reactorThread;
+    std::atomic<bool> m_stopRequested{false};
+    std::atomic<size_t> m_pendingTransfers{0};
+
+    // Transfers are handed over to the reactor thread through this queue.
+    std::mutex m_queueMutex;
+    std::vector<std::unique_ptr<Transfer>> m_queuedTransfers;
+
+    // Only accessed from the reactor thread.
+    std::unordered_map<CURL*, std::unique_ptr<Transfer>> m_activeTransfers;
+    std::chrono::steady_clock::time_point m_lastCancellationCheck;
+  };
+
+}}}} // namespace Azure::Core::Http::_detail
@@ -243,7 +243,7 @@ namespace Azure { namespace Core { namespace Http {
      * @note The initial value is set to the size of the inner buffer as a sentinel that indicate
      * that the buffer has not data or all data has already taken from it.
      */
-    size_t m_bodyStartInBuffer = _detail::DefaultLibcurlReaderSize;
+    size_t m_bodyStartInBuffer = 0;
 
     /**
      * @brief Control field to handle the number of bytes containing relevant data within the
@@ -251,7 +251,7 @@ namespace Azure { namespace Core { namespace Http {
      * from wire into it, it can be holding less then N bytes.
      *
      */
-    size_t m_innerBufferSize = _detail::DefaultLibcurlReaderSize;
+    size_t m_innerBufferSize = 0;
 
     bool m_isChunkedResponseType = false;
 
@@ -282,13 +282,15 @@ namespace Azure { namespace Core { namespace Http {
     bool m_connectionUpgraded = false;
 
     /**
-     * @brief Internal buffer from a session used to read bytes from a socket. This buffer is only
-     * used while constructing an HTTP RawResponse without adding a body to it. Customers would
-     * provide their own buffer to copy from socket when reading the HTTP body using streams.
+     * @brief Internal buffer from a session used to read bytes from a socket. This buffer holds
+     * the HTTP status line and headers, and serves reads of the body smaller than the buffer.
+     * Larger reads copy from the socket straight into the customer's buffer.
+     *
+     * @remark The buffer is taken from the connection and given back to it when the connection is
+     * moved back to the pool.
      *
      */
-    uint8_t m_readBuffer[_detail::DefaultLibcurlReaderSize]
-        = {0}; // to work with libcurl custom read.
+    std::unique_ptr<uint8_t[]> m_readBuffer;
 
     /**
      * @brief Function used when working with Streams to manually write from the HTTP Request to
@@ -374,10 +376,16 @@ namespace Azure { namespace Core { namespace Http {
      */
     bool m_keepAlive = true;
 
+    // The connection pool limit for the host, from the transport adapter options.
+    size_t m_maxIdleConnections;
+
     Azure::Nullable<std::string> m_httpProxy;
     Azure::Nullable<std::string> m_httpProxyUser;
     Azure::Nullable<std::string> m_httpProxyPassword;
 
+    // The size of the internal buffer, from the transport adapter options.
+    size_t m_readBufferSize;
+
     /**
      * @brief Implement Azure::Core::IO::BodyStream::OnRead. Calling this function pulls data
      * from the wire.
@@ -408,9 +416,19 @@ namespace Azure { namespace Core { namespace Http {
         std::unique_ptr<CurlNetworkConnection> connection,
         CurlTransportOptions curlOptions)
         : m_connection(std::move(connection)), m_request(request),
-          m_keepAlive(curlOptions.HttpKeepAlive), m_httpProxy(curlOptions.Proxy),
-          m_httpProxyUser(curlOptions.ProxyUsername), m_httpProxyPassword(curlOptions.ProxyPassword)
+          m_keepAlive(curlOptions.HttpKeepAlive),
+          m_maxIdleConnections(curlOptions.MaxIdleConnectionsPerHost),
+          m_httpProxy(curlOptions.Proxy), m_httpProxyUser(curlOptions.ProxyUsername),
+          m_httpProxyPassword(curlOptions.ProxyPassword),
+          m_readBufferSize(
+              curlOptions.ReceiveBufferSize == 0 ? _detail::DefaultReceiveBufferSize
+                                                 : curlOptions.ReceiveBufferSize)
     {
+      m_bodyStartInBuffer = m_readBufferSize;
+      m_innerBufferSize = m_readBufferSize;
+      m_readBuffer = m_connection
+          ? m_connection->TakeReceiveBuffer(m_readBufferSize)
+          : std::unique_ptr<uint8_t[]>(new uint8_t[m_readBufferSize]);
     }
 
     ~CurlSession() override
@@ -423,8 +441,9 @@ namespace Azure { namespace Core { namespace Http {
       // IsEOF will also handle a connection that fail to complete an upload request.
       if (IsEOF() && m_keepAlive && !m_connectionUpgraded)
       {
+        m_connection->ReturnReceiveBuffer(std::move(m_readBuffer), m_readBufferSize);
         _detail::CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
-            std::move(m_connection), m_httpKeepAlive);
+            std::move(m_connection), m_httpKeepAlive, m_maxIdleConnections);
       }
     }
 
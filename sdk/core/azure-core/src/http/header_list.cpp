@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/core/internal/http/header_list.hpp"
+
+#include "azure/core/internal/strings.hpp"
+
+#include <utility>
+
+using Azure::Core::_internal::StringExtensions;
+using Azure::Core::Http::_detail::HeaderList;
+
+std::uint32_t HeaderList::Hash(std::string const& name) noexcept
+{
+  std::uint32_t hash = 2166136261u;
+  for (auto const c : name)
+  {
+    hash ^= static_cast<unsigned char>(StringExtensions::ToLower(c));
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+std::size_t HeaderList::FindIndex(std::string const& name, std::uint32_t hash) const noexcept
+{
+  for (std::size_t i = 0; i < m_headers.size(); ++i)
+  {
+    if (m_headers[i].Hash == hash
+        && StringExtensions::LocaleInvariantCaseInsensitiveEqual(m_headers[i].Name, name))
+    {
+      return i;
+    }
+  }
+  return m_headers.size();
+}
+
+HeaderList::Header const* HeaderList::Find(std::string const& name) const noexcept
+{
+  auto const index = FindIndex(name, Hash(name));
+  return index != m_headers.size() ? &m_headers[index] : nullptr;
+}
+
+void HeaderList::Set(std::string name, std::string value)
+{
+  auto const hash = Hash(name);
+  auto const index = FindIndex(name, hash);
+  if (index != m_headers.size())
+  {
+    m_headers[index].Value = std::move(value);
+    return;
+  }
+  m_headers.push_back(Header{hash, std::move(name), std::move(value)});
+}
+
+void HeaderList::Remove(std::string const& name)
+{
+  auto const index = FindIndex(name, Hash(name));
+  if (index != m_headers.size())
+  {
+    m_headers.erase(m_headers.begin() + static_cast<std::ptrdiff_t>(index));
+  }
+}
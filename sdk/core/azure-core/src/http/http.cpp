@@ -7,7 +7,7 @@
 #include "azure/core/url.hpp"
 
 #include <algorithm>
-#include <unordered_set>
+#include <utility>
 
 using namespace Azure::Core;
 using namespace Azure::Core::Http;
@@ -29,11 +29,41 @@ const HttpMethod HttpMethod::Options("OPTIONS");
 namespace {
 bool IsInvalidHeaderNameChar(char c)
 {
-  static std::unordered_set<char> const HeaderNameExtraValidChars
-      = {' ', '!', '#', '$', '%', '&', '\'', '*', '+', '-', '.', '^', '_', '`', '|', '~'};
+  if (Azure::Core::_internal::StringExtensions::IsAlphaNumeric(c))
+  {
+    return false;
+  }
+  switch (c)
+  {
+    case ' ':
+    case '!':
+    case '#':
+    case '$':
+    case '%':
+    case '&':
+    case '\'':
+    case '*':
+    case '+':
+    case '-':
+    case '.':
+    case '^':
+    case '_':
+    case '`':
+    case '|':
+    case '~':
+      return false;
+    default:
+      return true;
+  }
+}
 
-  return !Azure::Core::_internal::StringExtensions::IsAlphaNumeric(c)
-      && HeaderNameExtraValidChars.find(c) == HeaderNameExtraValidChars.end();
+void ValidateHeaderName(std::string const& headerName)
+{
+  if (std::find_if(headerName.begin(), headerName.end(), IsInvalidHeaderNameChar)
+      != headerName.end())
+  {
+    throw std::invalid_argument("Invalid header name: " + headerName);
+  }
 }
 } // namespace
 
@@ -42,14 +72,19 @@ void Azure::Core::Http::_detail::RawResponseHelpers::InsertHeaderWithValidation(
     std::string const& headerName,
     std::string const& headerValue)
 {
-
-  // Check all chars in name are valid
-  if (std::find_if(headerName.begin(), headerName.end(), IsInvalidHeaderNameChar)
-      != headerName.end())
-  {
-    throw std::invalid_argument("Invalid header name: " + headerName);
-  }
+  ValidateHeaderName(headerName);
 
   // insert (override if duplicated)
   headers[headerName] = headerValue;
 }
+
+void Azure::Core::Http::_detail::RawResponseHelpers::InsertHeaderWithValidation(
+    HeaderList& headers,
+    std::string headerName,
+    std::string headerValue)
+{
+  ValidateHeaderName(headerName);
+
+  // insert (override if duplicated)
+  headers.Set(std::move(headerName), std::move(headerValue));
+}
@@ -5,6 +5,7 @@
 
 #include "azure/core/url.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <sstream>
 
@@ -14,6 +15,19 @@ std::string const RedactedPlaceholder = "REDACTED";
 
 using Azure::Core::Http::_internal::HttpSanitizer;
 
+HttpSanitizer::HttpSanitizer(
+    std::set<std::string> const& allowedHttpQueryParameters,
+    Azure::Core::CaseInsensitiveSet const& allowedHttpHeaders)
+    : m_allowedHttpHeaders(allowedHttpHeaders)
+{
+  std::transform(
+      allowedHttpQueryParameters.begin(),
+      allowedHttpQueryParameters.end(),
+      std::inserter(
+          m_encodedAllowedHttpQueryParameters, m_encodedAllowedHttpQueryParameters.begin()),
+      [](std::string const& s) { return Url::Encode(s); });
+}
+
 Azure::Core::Url HttpSanitizer::SanitizeUrl(Azure::Core::Url const& url) const
 {
   std::ostringstream ss;
@@ -33,51 +47,30 @@ Azure::Core::Url HttpSanitizer::SanitizeUrl(Azure::Core::Url const& url) const
     ss << "/" << url.GetPath();
   }
 
+  auto const encodedRequestQueryParams = url.GetQueryParameters();
+  if (!encodedRequestQueryParams.empty())
   {
-    auto encodedRequestQueryParams = url.GetQueryParameters();
-
     std::remove_const<std::remove_reference<decltype(encodedRequestQueryParams)>::type>::type
         loggedQueryParams;
 
-    if (!encodedRequestQueryParams.empty())
+    for (auto const& encodedRequestQueryParam : encodedRequestQueryParams)
     {
-      auto const& unencodedAllowedQueryParams = m_allowedHttpQueryParameters;
-      if (!unencodedAllowedQueryParams.empty())
+      // Parameters without a value are only logged as is when some parameters are allowed.
+      if (!m_encodedAllowedHttpQueryParameters.empty()
+          && (encodedRequestQueryParam.second.empty()
+              || (m_encodedAllowedHttpQueryParameters.find(encodedRequestQueryParam.first)
+                  != m_encodedAllowedHttpQueryParameters.end())))
       {
-        std::remove_const<std::remove_reference<decltype(unencodedAllowedQueryParams)>::type>::type
-            encodedAllowedQueryParams;
-        std::transform(
-            unencodedAllowedQueryParams.begin(),
-            unencodedAllowedQueryParams.end(),
-            std::inserter(encodedAllowedQueryParams, encodedAllowedQueryParams.begin()),
-            [](std::string const& s) { return Url::Encode(s); });
-
-        for (auto const& encodedRequestQueryParam : encodedRequestQueryParams)
-        {
-          if (encodedRequestQueryParam.second.empty()
-              || (encodedAllowedQueryParams.find(encodedRequestQueryParam.first)
-                  != encodedAllowedQueryParams.end()))
-          {
-            loggedQueryParams.insert(encodedRequestQueryParam);
-          }
-          else
-          {
-            loggedQueryParams.insert(
-                std::make_pair(encodedRequestQueryParam.first, RedactedPlaceholder));
-          }
-        }
+        loggedQueryParams.insert(encodedRequestQueryParam);
       }
       else
       {
-        for (auto const& encodedRequestQueryParam : encodedRequestQueryParams)
-        {
-          loggedQueryParams.insert(
-              std::make_pair(encodedRequestQueryParam.first, RedactedPlaceholder));
-        }
+        loggedQueryParams.insert(
+            std::make_pair(encodedRequestQueryParam.first, RedactedPlaceholder));
       }
-
-      ss << Azure::Core::_detail::FormatEncodedUrlQueryParameters(loggedQueryParams);
     }
+
+    ss << Azure::Core::_detail::FormatEncodedUrlQueryParameters(loggedQueryParams);
   }
   return Azure::Core::Url(ss.str());
 }
@@ -23,7 +23,7 @@ inline void AppendHeaders(
 {
   for (auto const& header : headers)
   {
-    log << std::endl << header.first << " : ";
+    log << '\n' << header.first << " : ";
 
     if (!header.second.empty())
     {
@@ -34,31 +34,34 @@ inline void AppendHeaders(
 
 inline std::string GetRequestLogMessage(
     Azure::Core::Http::_internal::HttpSanitizer const& httpSanitizer,
-    Request const& request)
+    HttpMethod const& method,
+    Azure::Core::Url const& url,
+    Azure::Core::CaseInsensitiveMap const& headers)
 {
   std::ostringstream log;
-  log << "HTTP Request : " << request.GetMethod().ToString() << " ";
-
-  Azure::Core::Url urlToLog(httpSanitizer.SanitizeUrl(request.GetUrl()));
-  log << urlToLog.GetAbsoluteUrl();
+  log << "HTTP Request : " << method.ToString() << " "
+      << httpSanitizer.SanitizeUrl(url).GetAbsoluteUrl();
 
-  AppendHeaders(log, httpSanitizer, request.GetHeaders());
+  AppendHeaders(log, httpSanitizer, headers);
   return log.str();
 }
 
 inline std::string GetResponseLogMessage(
     Azure::Core::Http::_internal::HttpSanitizer const& httpSanitizer,
-    RawResponse const& response,
+    int32_t majorVersion,
+    int32_t minorVersion,
+    HttpStatusCode statusCode,
+    std::string const& reasonPhrase,
+    Azure::Core::CaseInsensitiveMap const& headers,
     std::chrono::system_clock::duration const& duration)
 {
   std::ostringstream log;
 
-  log << "HTTP/" << response.GetMajorVersion() << '.' << response.GetMinorVersion() << " Response ("
+  log << "HTTP/" << majorVersion << '.' << minorVersion << " Response ("
       << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()
-      << "ms) : " << static_cast<int>(response.GetStatusCode()) << " "
-      << response.GetReasonPhrase();
+      << "ms) : " << static_cast<int>(statusCode) << " " << reasonPhrase;
 
-  AppendHeaders(log, httpSanitizer, response.GetHeaders());
+  AppendHeaders(log, httpSanitizer, headers);
   return log.str();
 }
 } // namespace
@@ -109,21 +112,71 @@ std::unique_ptr<RawResponse> LogPolicy::Send(
   using Azure::Core::Diagnostics::Logger;
   using Azure::Core::Diagnostics::_internal::Log;
 
-  if (Log::ShouldWrite(Logger::Level::Verbose))
+  if (!Log::ShouldWrite(Logger::Level::Verbose))
+  {
+    return nextPolicy.Send(request, context);
+  }
+
+  // In asynchronous mode the messages are formatted on the logging thread, from copies of the
+  // request and response data. Otherwise they are formatted here, without copying anything.
+  bool const isAsynchronous = Log::IsAsynchronous();
+  if (isAsynchronous)
   {
-    Log::Write(Logger::Level::Informational, GetRequestLogMessage(m_httpSanitizer, request));
+    Log::WriteDeferred(
+        Logger::Level::Informational,
+        [httpSanitizer = m_httpSanitizer,
+         method = request.GetMethod(),
+         url = request.GetUrl(),
+         headers = request.GetHeaders()]() {
+          return GetRequestLogMessage(*httpSanitizer, method, url, headers);
+        });
   }
   else
   {
-    return nextPolicy.Send(request, context);
+    Log::Write(
+        Logger::Level::Informational,
+        GetRequestLogMessage(
+            *m_httpSanitizer, request.GetMethod(), request.GetUrl(), request.GetHeaders()));
   }
 
   auto const start = std::chrono::system_clock::now();
   auto response = nextPolicy.Send(request, context);
   auto const end = std::chrono::system_clock::now();
 
-  Log::Write(
-      Logger::Level::Informational, GetResponseLogMessage(m_httpSanitizer, *response, end - start));
+  if (isAsynchronous)
+  {
+    Log::WriteDeferred(
+        Logger::Level::Informational,
+        [httpSanitizer = m_httpSanitizer,
+         majorVersion = response->GetMajorVersion(),
+         minorVersion = response->GetMinorVersion(),
+         statusCode = response->GetStatusCode(),
+         reasonPhrase = response->GetReasonPhrase(),
+         headers = response->GetHeaders(),
+         duration = end - start]() {
+          return GetResponseLogMessage(
+              *httpSanitizer,
+              majorVersion,
+              minorVersion,
+              statusCode,
+              reasonPhrase,
+              headers,
+              duration);
+        });
+  }
+  else
+  {
+    Log::Write(
+        Logger::Level::Informational,
+        GetResponseLogMessage(
+            *m_httpSanitizer,
+            response->GetMajorVersion(),
+            response->GetMinorVersion(),
+            response->GetStatusCode(),
+            response->GetReasonPhrase(),
+            response->GetHeaders(),
+            end - start));
+  }
 
   return response;
 }
@@ -4,10 +4,13 @@
 #include "azure/core/http/raw_response.hpp"
 
 #include "azure/core/http/http.hpp"
+#include "../private/buffer_pool.hpp"
 
 using namespace Azure::Core::IO;
 using namespace Azure::Core::Http;
 
+RawResponse::~RawResponse() { Azure::Core::IO::_detail::ReleaseBuffer(std::move(m_body)); }
+
 HttpStatusCode RawResponse::GetStatusCode() const { return m_statusCode; }
 
 std::string const& RawResponse::GetReasonPhrase() const { return m_reasonPhrase; }
@@ -13,18 +13,6 @@ using namespace Azure::Core;
 using namespace Azure::Core::Http;
 using namespace Azure::Core::IO::_internal;
 
-namespace {
-// returns left map plus all items in right
-// when duplicates, left items are preferred
-static Azure::Core::CaseInsensitiveMap MergeMaps(
-    Azure::Core::CaseInsensitiveMap left,
-    Azure::Core::CaseInsensitiveMap const& right)
-{
-  left.insert(right.begin(), right.end());
-  return left;
-}
-} // namespace
-
 Request::Request(HttpMethod httpMethod, Url url, bool shouldBufferResponse)
     : Request(httpMethod, std::move(url), NullBodyStream::GetNullBodyStream(), shouldBufferResponse)
 {
@@ -37,12 +25,12 @@ Request::Request(HttpMethod httpMethod, Url url)
 
 Azure::Nullable<std::string> Request::GetHeader(std::string const& name)
 {
-  for (auto const& hdrs : {m_retryHeaders, m_headers})
+  // Look the header up in place; the retry headers take precedence.
+  for (auto const* hdrs : {&m_retryHeaders, &m_headers})
   {
-    auto const header = hdrs.find(name);
-    if (header != hdrs.end())
+    if (auto const header = hdrs->Find(name))
     {
-      return header->second;
+      return header->Value;
     }
   }
 
@@ -59,14 +47,14 @@ void Request::SetHeader(std::string const& name, std::string const& value)
 
 void Request::RemoveHeader(std::string const& name)
 {
-  this->m_headers.erase(name);
-  this->m_retryHeaders.erase(name);
+  this->m_headers.Remove(name);
+  this->m_retryHeaders.Remove(name);
 }
 
 void Request::StartTry()
 {
   this->m_retryModeEnabled = true;
-  this->m_retryHeaders.clear();
+  this->m_retryHeaders.Clear();
 
   // Make sure to rewind the body stream before each attempt, including the first.
   // It's possible the request doesn't have a body, so make sure to check if a body stream exists.
@@ -82,5 +70,10 @@ Azure::Core::CaseInsensitiveMap Request::GetHeaders() const
 {
   // create map with retry headers which are the most important and we don't want
   // to override them with any duplicate header
-  return MergeMaps(this->m_retryHeaders, this->m_headers);
+  Azure::Core::CaseInsensitiveMap headers;
+  _detail::RequestHeaders::ForEach(
+      *this, [&headers](std::string const& name, std::string const& value) {
+        headers.emplace(name, value);
+      });
+  return headers;
 }
@@ -21,8 +21,8 @@ std::unique_ptr<RawResponse> RequestActivityPolicy::Send(
     Context const& context) const
 {
   // Find a tracing factory from our context. Note that the factory value is owned by the
-  // context chain so we can manage a raw pointer to the factory.
-  auto tracingFactory = TracingContextFactory::CreateFromContext(context);
+  // context chain so we can manage a raw pointer to the factory without copying it.
+  auto tracingFactory = TracingContextFactory::GetFromContext(context);
 
   // If our tracing factory has a tracer attached to it, register the request with the tracer.
   if (tracingFactory && tracingFactory->HasTracer())
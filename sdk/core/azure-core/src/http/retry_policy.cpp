@@ -3,9 +3,10 @@
 
 #include "azure/core/http/policies/policy.hpp"
 #include "azure/core/internal/diagnostics/log.hpp"
+#include "azure/core/internal/timer_wheel.hpp"
 
 #include <algorithm>
-#include <cstdlib>
+#include <future>
 #include <limits>
 #include <sstream>
 #include <thread>
@@ -53,6 +54,32 @@ bool GetResponseHeaderBasedDelay(RawResponse const& response, std::chrono::milli
   return false;
 }
 
+/**
+ * @brief Get a random number in the range [0 .. 1).
+ *
+ * @remark Every thread has its own xorshift generator, so unlike `std::rand()` it's thread safe
+ * and many threads retrying at once don't contend on a global state.
+ */
+double GetRandomFraction()
+{
+  thread_local uint64_t state = []() {
+    uint64_t const timeSeed = static_cast<uint64_t>(
+        std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    uint64_t const threadSeed = std::hash<std::thread::id>()(std::this_thread::get_id());
+    // splitmix64 finalizer, so that threads started at the same time get unrelated sequences.
+    uint64_t seed = timeSeed ^ (threadSeed * 0x9E3779B97F4A7C15ULL);
+    seed = (seed ^ (seed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    seed = (seed ^ (seed >> 27)) * 0x94D049BB133111EBULL;
+    seed ^= seed >> 31;
+    return seed == 0 ? 0x9E3779B97F4A7C15ULL : seed;
+  }();
+  state ^= state >> 12;
+  state ^= state << 25;
+  state ^= state >> 27;
+  // The top 53 bits of the xorshift64* output fill the mantissa of a double.
+  return static_cast<double>((state * 0x2545F4914F6CDD1DULL) >> 11) / 9007199254740992.0;
+}
+
 /**
  * @brief Calculate the exponential delay needed for this retry.
  *
@@ -73,8 +100,7 @@ std::chrono::milliseconds CalculateExponentialDelay(
   if (jitterFactor < 0.8 || jitterFactor > 1.3)
   {
     // jitterFactor is a random double number in the range [0.8 .. 1.3]
-    jitterFactor
-        = 0.8 + ((static_cast<double>(static_cast<int32_t>(std::rand())) / RAND_MAX) * 0.5);
+    jitterFactor = 0.8 + GetRandomFraction() * 0.5;
   }
 
   constexpr auto beforeLastBit
@@ -100,9 +126,69 @@ bool WasLastAttempt(RetryOptions const& retryOptions, int32_t attempt)
   return attempt > retryOptions.MaxRetries;
 }
 
+/**
+ * @brief Wait before the next retry.
+ *
+ * @remark The wait is driven by the shared timer wheel rather than sleeping for the whole delay,
+ * and it stops early with an exception when the deadline of the \p context comes first.
+ */
+void WaitForRetry(std::chrono::milliseconds retryAfter, Context const& context)
+{
+  using Azure::Core::_internal::TimerWheel;
+
+  auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+      context.GetDeadline() - Azure::DateTime(std::chrono::system_clock::now()));
+  auto const expired = std::make_shared<std::promise<void>>();
+  auto done = expired->get_future();
+  auto& timerWheel = TimerWheel::GetDefault();
+  auto const timerId = timerWheel.Schedule(retryAfter, [expired]() { expired->set_value(); });
+
+  if (remaining < retryAfter
+      && done.wait_for((std::max)(remaining, std::chrono::milliseconds(0)))
+          != std::future_status::ready
+      && timerWheel.Cancel(timerId))
+  {
+    // The deadline passed before the delay, so the retry would be cancelled anyway.
+    throw Azure::Core::OperationCancelledException("Request was cancelled by context.");
+  }
+  done.wait();
+}
+
 Context::Key const RetryKey;
 } // namespace
 
+RetryBudget::RetryBudget(int32_t maxTokens, double tokensPerSuccess)
+    : m_maxMilliTokens(static_cast<int64_t>(maxTokens) * 1000),
+      m_milliTokensPerSuccess(static_cast<int64_t>(tokensPerSuccess * 1000)),
+      m_milliTokens(m_maxMilliTokens)
+{
+}
+
+bool RetryBudget::TryAcquireRetry()
+{
+  auto tokens = m_milliTokens.load(std::memory_order_relaxed);
+  do
+  {
+    if (tokens <= m_maxMilliTokens / 2)
+    {
+      return false;
+    }
+  } while (!m_milliTokens.compare_exchange_weak(tokens, tokens - 1000, std::memory_order_relaxed));
+  return true;
+}
+
+void RetryBudget::RecordSuccess()
+{
+  auto tokens = m_milliTokens.load(std::memory_order_relaxed);
+  while (tokens < m_maxMilliTokens
+         && !m_milliTokens.compare_exchange_weak(
+             tokens,
+             (std::min)(tokens + m_milliTokensPerSuccess, m_maxMilliTokens),
+             std::memory_order_relaxed))
+  {
+  }
+}
+
 int32_t RetryPolicy::GetRetryCount(Context const& context)
 {
   int32_t number = -1;
@@ -144,10 +230,20 @@ std::unique_ptr<RawResponse> RetryPolicy::Send(
       // doesn't need to be retried), then ShouldRetry returns false.
       if (!ShouldRetryOnResponse(*response.get(), m_retryOptions, attempt, retryAfter))
       {
+        if (m_retryBudget
+            && m_retryOptions.StatusCodes.find(response->GetStatusCode())
+                == m_retryOptions.StatusCodes.end())
+        {
+          m_retryBudget->RecordSuccess();
+        }
         // If this is the second attempt and StartTry was called, we need to stop it. Otherwise
         // trying to perform same request would use last retry query/headers
         return response;
       }
+      if (!AcquireRetryFromBudget())
+      {
+        return response;
+      }
     }
     catch (const TransportException& e)
     {
@@ -156,7 +252,8 @@ std::unique_ptr<RawResponse> RetryPolicy::Send(
         Log::Write(Logger::Level::Warning, std::string("HTTP Transport error: ") + e.what());
       }
 
-      if (!ShouldRetryOnTransportFailure(m_retryOptions, attempt, retryAfter))
+      if (!ShouldRetryOnTransportFailure(m_retryOptions, attempt, retryAfter)
+          || !AcquireRetryFromBudget())
       {
         throw;
       }
@@ -172,13 +269,12 @@ std::unique_ptr<RawResponse> RetryPolicy::Send(
       Log::Write(Logger::Level::Informational, log.str());
     }
 
-    // Sleep(0) behavior is implementation-defined: it may yield, or may do nothing. Let's make sure
-    // we proceed immediately if it is 0.
+    // Proceed immediately if the delay is 0.
     if (retryAfter.count() > 0)
     {
-      // Before sleeping, check to make sure that the context hasn't already been cancelled.
+      // Before waiting, check to make sure that the context hasn't already been cancelled.
       context.ThrowIfCancelled();
-      std::this_thread::sleep_for(retryAfter);
+      WaitForRetry(retryAfter, context);
     }
 
     // Restore the original query parameters before next retry
@@ -189,6 +285,23 @@ std::unique_ptr<RawResponse> RetryPolicy::Send(
   }
 }
 
+bool RetryPolicy::AcquireRetryFromBudget() const
+{
+  using Azure::Core::Diagnostics::Logger;
+  using Azure::Core::Diagnostics::_internal::Log;
+
+  if (!m_retryBudget || m_retryBudget->TryAcquireRetry())
+  {
+    return true;
+  }
+  if (Log::ShouldWrite(Logger::Level::Warning))
+  {
+    Log::Write(
+        Logger::Level::Warning, "HTTP Retry budget exhausted, the request won't be retried.");
+  }
+  return false;
+}
+
 bool RetryPolicy::ShouldRetryOnTransportFailure(
     RetryOptions const& retryOptions,
     int32_t attempt,
@@ -22,6 +22,7 @@
 #include "azure/core/context.hpp"
 #include "azure/core/internal/io/null_body_stream.hpp"
 #include "azure/core/io/body_stream.hpp"
+#include "../private/buffer_pool.hpp"
 
 #include <algorithm>
 #include <codecvt>
@@ -63,19 +64,49 @@ size_t BodyStream::ReadToCount(uint8_t* buffer, size_t count, Context const& con
 std::vector<uint8_t> BodyStream::ReadToEnd(Context const& context)
 {
   constexpr size_t chunkSize = 1024 * 8;
-  auto buffer = std::vector<uint8_t>();
+  // The length of some streams is only what the server announced, e.g. for a HEAD request, so
+  // don't trust it for more than this much memory upfront.
+  constexpr size_t maxPreallocatedSize = 1024 * 1024 * 4;
+  // std::vector zero-fills the bytes it grows by. Recycled buffers keep the size they had, so
+  // they are read into without being written first. Otherwise, the buffer is grown by this much at
+  // a time, just before it is read into, rather than zero-filled in one pass.
+  constexpr size_t growSize = 1024 * 64;
+
+  auto const length = this->Length();
+  auto targetSize = length >= 0
+      ? static_cast<size_t>((std::min)(length, static_cast<int64_t>(maxPreallocatedSize)))
+      : chunkSize;
+  auto buffer = targetSize > 0 ? _detail::AcquireBuffer(targetSize) : std::vector<uint8_t>();
 
-  for (auto chunkNumber = 0;; chunkNumber++)
+  size_t totalRead = 0;
+  for (;;)
   {
-    buffer.resize((static_cast<decltype(buffer)::size_type>(chunkNumber) + 1) * chunkSize);
-    size_t readBytes
-        = this->ReadToCount(buffer.data() + (chunkNumber * chunkSize), chunkSize, context);
+    if (totalRead == buffer.size())
+    {
+      if (totalRead >= targetSize)
+      {
+        // The buffer is full, which is expected when the length is known. Check for the end of
+        // the stream without growing the buffer, so that it isn't reallocated.
+        uint8_t nextByte = 0;
+        if (this->Read(&nextByte, 1, context) == 0)
+        {
+          return buffer;
+        }
+        buffer.push_back(nextByte);
+        ++totalRead;
+        targetSize = (std::max)(buffer.size() * 2, chunkSize);
+      }
+      buffer.resize((std::min)(targetSize, totalRead + growSize));
+    }
 
-    if (readBytes < chunkSize)
+    auto const bytesRead
+        = this->Read(buffer.data() + totalRead, buffer.size() - totalRead, context);
+    if (bytesRead == 0)
     {
-      buffer.resize(static_cast<size_t>((chunkNumber * chunkSize) + readBytes));
+      buffer.resize(totalRead);
       return buffer;
     }
+    totalRead += bytesRead;
   }
 }
 
@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "../private/buffer_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+using namespace Azure::Core::IO::_detail;
+
+namespace {
+constexpr size_t MinSizeClassBits = 10;
+constexpr size_t SizeClassCount = 11; // 1 KiB to 1 MiB.
+constexpr size_t MaxBuffersPerSizeClass = 4;
+// Bounds the memory which a thread keeps for later.
+constexpr size_t MaxCachedBytesPerThread = 4 * 1024 * 1024;
+
+static_assert(
+    (size_t(1) << MinSizeClassBits) == MinPooledBufferSize,
+    "The first size class must match MinPooledBufferSize.");
+static_assert(
+    (size_t(1) << (MinSizeClassBits + SizeClassCount - 1)) == MaxPooledBufferSize,
+    "The last size class must match MaxPooledBufferSize.");
+
+// Index of the largest size class which is not larger than size.
+size_t GetSizeClassFloor(size_t size)
+{
+  size_t sizeClass = 0;
+  while (sizeClass + 1 < SizeClassCount
+         && (size_t(1) << (MinSizeClassBits + sizeClass + 1)) <= size)
+  {
+    ++sizeClass;
+  }
+  return sizeClass;
+}
+
+// Index of the smallest size class which is not smaller than size.
+size_t GetSizeClassCeiling(size_t size)
+{
+  size_t sizeClass = 0;
+  while ((size_t(1) << (MinSizeClassBits + sizeClass)) < size)
+  {
+    ++sizeClass;
+  }
+  return sizeClass;
+}
+
+class ThreadBufferCache final {
+public:
+  ~ThreadBufferCache() { g_isDestroyed = true; }
+
+  static ThreadBufferCache* Get()
+  {
+    // Responses can be destroyed by the destructors of other thread-local objects, after the
+    // cache of the thread is gone.
+    if (g_isDestroyed)
+    {
+      return nullptr;
+    }
+    thread_local ThreadBufferCache cache;
+    return &cache;
+  }
+
+  bool TryTake(size_t sizeClass, std::vector<uint8_t>& buffer)
+  {
+    auto& buffers = m_buffers[sizeClass];
+    if (buffers.Count == 0)
+    {
+      return false;
+    }
+    buffer = std::move(buffers.Buffers[--buffers.Count]);
+    m_cachedBytes -= buffer.capacity();
+    return true;
+  }
+
+  void Put(std::vector<uint8_t>&& buffer)
+  {
+    auto& buffers = m_buffers[GetSizeClassFloor(buffer.capacity())];
+    if (buffers.Count == MaxBuffersPerSizeClass
+        || m_cachedBytes + buffer.capacity() > MaxCachedBytesPerThread)
+    {
+      return;
+    }
+    m_cachedBytes += buffer.capacity();
+    buffers.Buffers[buffers.Count++] = std::move(buffer);
+  }
+
+private:
+  struct SizeClass final
+  {
+    std::array<std::vector<uint8_t>, MaxBuffersPerSizeClass> Buffers;
+    size_t Count = 0;
+  };
+
+  static thread_local bool g_isDestroyed;
+
+  std::array<SizeClass, SizeClassCount> m_buffers;
+  size_t m_cachedBytes = 0;
+};
+
+thread_local bool ThreadBufferCache::g_isDestroyed = false;
+} // namespace
+
+namespace Azure { namespace Core { namespace IO { namespace _detail {
+
+  std::vector<uint8_t> AcquireBuffer(size_t capacity)
+  {
+    std::vector<uint8_t> buffer;
+    if (capacity > MaxPooledBufferSize)
+    {
+      buffer.reserve(capacity);
+      return buffer;
+    }
+
+    capacity = (std::max)(capacity, MinPooledBufferSize);
+    auto const sizeClass = GetSizeClassCeiling(capacity);
+    auto cache = ThreadBufferCache::Get();
+    // A buffer from the next size class is fine too, it's at most 4 times larger than needed.
+    if (cache != nullptr
+        && (cache->TryTake(sizeClass, buffer)
+            || (sizeClass + 1 < SizeClassCount && cache->TryTake(sizeClass + 1, buffer))))
+    {
+      return buffer;
+    }
+    // Round up to the size class, so the buffer can be re-used by any request of that class.
+    buffer.reserve(size_t(1) << (MinSizeClassBits + sizeClass));
+    return buffer;
+  }
+
+  void ReleaseBuffer(std::vector<uint8_t>&& buffer)
+  {
+    auto const capacity = buffer.capacity();
+    if (capacity < MinPooledBufferSize || capacity >= MaxPooledBufferSize * 2)
+    {
+      return;
+    }
+    if (auto cache = ThreadBufferCache::Get())
+    {
+      cache->Put(std::move(buffer));
+    }
+  }
+
+}}}} // namespace Azure::Core::IO::_detail
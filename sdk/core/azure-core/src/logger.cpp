@@ -4,10 +4,13 @@
 #include "azure/core/diagnostics/logger.hpp"
 
 #include "azure/core/internal/diagnostics/log.hpp"
+#include "private/async_log_queue.hpp"
 #include "private/environment_log_level_listener.hpp"
 
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <thread>
 
 using namespace Azure::Core::Diagnostics;
 using namespace Azure::Core::Diagnostics::_internal;
@@ -16,6 +19,76 @@ namespace {
 std::shared_timed_mutex g_logListenerMutex{};
 std::function<void(Logger::Level level, std::string const& message)> g_logListener(
     _detail::EnvironmentLogLevelListener::GetLogListener());
+
+std::atomic<std::uint64_t> g_droppedMessageCount{0};
+
+// The queue of asynchronous log messages, or null when messages are delivered synchronously.
+// Writers register in g_asyncLogWriters before loading the pointer, and the queue is only
+// destroyed once the pointer has been reset and there are no registered writers left.
+std::atomic<_detail::AsyncLogQueue*> g_asyncLogQueue{nullptr};
+std::atomic<std::size_t> g_asyncLogWriters{0};
+
+class AsyncLogQueueUser final {
+public:
+  _detail::AsyncLogQueue* Queue;
+
+  AsyncLogQueueUser()
+  {
+    g_asyncLogWriters.fetch_add(1);
+    Queue = g_asyncLogQueue.load();
+  }
+  ~AsyncLogQueueUser() { g_asyncLogWriters.fetch_sub(1); }
+
+  AsyncLogQueueUser(AsyncLogQueueUser const&) = delete;
+  AsyncLogQueueUser& operator=(AsyncLogQueueUser const&) = delete;
+};
+
+void DeliverLogMessage(Logger::Level level, std::string const& message)
+{
+  std::shared_lock<std::shared_timed_mutex> loggerLock(g_logListenerMutex);
+  if (g_logListener)
+  {
+    g_logListener(level, message);
+  }
+}
+
+// Owns the queue of asynchronous log messages. It is defined after the listener so that the
+// queued messages are delivered before the listener is destroyed at exit.
+class AsyncLogging final {
+  std::mutex m_mutex;
+  std::unique_ptr<_detail::AsyncLogQueue> m_queue;
+
+  void StopLocked()
+  {
+    if (m_queue)
+    {
+      g_asyncLogQueue.store(nullptr);
+      while (g_asyncLogWriters.load() != 0)
+      {
+        std::this_thread::yield();
+      }
+      m_queue.reset();
+    }
+  }
+
+public:
+  ~AsyncLogging() { Stop(); }
+
+  void Start(Logger::AsynchronousOptions const& options)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    StopLocked();
+    m_queue = std::make_unique<_detail::AsyncLogQueue>(
+        options, DeliverLogMessage, g_droppedMessageCount);
+    g_asyncLogQueue.store(m_queue.get());
+  }
+
+  void Stop()
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    StopLocked();
+  }
+} g_asyncLogging;
 } // namespace
 
 std::atomic<bool> Log::g_isLoggingEnabled(
@@ -32,14 +105,42 @@ void Log::Write(Logger::Level level, std::string const& message)
 {
   if (ShouldWrite(level) && !message.empty())
   {
-    std::shared_lock<std::shared_timed_mutex> loggerLock(g_logListenerMutex);
-    if (g_logListener)
+    if (g_asyncLogQueue.load(std::memory_order_relaxed) != nullptr)
+    {
+      AsyncLogQueueUser user;
+      if (user.Queue != nullptr)
+      {
+        user.Queue->Push(level, message);
+        return;
+      }
+    }
+    DeliverLogMessage(level, message);
+  }
+}
+
+void Log::WriteDeferred(Logger::Level level, std::function<std::string()> formatMessage)
+{
+  if (ShouldWrite(level))
+  {
+    if (g_asyncLogQueue.load(std::memory_order_relaxed) != nullptr)
+    {
+      AsyncLogQueueUser user;
+      if (user.Queue != nullptr)
+      {
+        user.Queue->Push(level, std::move(formatMessage));
+        return;
+      }
+    }
+    auto const message = formatMessage();
+    if (!message.empty())
     {
-      g_logListener(level, message);
+      DeliverLogMessage(level, message);
     }
   }
 }
 
+bool Log::IsAsynchronous() { return g_asyncLogQueue.load(std::memory_order_relaxed) != nullptr; }
+
 void Logger::SetListener(
     std::function<void(Logger::Level level, std::string const& message)> listener)
 {
@@ -49,3 +150,21 @@ void Logger::SetListener(
 }
 
 void Logger::SetLevel(Logger::Level level) { Log::SetLogLevel(level); }
+
+void Logger::EnableAsynchronousLogging(Logger::AsynchronousOptions const& options)
+{
+  g_asyncLogging.Start(options);
+}
+
+void Logger::DisableAsynchronousLogging() { g_asyncLogging.Stop(); }
+
+void Logger::Flush()
+{
+  AsyncLogQueueUser user;
+  if (user.Queue != nullptr)
+  {
+    user.Queue->Flush();
+  }
+}
+
+std::uint64_t Logger::GetDroppedMessageCount() { return g_droppedMessageCount.load(); }
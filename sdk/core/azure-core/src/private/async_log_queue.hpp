@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/core/diagnostics/logger.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace Azure { namespace Core { namespace Diagnostics { namespace _detail {
+
+  /**
+   * @brief Queues log messages and delivers them on a background thread.
+   *
+   * The queue is a bounded multiple producer, single consumer ring buffer: writers claim a slot by
+   * advancing the enqueue position with a compare-and-swap, and publish the slot by bumping its
+   * sequence number, so they never take a lock. The background thread is the only consumer. It
+   * formats deferred messages and calls the deliver function, and only sleeps on a condition
+   * variable when the ring is empty.
+   */
+  class AsyncLogQueue final {
+  public:
+    /// Produces the text of a message whose formatting was deferred.
+    using FormatFunction = std::function<std::string()>;
+
+    /// Delivers a message to the listener.
+    using DeliverFunction = std::function<void(Logger::Level, std::string const&)>;
+
+    AsyncLogQueue(
+        Logger::AsynchronousOptions const& options,
+        DeliverFunction deliver,
+        std::atomic<std::uint64_t>& droppedMessageCount);
+
+    /**
+     * @brief Delivers the queued messages and stops the background thread.
+     *
+     */
+    ~AsyncLogQueue();
+
+    AsyncLogQueue(AsyncLogQueue const&) = delete;
+    AsyncLogQueue& operator=(AsyncLogQueue const&) = delete;
+
+    /**
+     * @brief Queues a message, or drops it when the ring is full and the queue doesn't block.
+     *
+     */
+    void Push(Logger::Level level, std::string message);
+
+    /**
+     * @brief Queues a message which is formatted on the background thread.
+     *
+     */
+    void Push(Logger::Level level, FormatFunction format);
+
+    /**
+     * @brief Waits until the messages queued before the call have been delivered.
+     *
+     */
+    void Flush();
+
+  private:
+    struct Slot final
+    {
+      std::atomic<std::size_t> Sequence;
+      Logger::Level Level;
+      std::string Message;
+      FormatFunction Format;
+    };
+
+    std::size_t const m_mask;
+    bool const m_block;
+    DeliverFunction const m_deliver;
+    std::atomic<std::uint64_t>& m_droppedMessageCount;
+    std::unique_ptr<Slot[]> m_slots;
+
+    std::atomic<std::size_t> m_enqueuePosition{0};
+    // Only read and written by the background thread, except for Flush().
+    std::atomic<std::size_t> m_deliveredPosition{0};
+
+    std::mutex m_mutex;
+    std::condition_variable m_messageQueued;
+    std::condition_variable m_messagesDelivered;
+    std::atomic<bool> m_consumerWaiting{false};
+    std::atomic<std::size_t> m_flushWaiters{0};
+    bool m_stopping{};
+
+    std::thread m_thread;
+
+    void Enqueue(Logger::Level level, std::string&& message, FormatFunction&& format);
+    bool IsNextSlotReady() const;
+    void Run();
+  };
+
+}}}} // namespace Azure::Core::Diagnostics::_detail
@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Azure { namespace Core { namespace IO { namespace _detail {
+
+  /*
+   * Buffered response bodies are recycled through per-thread caches of byte vectors, so that
+   * reading many small responses doesn't allocate a new body for each of them. Vectors are kept
+   * in power of two size classes, by capacity, between MinPooledBufferSize and MaxPooledBufferSize.
+   */
+  constexpr size_t MinPooledBufferSize = 1024;
+  constexpr size_t MaxPooledBufferSize = 1024 * 1024;
+
+  /**
+   * @brief Get a vector with a capacity of at least \p capacity bytes, re-using one from the
+   * cache of the calling thread when possible.
+   *
+   * @details A new vector is empty. A re-used vector keeps the size it had when it was released,
+   * and its bytes are left over from its previous use, so that resizing it within that size
+   * doesn't zero-fill it again.
+   *
+   */
+  std::vector<uint8_t> AcquireBuffer(size_t capacity);
+
+  /**
+   * @brief Give a vector back to the cache of the calling thread. Vectors which are too small or
+   * too large to be pooled, or which don't fit in the cache, are freed.
+   *
+   */
+  void ReleaseBuffer(std::vector<uint8_t>&& buffer);
+
+}}}} // namespace Azure::Core::IO::_detail
@@ -0,0 +1,199 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/core/internal/timer_wheel.hpp"
+
+#include <algorithm>
+#include <utility>
+
+using Azure::Core::_internal::TimerWheel;
+
+TimerWheel& TimerWheel::GetDefault()
+{
+  static TimerWheel wheel;
+  return wheel;
+}
+
+TimerWheel::TimerWheel() : m_start(std::chrono::steady_clock::now()) {}
+
+TimerWheel::~TimerWheel()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopped = true;
+  }
+  m_changed.notify_all();
+  if (m_thread.joinable())
+  {
+    m_thread.join();
+  }
+}
+
+TimerWheel::TimerId TimerWheel::Schedule(
+    std::chrono::milliseconds delay,
+    std::function<void()> callback)
+{
+  TimerId timerId = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const now = GetTick(std::chrono::steady_clock::now());
+    if (m_callbacks.empty())
+    {
+      // Nothing is pending, so drop what is left from cancelled timers and catch up with the
+      // clock in one step instead of one tick at a time.
+      for (auto& wheel : m_wheels)
+      {
+        for (auto& slot : wheel)
+        {
+          slot.clear();
+        }
+      }
+      m_currentTick = (std::max)(m_currentTick, now);
+    }
+
+    // The current tick is partly elapsed already, so count the delay from the next one to never
+    // fire early.
+    auto const ticks = delay.count() > 0 ? static_cast<uint64_t>(delay.count()) : uint64_t(0);
+    timerId = m_nextId++;
+    m_callbacks.emplace(timerId, std::move(callback));
+    Insert({timerId, now + ticks + 1});
+
+    if (!m_thread.joinable())
+    {
+      m_thread = std::thread([this]() { Run(); });
+    }
+  }
+  m_changed.notify_one();
+  return timerId;
+}
+
+bool TimerWheel::Cancel(TimerId timerId)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_callbacks.erase(timerId) != 0;
+}
+
+void TimerWheel::Insert(Entry entry)
+{
+  entry.ExpiryTick = (std::max)(entry.ExpiryTick, m_currentTick + 1);
+  auto const delta = entry.ExpiryTick - m_currentTick;
+  for (size_t level = 0; level < LevelCount; level++)
+  {
+    if (delta < (uint64_t(1) << (LevelBits * (level + 1))))
+    {
+      m_wheels[level][(entry.ExpiryTick >> (LevelBits * level)) & (SlotCount - 1)].push_back(
+          entry);
+      return;
+    }
+  }
+  // Beyond the range of the wheels. Park the timer in the slot of the last wheel which is
+  // cascaded last, and it is inserted again from there.
+  auto const lastLevel = LevelCount - 1;
+  m_wheels[lastLevel][(m_currentTick >> (LevelBits * lastLevel)) & (SlotCount - 1)].push_back(
+      entry);
+}
+
+void TimerWheel::Advance(std::vector<std::function<void()>>& expired)
+{
+  auto const tick = ++m_currentTick;
+
+  auto const takeIfPending = [&](Entry const& entry) {
+    auto callback = m_callbacks.find(entry.Id);
+    if (callback == m_callbacks.end())
+    {
+      return; // Cancelled.
+    }
+    if (entry.ExpiryTick <= tick)
+    {
+      expired.push_back(std::move(callback->second));
+      m_callbacks.erase(callback);
+    }
+    else
+    {
+      Insert(entry);
+    }
+  };
+
+  // Move the timers of the coarser wheels whose slot starts now down to the finer wheels. The
+  // coarsest wheel goes first, so its timers can move down more than one level at once.
+  for (size_t level = LevelCount - 1; level > 0; level--)
+  {
+    if ((tick & ((uint64_t(1) << (LevelBits * level)) - 1)) != 0)
+    {
+      continue;
+    }
+    Slot entries;
+    std::swap(entries, m_wheels[level][(tick >> (LevelBits * level)) & (SlotCount - 1)]);
+    for (auto const& entry : entries)
+    {
+      takeIfPending(entry);
+    }
+  }
+
+  Slot entries;
+  std::swap(entries, m_wheels[0][tick & (SlotCount - 1)]);
+  for (auto const& entry : entries)
+  {
+    takeIfPending(entry);
+  }
+}
+
+uint64_t TimerWheel::GetNextWakeUpTick() const
+{
+  // Either a slot of the finest wheel expires, or the next cascade is due when the finest wheel
+  // wraps around.
+  auto tick = m_currentTick + 1;
+  for (; (tick & (SlotCount - 1)) != 0; tick++)
+  {
+    if (!m_wheels[0][tick & (SlotCount - 1)].empty())
+    {
+      break;
+    }
+  }
+  return tick;
+}
+
+uint64_t TimerWheel::GetTick(std::chrono::steady_clock::time_point time) const
+{
+  return static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(time - m_start).count());
+}
+
+void TimerWheel::Run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_stopped)
+  {
+    if (m_callbacks.empty())
+    {
+      m_changed.wait(lock);
+      continue;
+    }
+
+    std::vector<std::function<void()>> expired;
+    auto const now = GetTick(std::chrono::steady_clock::now());
+    while (m_currentTick < now)
+    {
+      Advance(expired);
+    }
+
+    if (!expired.empty())
+    {
+      lock.unlock();
+      for (auto& callback : expired)
+      {
+        try
+        {
+          callback();
+        }
+        catch (...)
+        {
+        }
+      }
+      lock.lock();
+      continue;
+    }
+
+    m_changed.wait_until(lock, m_start + std::chrono::milliseconds(GetNextWakeUpTick()));
+  }
+}
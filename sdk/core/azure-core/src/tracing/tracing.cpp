@@ -125,6 +125,13 @@ namespace Azure { namespace Core { namespace Tracing { namespace _internal {
     return nullptr;
   }
 
+  TracingContextFactory const* TracingContextFactory::GetFromContext(
+      Azure::Core::Context const& context)
+  {
+    TracingContextFactory const* factory;
+    return context.TryGetValue(TracingFactoryContextKey, factory) ? factory : nullptr;
+  }
+
   Azure::Core::Context::Key TracingContextFactory::ContextSpanKey;
   Azure::Core::Context::Key TracingContextFactory::TracingFactoryContextKey;
 }}}} // namespace Azure::Core::Tracing::_internal
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/sdk/core/azure-core/test/libcurl-stress-test/libcurl_stress_test.cpp" "sdk/core/azure-core/test/libcurl-stress-test/CMakeFiles/azure-core-libcurl-stress-test.dir/libcurl_stress_test.cpp.o" "gcc" "sdk/core/azure-core/test/libcurl-stress-test/CMakeFiles/azure-core-libcurl-stress-test.dir/libcurl_stress_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/sdk/core/azure-core/CMakeFiles/azure-core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
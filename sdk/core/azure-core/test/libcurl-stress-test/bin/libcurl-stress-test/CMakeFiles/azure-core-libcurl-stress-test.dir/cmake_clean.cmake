@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/azure-core-libcurl-stress-test.dir/libcurl_stress_test.cpp.o"
+  "CMakeFiles/azure-core-libcurl-stress-test.dir/libcurl_stress_test.cpp.o.d"
+  "azure-core-libcurl-stress-test"
+  "azure-core-libcurl-stress-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/azure-core-libcurl-stress-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
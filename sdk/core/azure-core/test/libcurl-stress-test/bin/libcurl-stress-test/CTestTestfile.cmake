@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/sdk/core/azure-core/test/libcurl-stress-test
+# Build directory: /root/repo/_gate_build/sdk/core/azure-core/test/libcurl-stress-test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
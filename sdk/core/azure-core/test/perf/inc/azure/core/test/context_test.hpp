@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Test the Context component performance.
+ *
+ */
+
+#pragma once
+
+#include <azure/core.hpp>
+#include <azure/perf.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief Measure the cost of the Context operations made while sending a request.
+   */
+  class ContextTest : public Azure::Perf::PerfTest {
+    Azure::Core::Context::Key const m_firstKey;
+    Azure::Core::Context::Key const m_lastKey;
+    int m_depth{};
+    int m_checks{};
+
+  public:
+    /**
+     * @brief Construct a new Context test.
+     *
+     * @param options The test options.
+     */
+    ContextTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Read the test options.
+     *
+     */
+    void Setup() override
+    {
+      m_depth = m_options.GetOptionOrDefault("depth", 8);
+      m_checks = m_options.GetOptionOrDefault("checks", 64);
+    }
+
+    /**
+     * @brief Build a branch of contexts the way the pipeline does for a request, then check it for
+     * cancellation once per transferred chunk and look up values from both ends of the branch.
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      auto requestContext
+          = context.WithValue(m_firstKey, std::string("first"))
+                .WithDeadline(std::chrono::system_clock::now() + std::chrono::hours(1));
+      for (int i = 0; i < m_depth; ++i)
+      {
+        requestContext = requestContext.WithDeadline(
+            std::chrono::system_clock::now() + std::chrono::hours(2));
+      }
+      requestContext = requestContext.WithValue(m_lastKey, 42);
+
+      bool cancelled = false;
+      for (int i = 0; i < m_checks; ++i)
+      {
+        cancelled |= requestContext.IsCancelled();
+      }
+
+      std::string first;
+      int last{};
+      if (cancelled || !requestContext.TryGetValue(m_firstKey, first)
+          || !requestContext.TryGetValue(m_lastKey, last))
+      {
+        throw std::runtime_error("Unexpected context state.");
+      }
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"depth", {"--depth"}, "Number of deadline contexts between the values. Default 8.", 1},
+          {"checks", {"--checks"}, "Number of cancellation checks per request. Default 64.", 1}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "context",
+          "Measures the per-request overhead of creating and querying contexts",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::ContextTest>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Test the DateTime parsing and formatting performance.
+ *
+ */
+
+#pragma once
+
+#include <azure/core.hpp>
+#include <azure/perf.hpp>
+
+#include <memory>
+#include <string>
+
+namespace Azure { namespace Core { namespace Test {
+
+  /**
+   * @brief Measure the DateTime parsing and formatting performance.
+   */
+  class DateTimeTest : public Azure::Perf::PerfTest {
+    enum class Action
+    {
+      Parse,
+      Format
+    };
+
+    Action m_action;
+    Azure::DateTime::DateFormat m_format;
+    Azure::DateTime m_dateTime;
+    std::string m_dateTimeString;
+
+  public:
+    /**
+     * @brief Construct a new DateTimeTest test.
+     *
+     * @param options The test options.
+     */
+    DateTimeTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    void Setup() override
+    {
+      m_action = m_options.GetOptionOrDefault<std::string>("Action", "parse") == "parse"
+          ? Action::Parse
+          : Action::Format;
+      m_format = m_options.GetOptionOrDefault<std::string>("Format", "rfc1123") == "rfc1123"
+          ? Azure::DateTime::DateFormat::Rfc1123
+          : Azure::DateTime::DateFormat::Rfc3339;
+
+      m_dateTime = Azure::DateTime(2013, 11, 19, 14, 30, 59) + std::chrono::microseconds(123456);
+      m_dateTimeString = m_dateTime.ToString(m_format);
+    }
+
+    /**
+     * @brief Parse or format the date and time.
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      switch (m_action)
+      {
+        case Action::Parse: {
+          Azure::DateTime::Parse(m_dateTimeString, m_format);
+          break;
+        }
+        case Action::Format: {
+          m_dateTime.ToString(m_format);
+          break;
+        }
+      }
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Action", {"--action"}, "Parse/format, default parse", 1, false},
+          {"Format", {"--format"}, "Rfc1123/rfc3339, default rfc1123", 1, false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "datetime",
+          "Measures DateTime parse/format performance",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Core::Test::DateTimeTest>(options);
+          }};
+    }
+  };
+
+}}} // namespace Azure::Core::Test
@@ -20,6 +20,7 @@
 #endif
 
 #include <memory>
+#include <vector>
 
 namespace Azure { namespace Core { namespace Test {
 
@@ -31,6 +32,7 @@ namespace Azure { namespace Core { namespace Test {
     std::string m_target;
     std::shared_ptr<Azure::Core::Http::HttpTransport> m_transport;
     Azure::Core::Http::HttpMethod m_httpMethod = Azure::Core::Http::HttpMethod::Get;
+    size_t m_readSize = 0;
 
     void GetRequest() const
     {
@@ -38,7 +40,17 @@ namespace Azure { namespace Core { namespace Test {
       Azure::Core::Context context;
       auto response = m_transport->Send(httpRequest, context);
       // Make sure to pull all bytes from network.
-      auto body = response->ExtractBodyStream()->ReadToEnd();
+      if (m_readSize == 0)
+      {
+        auto body = response->ExtractBodyStream()->ReadToEnd();
+        return;
+      }
+      // Read the body the way a download would, to measure the receive path of the transport.
+      auto bodyStream = response->ExtractBodyStream();
+      std::vector<uint8_t> buffer(m_readSize);
+      while (bodyStream->Read(buffer.data(), buffer.size(), context) != 0)
+      {
+      }
     }
 
     void PostRequest() const
@@ -80,12 +92,21 @@ namespace Azure { namespace Core { namespace Test {
 
         Azure::Core::Http::CurlTransportOptions transportOptions;
         transportOptions.SslVerifyPeer = false;
+        transportOptions.ReceiveBufferSize = m_options.GetOptionOrDefault<size_t>(
+            "ReceiveBufferSize", transportOptions.ReceiveBufferSize);
         m_transport = std::make_shared<Azure::Core::Http::CurlTransport>(transportOptions);
       }
 #endif
       m_httpMethod
           = Azure::Core::Http::HttpMethod(m_options.GetMandatoryOption<std::string>("Method"));
 
+      m_readSize = m_options.GetOptionOrDefault<size_t>("ReadSize", 0);
+
+      m_target = m_options.GetOptionOrDefault<std::string>("Url", "");
+      if (!m_target.empty())
+      {
+        return;
+      }
       if (m_httpMethod == Azure::Core::Http::HttpMethod::Get)
       {
         m_target = GetTestProxy() + "/Admin/isAlive";
@@ -128,7 +149,22 @@ namespace Azure { namespace Core { namespace Test {
     {
       return {
           {"Method", {"--method"}, "The HTTP method e.g. GET, POST etc.", 1, true},
-          {"Transport", {"--transport"}, "The HTTP Transport curl/winhttp.", 1, true}};
+          {"Transport", {"--transport"}, "The HTTP Transport curl/winhttp.", 1, true},
+          {"Url",
+           {"--url"},
+           "The URL to send the requests to. Defaults to the test proxy.",
+           1,
+           false},
+          {"ReadSize",
+           {"--read-size"},
+           "The size of the buffer used to read GET response bodies. Defaults to ReadToEnd.",
+           1,
+           false},
+          {"ReceiveBufferSize",
+           {"--receive-buffer-size"},
+           "The size of the curl transport receive buffer. Defaults to 64KiB.",
+           1,
+           false}};
     }
 
     /**
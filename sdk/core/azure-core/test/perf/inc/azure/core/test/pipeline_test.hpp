@@ -17,6 +17,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <string>
 using namespace Azure::Core;
 using namespace Azure::Core::_internal;
 using namespace Azure::Core::Http;
@@ -43,12 +45,40 @@ namespace Azure { namespace Core { namespace Test {
     };
   };
 
+  /**
+   * @brief A transport that answers every request with an empty 200 response, so that the test
+   * measures the pipeline rather than the network.
+   */
+  class NoOpTransport final : public HttpTransport {
+  public:
+    std::unique_ptr<RawResponse> Send(Request&, Context const&) override
+    {
+      auto response = std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "OK");
+      response->SetBodyStream(std::make_unique<Azure::Core::IO::MemoryBodyStream>(nullptr, 0));
+      return response;
+    }
+  };
+
   /**
    * @brief Measure the http pipeline / policies performance.
    */
   class PipelineTest : public Azure::Perf::PerfTest {
     std::unique_ptr<HttpPipeline> m_pipeline;
 
+    // Stands in for a log sink, such as a file.
+    static void LogListener(Azure::Core::Diagnostics::Logger::Level, std::string const& message)
+    {
+      static std::mutex logMutex;
+      static std::string log;
+      std::lock_guard<std::mutex> lock(logMutex);
+      if (log.size() > 1024 * 1024)
+      {
+        log.clear();
+      }
+      log += message;
+      log += '\n';
+    }
+
   public:
     /**
      * @brief Construct a new PipelineTest test.
@@ -57,6 +87,28 @@ namespace Azure { namespace Core { namespace Test {
      */
     PipelineTest(Azure::Perf::TestOptions options) : PerfTest(options) {}
 
+    void GlobalSetup() override
+    {
+      using Azure::Core::Diagnostics::Logger;
+      auto const logging = m_options.GetOptionOrDefault<std::string>("Logging", "off");
+      if (logging != "off")
+      {
+        Logger::SetListener(LogListener);
+        Logger::SetLevel(Logger::Level::Verbose);
+      }
+      if (logging == "async")
+      {
+        Logger::EnableAsynchronousLogging({});
+      }
+    }
+
+    void GlobalCleanup() override
+    {
+      using Azure::Core::Diagnostics::Logger;
+      Logger::DisableAsynchronousLogging();
+      Logger::SetListener(nullptr);
+    }
+
     void Setup() override
     {
       const std::string packageName = "test";
@@ -118,8 +170,13 @@ namespace Azure { namespace Core { namespace Test {
         }
       }
 
+      ClientOptions clientOptions;
+      if (m_options.GetOptionOrDefault<std::string>("Transport", "default") == "none")
+      {
+        clientOptions.Transport.Transport = std::make_shared<NoOpTransport>();
+      }
       m_pipeline = std::make_unique<HttpPipeline>(
-          ClientOptions(), packageName, packageVersion, std::move(policies), std::move(policies2));
+          clientOptions, packageName, packageVersion, std::move(policies), std::move(policies2));
     }
 
     /**
@@ -156,6 +213,21 @@ namespace Azure { namespace Core { namespace Test {
            "default:TestPolicy \n others: "
            "RetryPolicy,RequestIdPolicy,RequestActivityPolicy,TelemetryPolicy,LogPolicy",
            1,
+           false},
+          {"Transport",
+           {"--transport"},
+           "The transport to send the requests with.\n"
+           "default: the default transport, sending to 127.0.0.1:5000 \n"
+           "none: a transport that doesn't send the requests and returns an empty response",
+           1,
+           false},
+          {"Logging",
+           {"--logging"},
+           "How the messages of the LogPolicy are logged.\n"
+           "off: logging is disabled (default) \n"
+           "sync: the listener is called on the request thread \n"
+           "async: the listener is called on the background logging thread",
+           1,
            false}};
     }
 
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation.
 // Licensed under the MIT License.
 
+#include "azure/core/test/context_test.hpp"
+#include "azure/core/test/datetime_test.hpp"
 #include "azure/core/test/delay_test.hpp"
 #include "azure/core/test/exception_test.hpp"
 #include "azure/core/test/extended_options_test.hpp"
@@ -20,6 +22,8 @@ int main(int argc, char** argv)
 
   // Create the test list
   std::vector<Azure::Perf::TestMetadata> tests{
+      Azure::Core::Test::ContextTest::GetTestMetadata(),
+      Azure::Core::Test::DateTimeTest::GetTestMetadata(),
       Azure::Core::Test::DelayTest::GetTestMetadata(),
       Azure::Core::Test::ExceptionTest::GetTestMetadata(),
       Azure::Core::Test::ExtendedOptionsTest::GetTestMetadata(),
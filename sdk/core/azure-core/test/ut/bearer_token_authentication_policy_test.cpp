@@ -5,9 +5,15 @@
 #include <azure/core/http/policies/policy.hpp>
 #include <azure/core/internal/http/pipeline.hpp>
 
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 using Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicy;
+using Azure::Core::Http::Policies::_internal::BearerTokenAuthenticationPolicyOptions;
 
 using Azure::Core::Context;
 using Azure::Core::Url;
@@ -301,6 +307,207 @@ TEST(BearerTokenAuthenticationPolicy, RefreshAfterExpiry)
   }
 }
 
+namespace {
+// Returns "ACCESSTOKEN1", "ACCESSTOKEN2", ... which expire after the given lifetime. The calls after
+// the first one wait for the gate to open.
+class CountingTokenCredential final : public TokenCredential {
+  std::chrono::milliseconds m_lifetime;
+  std::shared_future<void> m_gate;
+
+public:
+  mutable std::atomic<int> Calls{0};
+
+  CountingTokenCredential(std::chrono::milliseconds lifetime, std::shared_future<void> gate)
+      : TokenCredential("CountingTokenCredential"), m_lifetime(lifetime), m_gate(std::move(gate))
+  {
+  }
+
+  AccessToken GetToken(TokenRequestContext const&, Context const&) const override
+  {
+    auto const call = ++Calls;
+    if (call > 1)
+    {
+      m_gate.wait();
+    }
+    return {"ACCESSTOKEN" + std::to_string(call), std::chrono::system_clock::now() + m_lifetime};
+  }
+};
+
+// Returns the token it issued last while it is valid for the minimum expiration requested, like
+// the token caches of the identity credentials.
+class CachingTokenCredential final : public TokenCredential {
+  std::chrono::milliseconds m_lifetime;
+  mutable std::mutex m_mutex;
+  mutable AccessToken m_token;
+
+public:
+  mutable std::atomic<int> Issued{0};
+
+  explicit CachingTokenCredential(std::chrono::milliseconds lifetime)
+      : TokenCredential("CachingTokenCredential"), m_lifetime(lifetime)
+  {
+  }
+
+  AccessToken GetToken(TokenRequestContext const& tokenRequestContext, Context const&)
+      const override
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const now = std::chrono::system_clock::now();
+    auto const remaining = m_token.ExpiresOn - Azure::DateTime(now);
+    if (Issued == 0 || remaining <= tokenRequestContext.MinimumExpiration)
+    {
+      m_token = {"ACCESSTOKEN" + std::to_string(++Issued), now + m_lifetime};
+    }
+    return m_token;
+  }
+};
+
+std::string SendAndGetAuthorization(HttpPipeline& pipeline)
+{
+  Request request(HttpMethod::Get, Url("https://www.azure.com"));
+  pipeline.Send(request, Context());
+  return request.GetHeaders().at("authorization");
+}
+} // namespace
+
+TEST(BearerTokenAuthenticationPolicy, BackgroundRefresh)
+{
+  using namespace std::chrono_literals;
+  std::promise<void> gate;
+  auto credential = std::make_shared<CountingTokenCredential>(2s, gate.get_future().share());
+  gate.set_value();
+
+  TokenRequestContext tokenRequestContext;
+  tokenRequestContext.Scopes = {"https://microsoft.com/.default"};
+  tokenRequestContext.MinimumExpiration = 0s;
+
+  BearerTokenAuthenticationPolicyOptions options;
+  options.BackgroundRefreshRatio = 0.25;
+
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<BearerTokenAuthenticationPolicy>(
+      credential, tokenRequestContext, options));
+  policies.emplace_back(std::make_unique<TestTransportPolicy>());
+  HttpPipeline pipeline(policies);
+
+  EXPECT_EQ(SendAndGetAuthorization(pipeline), "Bearer ACCESSTOKEN1");
+  EXPECT_EQ(credential->Calls, 1);
+
+  // The token is renewed after a quarter of its lifetime, without any request.
+  for (int i = 0; i < 300 && credential->Calls < 2; i++)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_GE(credential->Calls, 2);
+  std::this_thread::sleep_for(50ms);
+
+  EXPECT_NE(SendAndGetAuthorization(pipeline), "Bearer ACCESSTOKEN1");
+}
+
+TEST(BearerTokenAuthenticationPolicy, BackgroundRefreshBypassesCredentialCache)
+{
+  using namespace std::chrono_literals;
+  auto credential = std::make_shared<CachingTokenCredential>(2s);
+
+  TokenRequestContext tokenRequestContext;
+  tokenRequestContext.Scopes = {"https://microsoft.com/.default"};
+  tokenRequestContext.MinimumExpiration = 0s;
+
+  BearerTokenAuthenticationPolicyOptions options;
+  options.BackgroundRefreshRatio = 0.25;
+
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<BearerTokenAuthenticationPolicy>(
+      credential, tokenRequestContext, options));
+  policies.emplace_back(std::make_unique<TestTransportPolicy>());
+  HttpPipeline pipeline(policies);
+
+  EXPECT_EQ(SendAndGetAuthorization(pipeline), "Bearer ACCESSTOKEN1");
+
+  // The credential still has a valid token cached, but the background refresh gets a new one.
+  for (int i = 0; i < 300 && credential->Issued < 2; i++)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_GE(credential->Issued, 2);
+  std::this_thread::sleep_for(50ms);
+  EXPECT_NE(SendAndGetAuthorization(pipeline), "Bearer ACCESSTOKEN1");
+}
+
+TEST(BearerTokenAuthenticationPolicy, BackgroundRefreshOutlivesPolicy)
+{
+  using namespace std::chrono_literals;
+  std::promise<void> gate;
+  auto credential = std::make_shared<CountingTokenCredential>(2s, gate.get_future().share());
+
+  TokenRequestContext tokenRequestContext;
+  tokenRequestContext.Scopes = {"https://microsoft.com/.default"};
+  tokenRequestContext.MinimumExpiration = 0s;
+
+  BearerTokenAuthenticationPolicyOptions options;
+  options.BackgroundRefreshRatio = 0.1;
+
+  {
+    std::vector<std::unique_ptr<HttpPolicy>> policies;
+    policies.emplace_back(std::make_unique<BearerTokenAuthenticationPolicy>(
+        credential, tokenRequestContext, options));
+    policies.emplace_back(std::make_unique<TestTransportPolicy>());
+    HttpPipeline pipeline(policies);
+    EXPECT_EQ(SendAndGetAuthorization(pipeline), "Bearer ACCESSTOKEN1");
+
+    for (int i = 0; i < 300 && credential->Calls < 2; i++)
+    {
+      std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_EQ(credential->Calls, 2);
+  }
+
+  // The refresh finishes after the policy is gone, and then releases the token state itself.
+  gate.set_value();
+  std::this_thread::sleep_for(50ms);
+  EXPECT_EQ(credential->Calls, 2);
+}
+
+TEST(BearerTokenAuthenticationPolicy, BackgroundRefreshDoesNotBlockRequests)
+{
+  using namespace std::chrono_literals;
+  std::promise<void> gate;
+  auto credential = std::make_shared<CountingTokenCredential>(2s, gate.get_future().share());
+
+  TokenRequestContext tokenRequestContext;
+  tokenRequestContext.Scopes = {"https://microsoft.com/.default"};
+  tokenRequestContext.MinimumExpiration = 0s;
+
+  BearerTokenAuthenticationPolicyOptions options;
+  options.BackgroundRefreshRatio = 0.1;
+
+  std::vector<std::unique_ptr<HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<BearerTokenAuthenticationPolicy>(
+      credential, tokenRequestContext, options));
+  policies.emplace_back(std::make_unique<TestTransportPolicy>());
+  HttpPipeline pipeline(policies);
+
+  EXPECT_EQ(SendAndGetAuthorization(pipeline), "Bearer ACCESSTOKEN1");
+
+  // Wait for the background refresh to start, which then waits for the gate.
+  for (int i = 0; i < 300 && credential->Calls < 2; i++)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_EQ(credential->Calls, 2);
+
+  // Requests keep using the cached token while it is being renewed.
+  EXPECT_EQ(SendAndGetAuthorization(pipeline), "Bearer ACCESSTOKEN1");
+  EXPECT_EQ(SendAndGetAuthorization(pipeline), "Bearer ACCESSTOKEN1");
+
+  gate.set_value();
+  for (int i = 0; i < 300 && SendAndGetAuthorization(pipeline) == "Bearer ACCESSTOKEN1"; i++)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_EQ(SendAndGetAuthorization(pipeline), "Bearer ACCESSTOKEN2");
+}
+
 TEST(BearerTokenAuthenticationPolicy, NonHttps)
 {
   using namespace std::chrono_literals;
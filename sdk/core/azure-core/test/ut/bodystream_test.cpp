@@ -3,7 +3,9 @@
 
 #include <azure/core/platform.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 #if defined(AZ_PLATFORM_POSIX)
 #include <fcntl.h>
@@ -17,6 +19,7 @@
 #include <windows.h>
 #endif
 
+#include <azure/core/http/raw_response.hpp>
 #include <azure/core/io/body_stream.hpp>
 
 #include <gtest/gtest.h>
@@ -30,6 +33,114 @@ class TestBodyStream final : public BodyStream {
   int64_t Length() const override { return 0; }
 };
 
+// A stream over some bytes, which reports a length which may differ from the number of bytes,
+// like the body of an HTTP response to a HEAD request or a chunked HTTP response.
+class ReportedLengthBodyStream final : public BodyStream {
+  MemoryBodyStream m_stream;
+  int64_t m_reportedLength;
+
+  size_t OnRead(uint8_t* buffer, size_t count, Context const& context) override
+  {
+    // Return few bytes at a time, as a network stream would.
+    return m_stream.Read(buffer, (std::min)(count, size_t(1000)), context);
+  }
+
+public:
+  ReportedLengthBodyStream(std::vector<uint8_t> const& data, int64_t reportedLength)
+      : m_stream(data), m_reportedLength(reportedLength)
+  {
+  }
+  int64_t Length() const override { return m_reportedLength; }
+};
+
+TEST(BodyStream, ReadToEnd)
+{
+  for (size_t size : {size_t(0), size_t(1), size_t(1000), size_t(8192), size_t(100000)})
+  {
+    std::vector<uint8_t> data(size);
+    for (size_t index = 0; index < size; ++index)
+    {
+      data[index] = static_cast<uint8_t>(index * 7);
+    }
+    auto const length = static_cast<int64_t>(size);
+    for (int64_t reportedLength : {length, int64_t(-1), int64_t(0), length / 2, length * 2})
+    {
+      ReportedLengthBodyStream stream(data, reportedLength);
+      EXPECT_EQ(stream.ReadToEnd(), data) << "size " << size << ", length " << reportedLength;
+    }
+  }
+}
+
+TEST(BodyStream, ReadToEndReusesResponseBodies)
+{
+  std::vector<uint8_t> const data(3000, 1);
+  // Take the buffers which the thread may have cached already.
+  std::vector<std::vector<uint8_t>> held;
+  for (int i = 0; i < 8; ++i)
+  {
+    MemoryBodyStream stream(data);
+    held.push_back(stream.ReadToEnd());
+  }
+
+  uint8_t const* releasedBody = nullptr;
+  {
+    Azure::Core::Http::RawResponse response(1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+    MemoryBodyStream stream(data);
+    response.SetBody(stream.ReadToEnd());
+    releasedBody = response.GetBody().data();
+  }
+
+  MemoryBodyStream stream(data);
+  auto const body = stream.ReadToEnd();
+  EXPECT_EQ(body, data);
+  EXPECT_EQ(body.data(), releasedBody);
+}
+
+// Records whether the bytes it is asked to read into still hold a given value.
+class ObservingBodyStream final : public BodyStream {
+  MemoryBodyStream m_stream;
+  uint8_t m_staleValue;
+
+  size_t OnRead(uint8_t* buffer, size_t count, Context const& context) override
+  {
+    ReadIntoStaleBytes = ReadIntoStaleBytes
+        || std::all_of(buffer, buffer + count, [&](uint8_t b) { return b == m_staleValue; });
+    return m_stream.Read(buffer, count, context);
+  }
+
+public:
+  bool ReadIntoStaleBytes = false;
+
+  ObservingBodyStream(std::vector<uint8_t> const& data, uint8_t staleValue)
+      : m_stream(data), m_staleValue(staleValue)
+  {
+  }
+  int64_t Length() const override { return m_stream.Length(); }
+};
+
+TEST(BodyStream, ReadToEndDoesNotZeroFillRecycledBodies)
+{
+  // Take the buffers which the thread may have cached already.
+  std::vector<uint8_t> const data(3000, 1);
+  std::vector<std::vector<uint8_t>> held;
+  for (int i = 0; i < 8; ++i)
+  {
+    MemoryBodyStream stream(data);
+    held.push_back(stream.ReadToEnd());
+  }
+
+  {
+    Azure::Core::Http::RawResponse response(1, 1, Azure::Core::Http::HttpStatusCode::Ok, "OK");
+    std::vector<uint8_t> const released(3000, 0xAB);
+    MemoryBodyStream stream(released);
+    response.SetBody(stream.ReadToEnd());
+  }
+
+  ObservingBodyStream stream(data, 0xAB);
+  EXPECT_EQ(stream.ReadToEnd(), data);
+  EXPECT_TRUE(stream.ReadIntoStaleBytes);
+}
+
 TEST(BodyStream, Rewind)
 {
   TestBodyStream tb;
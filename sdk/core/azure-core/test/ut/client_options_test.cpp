@@ -74,12 +74,15 @@ TEST(ClientOptions, copyWithOperator)
   options.Transport.Transport = std::make_shared<FakeTransport>();
   options.PerOperationPolicies.emplace_back(std::make_unique<PerCallPolicy>());
   options.PerRetryPolicies.emplace_back(std::make_unique<PerRetryPolicy>());
+  options.RetryBudget = std::make_shared<RetryBudget>();
 
   // Now Copy
   ClientOptions copyOptions = options;
 
   // Compare
   EXPECT_EQ(1, copyOptions.Retry.MaxRetries);
+  // The budget is shared by the copies, not copied.
+  EXPECT_EQ(options.RetryBudget, copyOptions.RetryBudget);
   EXPECT_EQ(std::string("pleaseCopyMe"), copyOptions.Telemetry.ApplicationId);
   Request r(HttpMethod::Get, Url(""));
   auto result = copyOptions.Transport.Transport->Send(r, Context{});
@@ -103,12 +106,15 @@ TEST(ClientOptions, copyWithConstructor)
   options.Transport.Transport = std::make_shared<FakeTransport>();
   options.PerOperationPolicies.emplace_back(std::make_unique<PerCallPolicy>());
   options.PerRetryPolicies.emplace_back(std::make_unique<PerRetryPolicy>());
+  options.RetryBudget = std::make_shared<RetryBudget>();
 
   // Now Copy
   ClientOptions copyOptions(options);
 
   // Compare
   EXPECT_EQ(1, copyOptions.Retry.MaxRetries);
+  // The budget is shared by the copies, not copied.
+  EXPECT_EQ(options.RetryBudget, copyOptions.RetryBudget);
   EXPECT_EQ(std::string("pleaseCopyMe"), copyOptions.Telemetry.ApplicationId);
   Request r(HttpMethod::Get, Url(""));
   auto result = copyOptions.Transport.Transport->Send(r, Context{});
@@ -3,6 +3,7 @@
 
 #include "azure/core/context.hpp"
 
+#include <atomic>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -436,6 +437,74 @@ TEST(Context, Deadline)
   }
 }
 
+TEST(Context, CancelAfterCheck)
+{
+  // Children that have already checked their parents for cancellation must still observe a
+  // parent that is cancelled later.
+  Context root;
+  Context::Key const key;
+  auto middle = root.WithValue(key, 1);
+  auto child = middle.WithDeadline((Azure::DateTime::max)());
+  auto sibling = root.WithDeadline((Azure::DateTime::max)());
+  EXPECT_FALSE(child.IsCancelled());
+  EXPECT_FALSE(child.IsCancelled());
+  EXPECT_FALSE(sibling.IsCancelled());
+
+  // Cancelling an unrelated context doesn't cancel the branch.
+  Context unrelated;
+  unrelated.Cancel();
+  EXPECT_FALSE(child.IsCancelled());
+
+  middle.Cancel();
+  EXPECT_TRUE(child.IsCancelled());
+  EXPECT_EQ(child.GetDeadline(), Azure::DateTime::min());
+  EXPECT_TRUE(middle.IsCancelled());
+  EXPECT_FALSE(root.IsCancelled());
+  EXPECT_FALSE(sibling.IsCancelled());
+
+  int value{};
+  EXPECT_TRUE(child.TryGetValue(key, value));
+  EXPECT_EQ(value, 1);
+
+  root.Cancel();
+  EXPECT_TRUE(sibling.IsCancelled());
+}
+
+TEST(Context, EarliestDeadlineInBranch)
+{
+  auto const early = Azure::DateTime(2021, 4, 1, 23, 45, 15);
+  auto const late = Azure::DateTime(2031, 4, 1, 23, 45, 15);
+  Context::Key const key;
+
+  Context root;
+  auto child = root.WithDeadline(early).WithValue(key, 1).WithDeadline(late);
+  EXPECT_EQ(child.GetDeadline(), early);
+  EXPECT_TRUE(child.IsCancelled());
+
+  auto other = root.WithDeadline(late).WithValue(key, 2);
+  EXPECT_EQ(other.GetDeadline(), late);
+  EXPECT_FALSE(other.IsCancelled());
+}
+
+TEST(Context, ConcurrentCancel)
+{
+  Context root;
+  auto child = root.WithDeadline((Azure::DateTime::max)());
+  std::atomic<bool> observed{false};
+
+  std::thread checker([&]() {
+    while (!child.IsCancelled())
+    {
+      std::this_thread::yield();
+    }
+    observed = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  root.Cancel();
+  checker.join();
+  EXPECT_TRUE(observed);
+}
+
 #if defined(AZ_CORE_RTTI) && GTEST_HAS_DEATH_TEST
 TEST(Context, PreCondition)
 {
@@ -45,11 +45,9 @@ namespace Azure { namespace Core { namespace Test {
     TEST(CurlConnectionPool, connectionPoolTest)
     {
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
         // Make sure there are nothing in the pool
-        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size(), 0);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.HostCount(), 0);
       }
 
       // Use the same request for all connections.
@@ -77,18 +75,13 @@ namespace Azure { namespace Core { namespace Test {
       }
       // Check that after the connection is gone, it is moved back to the pool
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
             1);
-        auto connectionFromPool
-            = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.begin()
-                  ->second.begin()
-                  ->get();
-        EXPECT_EQ(connectionFromPool->GetConnectionKey(), expectedConnectionKey);
       }
 
       // Test that asking a connection with same config will re-use the same connection
@@ -100,8 +93,7 @@ namespace Azure { namespace Core { namespace Test {
 
         // There was just one connection in the pool, it should be empty now
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             0);
         // And the connection key for the connection we got is the expected
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
@@ -114,17 +106,14 @@ namespace Azure { namespace Core { namespace Test {
         session->m_httpKeepAlive = true;
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Check that after the connection is gone, it is moved back to the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
             1);
-        auto values = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                          .ConnectionPoolIndex.begin();
-        EXPECT_EQ(values->second.size(), 1);
-        EXPECT_EQ(values->second.begin()->get()->GetConnectionKey(), expectedConnectionKey);
       }
 
       // Now test that using a different connection config won't re-use the same connection
@@ -141,16 +130,12 @@ namespace Azure { namespace Core { namespace Test {
         // One connection still in the pool after getting a new connection and with first expected
         // key
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .begin()
-                ->second.begin()
-                ->get()
-                ->GetConnectionKey(),
-            expectedConnectionKey);
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
+            1);
 
         auto session
             = std::make_unique<Azure::Core::Http::CurlSession>(req, std::move(connection), options);
@@ -162,28 +147,18 @@ namespace Azure { namespace Core { namespace Test {
 
       // Now there should be 2 index wit one connection each
       EXPECT_EQ(
-          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-              .size(),
+          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
           2);
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        for (auto& val : Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                             .ConnectionPoolIndex)
-        {
-          EXPECT_EQ(val.second.size(), 1);
-        }
         // The connection pool should have the two connections we added earlier.
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(expectedConnectionKey));
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(secondExpectedKey));
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                secondExpectedKey),
+            1);
       }
 
       {
@@ -206,16 +181,12 @@ namespace Azure { namespace Core { namespace Test {
         // One connection still in the pool after getting a new connection and with first expected
         // key
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .begin()
-                ->second.begin()
-                ->get()
-                ->GetConnectionKey(),
-            secondExpectedKey);
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                secondExpectedKey),
+            1);
 
         auto session
             = std::make_unique<Azure::Core::Http::CurlSession>(req, std::move(connection), options);
@@ -226,45 +197,30 @@ namespace Azure { namespace Core { namespace Test {
       }
       // Now there should be 2 index wit one connection each
       EXPECT_EQ(
-          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-              .size(),
+          Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
           2);
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        for (auto& val : Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                             .ConnectionPoolIndex)
-        {
-          EXPECT_EQ(val.second.size(), 1);
-        }
         // The connection pool should have the two connections we added earlier.
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(expectedConnectionKey));
-        EXPECT_NE(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .end(),
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .find(secondExpectedKey));
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
+            1);
+        EXPECT_EQ(
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                secondExpectedKey),
+            1);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // clean the pool
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
       }
 
 #ifdef RUN_LONG_UNIT_TESTS
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // clean the pool
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             0);
       }
 
@@ -291,16 +247,12 @@ namespace Azure { namespace Core { namespace Test {
       }
 
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             1);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                .ConnectionPoolIndex[expectedConnectionKey]
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(
+                expectedConnectionKey),
             5);
       }
 
@@ -318,10 +270,8 @@ namespace Azure { namespace Core { namespace Test {
           std::this_thread::sleep_for(10ms);
           // If test wakes while clean pool is running, it will wait until lock is released by
           // the clean pool thread.
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-          poolIsEmpty = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                            .ConnectionPoolIndex.size()
+          poolIsEmpty
+              = Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount()
               == 0;
         }
         EXPECT_TRUE(poolIsEmpty);
@@ -339,7 +289,7 @@ namespace Azure { namespace Core { namespace Test {
       //       std::lock_guard<std::mutex> lock(
       //           CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
       //       // clean the pool
-      //       CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+      //       CurlConnectionPool::g_curlConnectionPool.Clear();
       //     }
 
       //     std::string hostKey("key");
@@ -414,7 +364,7 @@ namespace Azure { namespace Core { namespace Test {
       //       std::lock_guard<std::mutex> lock(
       //           CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
       //       // clean the pool
-      //       CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+      //       CurlConnectionPool::g_curlConnectionPool.Clear();
       //     }
       //   }
     }
@@ -422,14 +372,10 @@ namespace Azure { namespace Core { namespace Test {
     TEST(CurlConnectionPool, uniquePort)
     {
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .clear();
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
         // Make sure there is nothing in the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             0);
       }
 
@@ -448,11 +394,8 @@ namespace Azure { namespace Core { namespace Test {
                               .ExtractOrCreateCurlConnection(req, {});
 
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
               0);
           EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         }
@@ -462,12 +405,9 @@ namespace Azure { namespace Core { namespace Test {
       }
 
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Test connection was moved to the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             1);
       }
 
@@ -487,12 +427,9 @@ namespace Azure { namespace Core { namespace Test {
 
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           // Check connection in pool is not re-used because the port is different
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
               1);
         }
         // move connection back to the pool
@@ -500,12 +437,9 @@ namespace Azure { namespace Core { namespace Test {
             .MoveConnectionBackToPool(std::move(connection), true);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         // Check 2 connections in the pool
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             2);
       }
 
@@ -525,11 +459,8 @@ namespace Azure { namespace Core { namespace Test {
                               .ExtractOrCreateCurlConnection(req, {});
 
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
               1);
         }
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
@@ -540,11 +471,8 @@ namespace Azure { namespace Core { namespace Test {
 
       {
         // Make sure there is nothing in the pool
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             2);
       }
       {
@@ -563,12 +491,9 @@ namespace Azure { namespace Core { namespace Test {
 
         EXPECT_EQ(connection->GetConnectionKey(), expectedConnectionKey);
         {
-          std::lock_guard<std::mutex> lock(
-              CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
           // Check connection in pool is not re-used because the port is different
           EXPECT_EQ(
-              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool
-                  .ConnectionPoolIndex.size(),
+              Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
               1);
         }
         // move connection back to the pool
@@ -576,14 +501,10 @@ namespace Azure { namespace Core { namespace Test {
             .MoveConnectionBackToPool(std::move(connection), true);
       }
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             2);
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .clear();
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
       }
     }
 
@@ -635,11 +556,9 @@ namespace Azure { namespace Core { namespace Test {
       /// When getting the header connection: close from an HTTP response, the connection should not
       /// be moved back to the pool.
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
-        CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.clear();
+        CurlConnectionPool::g_curlConnectionPool.Clear();
         // Make sure there are nothing in the pool
-        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex.size(), 0);
+        EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.HostCount(), 0);
       }
 
       // Use the same request for all connections.
@@ -662,13 +581,143 @@ namespace Azure { namespace Core { namespace Test {
 
       // Check that after the connection is gone, it is moved back to the pool
       {
-        std::lock_guard<std::mutex> lock(
-            CurlConnectionPool::g_curlConnectionPool.ConnectionPoolMutex);
         EXPECT_EQ(
-            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-                .size(),
+            Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
             0);
       }
     }
+
+    TEST(CurlConnectionPool, prewarmConnections)
+    {
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+
+      Azure::Core::Http::CurlTransportOptions options;
+      options.MaxIdleConnectionsPerHost = 3;
+      Azure::Core::Http::CurlTransport transport(options);
+      transport.PrewarmConnections(Azure::Core::Url(AzureSdkHttpbinServer::Get()), 5);
+
+      std::string const expectedConnectionKey(CreateConnectionKey(
+          AzureSdkHttpbinServer::Schema(),
+          AzureSdkHttpbinServer::Host(),
+          ",0,0,0,0,0,1,1,0,0,0,0"));
+      // Only MaxIdleConnectionsPerHost connections are kept.
+      EXPECT_EQ(
+          CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(expectedConnectionKey), 3);
+
+      // The next request re-uses a connection from the pool.
+      Azure::Core::Http::Request req(
+          Azure::Core::Http::HttpMethod::Get, Azure::Core::Url(AzureSdkHttpbinServer::Get()));
+      auto connection
+          = CurlConnectionPool::g_curlConnectionPool.ExtractOrCreateCurlConnection(req, options);
+      EXPECT_EQ(
+          CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(expectedConnectionKey), 2);
+
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+    }
+
+    TEST(CurlConnectionPool, maxIdleConnectionsPerHost)
+    {
+      using ::testing::Return;
+      using ::testing::ReturnRef;
+
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+
+      std::string const hostKey("maxIdleHostKey");
+      std::string const otherKey("maxIdleOtherHostKey");
+      auto moveMockToPool = [](std::string const& key, size_t maxIdleConnections) {
+        MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+        EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(key));
+        EXPECT_CALL(*curlMock, UpdateLastUsageTime()).WillRepeatedly(Return());
+        EXPECT_CALL(*curlMock, IsExpired()).WillRepeatedly(Return(false));
+        EXPECT_CALL(*curlMock, DestructObj());
+        CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(
+            std::unique_ptr<MockCurlNetworkConnection>(curlMock), true, maxIdleConnections);
+      };
+
+      for (int count = 0; count < 10; count++)
+      {
+        moveMockToPool(hostKey, 4);
+      }
+      // The oldest connections are closed once the host has 4 idle connections.
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(hostKey), 4);
+
+      // The limit applies to each host.
+      moveMockToPool(otherKey, 4);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.HostCount(), 2);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(otherKey), 1);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(hostKey), 4);
+
+      // No connection is kept when the limit is 0.
+      moveMockToPool(otherKey, 0);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(otherKey), 1);
+
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.HostCount(), 0);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(hostKey), 0);
+    }
+
+    TEST(CurlConnectionPool, minIdleConnectionsPerHost)
+    {
+      using ::testing::Return;
+      using ::testing::ReturnRef;
+
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+
+      std::string const hostKey("minIdleHostKey");
+      auto makeMock = [&hostKey](bool expired) {
+        auto curlMock = std::make_unique<MockCurlNetworkConnection>();
+        EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(hostKey));
+        EXPECT_CALL(*curlMock, UpdateLastUsageTime()).WillRepeatedly(Return());
+        EXPECT_CALL(*curlMock, IsExpired()).WillRepeatedly(Return(expired));
+        EXPECT_CALL(*curlMock, DestructObj());
+        return curlMock;
+      };
+
+      size_t opened = 0;
+      auto openConnection = [&]() -> std::unique_ptr<Azure::Core::Http::CurlNetworkConnection> {
+        ++opened;
+        return makeMock(false);
+      };
+      CurlConnectionPool::g_curlConnectionPool.SetMinIdleConnections(
+          hostKey, 2, 10, openConnection);
+      // Transports sharing the host don't lower the minimum.
+      CurlConnectionPool::g_curlConnectionPool.SetMinIdleConnections(
+          hostKey, 1, 10, openConnection);
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.GetMinIdleConnections(hostKey), 2);
+
+      for (int count = 0; count < 3; count++)
+      {
+        CurlConnectionPool::g_curlConnectionPool.MoveConnectionBackToPool(makeMock(true), true);
+      }
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(hostKey), 3);
+
+      // The expired connections are all closed, even under the minimum, and only the ones needed
+      // to keep the minimum are replaced by new connections.
+      CurlConnectionPool::g_curlConnectionPool.CloseExpiredConnections();
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(hostKey), 2);
+      EXPECT_EQ(opened, 2);
+
+      // Connections which haven't expired are kept as they are.
+      CurlConnectionPool::g_curlConnectionPool.CloseExpiredConnections();
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.ConnectionsOnPool(hostKey), 2);
+      EXPECT_EQ(opened, 2);
+
+      CurlConnectionPool::g_curlConnectionPool.Clear();
+      EXPECT_EQ(CurlConnectionPool::g_curlConnectionPool.GetMinIdleConnections(hostKey), 0);
+    }
+
+    TEST(CurlConnectionPool, connectionKeySuffix)
+    {
+      Azure::Core::Http::CurlTransportOptions options;
+      EXPECT_EQ(CurlConnectionPool::GetConnectionKeySuffix(options), ",0,0,0,0,0,1,1,0,0,0,0");
+
+      options.SslVerifyPeer = false;
+      options.ConnectionTimeout = std::chrono::seconds(200);
+      // The pool limits don't prevent connections from being shared.
+      options.MaxIdleConnectionsPerHost = 1;
+      options.MinIdleConnectionsPerHost = 1;
+      EXPECT_EQ(
+          CurlConnectionPool::GetConnectionKeySuffix(options), ",0,0,0,0,0,1,0,0,0,0,200000");
+    }
 #endif
 }}} // namespace Azure::Core::Test
@@ -9,8 +9,12 @@
 #include <http/curl/curl_connection_private.hpp>
 #include <http/curl/curl_session_private.hpp>
 
+#include <algorithm>
+#include <string>
+
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::Return;
 using ::testing::ReturnRef;
 using ::testing::SetArrayArgument;
@@ -86,8 +90,7 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
   }
 
   TEST_F(CurlSession, chunkBadFormatResponse)
@@ -137,8 +140,7 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_THROW(bodyS->ReadToEnd(Azure::Core::Context{}), Azure::Core::Http::TransportException);
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
   }
 
   TEST_F(CurlSession, invalidHeader)
@@ -317,14 +319,110 @@ namespace Azure { namespace Core { namespace Test {
       EXPECT_NO_THROW(bodyS->ReadToEnd(Azure::Core::Context{}));
     }
     // Clear the connections from the pool to invoke clean routine
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+  TEST_F(CurlSession, smallReadsAreBuffered)
+  {
+    std::string response("HTTP/1.1 200 Ok\r\ncontent-length: 10\r\n\r\n");
+    std::string body("0123456789");
+    std::string connectionKey("connection-key");
+    int32_t const payloadSize = static_cast<int32_t>(response.size());
+    int32_t const bodySize = static_cast<int32_t>(body.size());
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    // The whole body is received at once and then read one byte at a time from the session
+    // buffer.
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(response.data(), response.data() + payloadSize),
+            Return(payloadSize)))
+        .WillOnce(DoAll(
+            SetArrayArgument<0>(body.data(), body.data() + bodySize), Return(bodySize)));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
+      std::string received;
+      uint8_t byte = 0;
+      while (session->Read(&byte, 1, Azure::Core::Context{}) == 1)
+      {
+        received.push_back(static_cast<char>(byte));
+      }
+      EXPECT_EQ(received, body);
+    }
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
+  }
+
+  TEST_F(CurlSession, smallReceiveBuffer)
+  {
+    // A receive buffer smaller than the headers and the chunks of the response.
+    std::string response("HTTP/1.1 200 Ok\r\ntransfer-encoding: chunked\r\n\r\n"
+                         "c\r\nhello world!\r\n5\r\n12345\r\n0\r\n\r\n");
+    std::string connectionKey("connection-key");
+    size_t position = 0;
+
+    // Can't mock the curMock directly from a unique ptr, heap allocate it first and then make a
+    // unique ptr for it
+    MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
+    EXPECT_CALL(*curlMock, SendBuffer(_, _, _)).WillOnce(Return(CURLE_OK));
+    EXPECT_CALL(*curlMock, ReadFromSocket(_, _, _))
+        .WillRepeatedly(Invoke([&](uint8_t* buffer, size_t bufferSize, Context const&) {
+          EXPECT_LE(bufferSize, size_t(8));
+          auto const count = (std::min)(bufferSize, response.size() - position);
+          std::copy(response.begin() + position, response.begin() + position + count, buffer);
+          position += count;
+          return count;
+        }));
+    EXPECT_CALL(*curlMock, GetConnectionKey()).WillRepeatedly(ReturnRef(connectionKey));
+    EXPECT_CALL(*curlMock, UpdateLastUsageTime());
+    EXPECT_CALL(*curlMock, DestructObj());
+
+    // Create the unique ptr to take care about memory free at the end
+    std::unique_ptr<MockCurlNetworkConnection> uniqueCurlMock(curlMock);
+
+    // Simulate a request to be sent
+    Azure::Core::Url url("http://microsoft.com");
+    Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+
+    {
+      // Create the session inside scope so it is released and the connection is moved to the pool
+      Azure::Core::Http::CurlTransportOptions transportOptions;
+      transportOptions.HttpKeepAlive = true;
+      transportOptions.ReceiveBufferSize = 8;
+      auto session = std::make_unique<Azure::Core::Http::CurlSession>(
+          request, std::move(uniqueCurlMock), transportOptions);
+
+      EXPECT_NO_THROW(session->Perform(Azure::Core::Context{}));
+      auto body = session->ReadToEnd(Azure::Core::Context{});
+      EXPECT_EQ(std::string(body.begin(), body.end()), "hello world!12345");
+    }
+    // Clear the connections from the pool to invoke clean routine
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
   }
 
   TEST_F(CurlSession, DoNotReuseConnectionIfDownloadFail)
   {
-    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-        .clear();
+    Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.Clear();
     // Can't mock the curlMock directly from a unique ptr, heap allocate it first and then make a
     // unique ptr for it
     MockCurlNetworkConnection* curlMock = new MockCurlNetworkConnection();
@@ -351,8 +449,7 @@ namespace Azure { namespace Core { namespace Test {
     }
     // Check connection pool is empty (connection was not moved to the pool)
     EXPECT_EQ(
-        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.ConnectionPoolIndex
-            .size(),
+        Azure::Core::Http::_detail::CurlConnectionPool::g_curlConnectionPool.HostCount(),
         0);
   }
 }}} // namespace Azure::Core::Test
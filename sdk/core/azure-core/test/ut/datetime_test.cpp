@@ -909,3 +909,102 @@ TEST(DateTime, Rfc3339Space)
       = DateTime::Parse("2022-08-24 00:43:08.0004308Z", DateTime::DateFormat::Rfc3339);
   EXPECT_EQ(datetime.ToString(DateTime::DateFormat::Rfc3339), "2022-08-24T00:43:08.0004308Z");
 }
+
+TEST(DateTime, ParseCanonicalFormsMatchGeneralForms)
+{
+  // The canonical forms take the fast path, the others the general parser.
+  EXPECT_EQ(
+      DateTime::Parse("Tue, 19 Nov 2013 14:30:59 GMT", DateTime::DateFormat::Rfc1123),
+      DateTime::Parse("19 Nov 2013 14:30:59 UT", DateTime::DateFormat::Rfc1123));
+  EXPECT_EQ(
+      DateTime::Parse("Mon, 01 Jan 0001 00:00:00 GMT", DateTime::DateFormat::Rfc1123),
+      DateTime());
+
+  EXPECT_EQ(
+      DateTime::Parse("2013-11-19T14:30:59Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("2013-11-19t14:30:59Z", DateTime::DateFormat::Rfc3339));
+  EXPECT_EQ(
+      DateTime::Parse("2013-11-19T14:30:59.1Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("2013-11-19t14:30:59.1Z", DateTime::DateFormat::Rfc3339));
+  EXPECT_EQ(
+      DateTime::Parse("2013-11-19T14:30:59.0012Z", DateTime::DateFormat::Rfc3339),
+      DateTime(2013, 11, 19, 14, 30, 59) + std::chrono::microseconds(1200));
+  EXPECT_EQ(
+      DateTime::Parse("9999-12-31T23:59:59.9999999Z", DateTime::DateFormat::Rfc3339),
+      DateTime::Parse("9999-12-31 23:59:59.9999999Z", DateTime::DateFormat::Rfc3339));
+}
+
+TEST(DateTime, ParseCanonicalFormsInvalid)
+{
+  // Wrong day of week, unknown month, invalid day.
+  EXPECT_THROW(
+      DateTime::Parse("Wed, 19 Nov 2013 14:30:59 GMT", DateTime::DateFormat::Rfc1123),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("Tue, 19 Nox 2013 14:30:59 GMT", DateTime::DateFormat::Rfc1123),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("Sat, 31 Nov 2013 14:30:59 GMT", DateTime::DateFormat::Rfc1123),
+      std::invalid_argument);
+
+  // Invalid month, non-digit month, non-digit second.
+  EXPECT_THROW(
+      DateTime::Parse("2013-13-19T14:30:59Z", DateTime::DateFormat::Rfc3339),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("2013-1a-19T14:30:59Z", DateTime::DateFormat::Rfc3339),
+      std::invalid_argument);
+  EXPECT_THROW(
+      DateTime::Parse("2013-11-19T14:30:5aZ", DateTime::DateFormat::Rfc3339),
+      std::invalid_argument);
+}
+
+TEST(DateTime, FormatterWritesToBuffer)
+{
+  using Azure::Core::_internal::DateTimeFormatter;
+
+  auto const dateTime = DateTime(2013, 11, 19, 14, 30, 59) + std::chrono::microseconds(1200);
+
+  char buffer[DateTimeFormatter::MaxRfc3339Length];
+  auto length = DateTimeFormatter::FormatRfc1123(dateTime, buffer);
+  EXPECT_EQ(length, DateTimeFormatter::Rfc1123Length);
+  EXPECT_EQ(std::string(buffer, length), "Tue, 19 Nov 2013 14:30:59 GMT");
+
+  length = DateTimeFormatter::FormatRfc3339(
+      dateTime, DateTime::TimeFractionFormat::DropTrailingZeros, buffer);
+  EXPECT_EQ(std::string(buffer, length), "2013-11-19T14:30:59.0012Z");
+
+  length
+      = DateTimeFormatter::FormatRfc3339(dateTime, DateTime::TimeFractionFormat::AllDigits, buffer);
+  EXPECT_EQ(length, DateTimeFormatter::MaxRfc3339Length);
+  EXPECT_EQ(std::string(buffer, length), "2013-11-19T14:30:59.0012000Z");
+
+  length
+      = DateTimeFormatter::FormatRfc3339(dateTime, DateTime::TimeFractionFormat::Truncate, buffer);
+  EXPECT_EQ(std::string(buffer, length), "2013-11-19T14:30:59Z");
+
+  EXPECT_THROW(
+      DateTimeFormatter::FormatRfc1123(DateTime(0001) - std::chrono::seconds(1), buffer),
+      std::invalid_argument);
+}
+
+TEST(DateTime, CurrentTimeRfc1123)
+{
+  using Azure::Core::_internal::DateTimeFormatter;
+
+  auto const before = DateTime(std::chrono::system_clock::now()) - std::chrono::seconds(1);
+  auto const now = DateTimeFormatter::GetCurrentTimeRfc1123();
+  auto const after = DateTime(std::chrono::system_clock::now());
+
+  EXPECT_EQ(now.length(), DateTimeFormatter::Rfc1123Length);
+  auto const parsed = DateTime::Parse(now, DateTime::DateFormat::Rfc1123);
+  EXPECT_GE(parsed, before);
+  EXPECT_LE(parsed, after);
+
+  // The cached string is the same as a newly formatted one.
+  auto const cached = DateTimeFormatter::GetCurrentTimeRfc1123();
+  EXPECT_EQ(
+      DateTime::Parse(cached, DateTime::DateFormat::Rfc1123).ToString(
+          DateTime::DateFormat::Rfc1123),
+      cached);
+}
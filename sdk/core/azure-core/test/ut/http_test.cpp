@@ -4,9 +4,12 @@
 #include "http_test.hpp"
 
 #include <azure/core/http/http.hpp>
+#include <azure/core/http/transport.hpp>
 #include <azure/core/internal/io/null_body_stream.hpp>
 #include <azure/core/rtti.hpp>
 
+#include <iterator>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -63,6 +66,40 @@ namespace Azure { namespace Core { namespace Test {
         expected2);
   }
 
+  TEST(TestHttp, HeaderList)
+  {
+    Http::_detail::HeaderList headers;
+    EXPECT_EQ(headers.Find("x-ms-version"), nullptr);
+
+    headers.Set("x-ms-version", "2024-08-04");
+    headers.Set("content-length", "0");
+    EXPECT_EQ(headers.Size(), 2u);
+    EXPECT_EQ(
+        Http::_detail::HeaderList::Hash("X-MS-Version"),
+        Http::_detail::HeaderList::Hash("x-ms-version"));
+
+    auto header = headers.Find("X-Ms-Version");
+    ASSERT_NE(header, nullptr);
+    EXPECT_EQ(header->Name, "x-ms-version");
+    EXPECT_EQ(header->Value, "2024-08-04");
+
+    // Setting a header again replaces its value and keeps its position.
+    headers.Set("CONTENT-LENGTH", "10");
+    EXPECT_EQ(headers.Size(), 2u);
+    EXPECT_EQ(headers.Find("content-length")->Value, "10");
+    EXPECT_EQ(std::next(headers.begin())->Name, "content-length");
+
+    headers.Remove("X-MS-VERSION");
+    EXPECT_EQ(headers.Find("x-ms-version"), nullptr);
+    EXPECT_EQ(headers.Size(), 1u);
+    headers.Remove("not-there");
+    EXPECT_EQ(headers.Size(), 1u);
+
+    headers.Clear();
+    EXPECT_EQ(headers.Size(), 0u);
+    EXPECT_EQ(headers.begin(), headers.end());
+  }
+
   // Response - Add header
   TEST(TestHttp, response_add_headers)
   {
@@ -211,6 +248,38 @@ namespace Azure { namespace Core { namespace Test {
 #endif
     }
 
+    {
+      // The transports read the headers in place.
+      Http::Request req(Http::HttpMethod::Get, Url("http://test.com"));
+      req.SetHeader("b-header", "1");
+      req.SetHeader("a-header", "2");
+      req.StartTry();
+      req.SetHeader("A-Header", "retry");
+      req.SetHeader("c-header", "3");
+
+      std::vector<std::pair<std::string, std::string>> visited;
+      Http::_detail::RequestHeaders::ForEach(
+          req, [&visited](std::string const& name, std::string const& value) {
+            visited.emplace_back(name, value);
+          });
+
+      // The headers set during the try come first, and hide the headers they replace.
+      std::vector<std::pair<std::string, std::string>> const expected{
+          {"a-header", "retry"}, {"c-header", "3"}, {"b-header", "1"}};
+      EXPECT_EQ(visited, expected);
+
+      EXPECT_TRUE(Http::_detail::RequestHeaders::Contains(req, "B-HEADER"));
+      EXPECT_FALSE(Http::_detail::RequestHeaders::Contains(req, "d-header"));
+
+      auto const headers = req.GetHeaders();
+      EXPECT_EQ(headers.size(), 3u);
+      EXPECT_EQ(headers.at("a-header"), "retry");
+      EXPECT_EQ(req.GetHeader("A-HEADER").Value(), "retry");
+
+      req.RemoveHeader("a-header");
+      EXPECT_FALSE(req.GetHeader("a-header").HasValue());
+    }
+
     {
       Http::HttpMethod httpMethod = Http::HttpMethod::Post;
       Url url("http://test.com");
@@ -249,4 +318,51 @@ namespace Azure { namespace Core { namespace Test {
     }
   }
 
+  namespace {
+    // Echoes the request body back as a streamed response body.
+    class EchoTransport final : public Http::HttpTransport {
+    public:
+      std::unique_ptr<Http::RawResponse> Send(Http::Request& request, Context const& context)
+          override
+      {
+        auto response = std::make_unique<Http::RawResponse>(1, 1, Http::HttpStatusCode::Ok, "OK");
+        m_body = request.GetBodyStream()->ReadToEnd(context);
+        response->SetBodyStream(std::make_unique<IO::MemoryBodyStream>(m_body));
+        return response;
+      }
+
+    private:
+      std::vector<uint8_t> m_body;
+    };
+  } // namespace
+
+  TEST(TestHttp, SendAsyncRewindsRequestBody)
+  {
+    std::vector<uint8_t> const data = {1, 2, 3, 4};
+    IO::MemoryBodyStream stream(data);
+    Http::Request req(Http::HttpMethod::Put, Url("http://test.com"), &stream);
+
+    // Consume the body as an earlier attempt would have.
+    stream.ReadToEnd(Context{});
+
+    EchoTransport transport;
+    auto response = transport.SendAsync(req, Context{}).get();
+    EXPECT_EQ(response->GetBody(), data);
+    EXPECT_EQ(response->ExtractBodyStream(), nullptr);
+  }
+
+  TEST(TestHttp, SendAsyncKeepsUnbufferedResponseStream)
+  {
+    std::vector<uint8_t> const data = {1, 2, 3, 4};
+    IO::MemoryBodyStream stream(data);
+    Http::Request req(Http::HttpMethod::Put, Url("http://test.com"), &stream, false);
+
+    EchoTransport transport;
+    auto response = transport.SendAsync(req, Context{}).get();
+    EXPECT_TRUE(response->GetBody().empty());
+    auto bodyStream = response->ExtractBodyStream();
+    ASSERT_NE(bodyStream, nullptr);
+    EXPECT_EQ(bodyStream->ReadToEnd(Context{}), data);
+  }
+
 }}} // namespace Azure::Core::Test
@@ -197,6 +197,37 @@ TEST(LogPolicy, Default)
   EXPECT_TRUE(EndsWith(entry2.Message, "ms) : 200 OKAY"));
 }
 
+TEST(LogPolicy, Asynchronous)
+{
+  TestLogger const Log;
+  Logger::EnableAsynchronousLogging({});
+  SendRequest(LogOptions());
+  Logger::DisableAsynchronousLogging();
+
+  ASSERT_EQ(Log.Entries.size(), 2);
+
+  auto const entry1 = Log.Entries.at(0);
+  auto const entry2 = Log.Entries.at(1);
+
+  EXPECT_EQ(entry1.Level, Logger::Level::Informational);
+  EXPECT_EQ(entry2.Level, Logger::Level::Informational);
+
+  EXPECT_EQ(
+      entry1.Message,
+      "HTTP Request : GET https://www.microsoft.com"
+      "?Qparam2=REDACTED"
+      "&qParam3=REDACTED"
+      "&qparam%204=REDACTED"
+      "&qparam%25204=REDACTED"
+      "&qparam1=REDACTED"
+      "\nheader1 : REDACTED"
+      "\nheader2 : REDACTED"
+      "\nx-ms-request-id : 6c536700-4c36-4e22-9161-76e7b3bf8269");
+
+  EXPECT_TRUE(StartsWith(entry2.Message, "HTTP/1.1 Response ("));
+  EXPECT_TRUE(EndsWith(entry2.Message, "ms) : 200 OKAY"));
+}
+
 TEST(LogPolicy, PortAndPath)
 {
   TestLogger const Log;
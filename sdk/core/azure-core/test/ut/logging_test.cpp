@@ -3,8 +3,14 @@
 
 #include <azure/core/internal/diagnostics/log.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <iomanip>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -304,3 +310,155 @@ TEST(Logger, LoggerStreamInsertion)
   Log::Stream(Logger::Level::Verbose)
       << "Verbose" << std::put_time(localtime(&time_t), "%c") << std::endl;
 }
+
+TEST(Logger, AsynchronousDelivery)
+{
+  std::vector<std::string> messages;
+  std::vector<std::thread::id> threads;
+  Logger::SetListener([&](auto, auto msg) {
+    messages.push_back(msg);
+    threads.push_back(std::this_thread::get_id());
+  });
+  Logger::SetLevel(Logger::Level::Verbose);
+  Logger::EnableAsynchronousLogging({});
+
+  Log::Write(Logger::Level::Verbose, "First");
+  Log::Stream(Logger::Level::Informational) << "Second " << 2;
+  Log::WriteDeferred(Logger::Level::Warning, []() { return std::string("Third"); });
+  Log::WriteDeferred(Logger::Level::Warning, []() { return std::string(); });
+  Logger::Flush();
+
+  ASSERT_EQ(messages.size(), 3u);
+  EXPECT_EQ(messages[0], "First");
+  EXPECT_EQ(messages[1], "Second 2");
+  EXPECT_EQ(messages[2], "Third");
+  for (auto const& thread : threads)
+  {
+    EXPECT_NE(thread, std::this_thread::get_id());
+  }
+
+  Logger::DisableAsynchronousLogging();
+  Log::Write(Logger::Level::Error, "Synchronous");
+  ASSERT_EQ(messages.size(), 4u);
+  EXPECT_EQ(messages[3], "Synchronous");
+  EXPECT_EQ(threads[3], std::this_thread::get_id());
+
+  Logger::SetListener(nullptr);
+}
+
+TEST(Logger, AsynchronousDeferredFormatting)
+{
+  Logger::SetListener([](auto, auto) {});
+  Logger::SetLevel(Logger::Level::Warning);
+  Logger::EnableAsynchronousLogging({});
+
+  std::atomic<int> formatted{0};
+  Log::WriteDeferred(Logger::Level::Verbose, [&]() {
+    ++formatted;
+    return std::string("Verbose");
+  });
+  Log::WriteDeferred(Logger::Level::Error, [&]() {
+    ++formatted;
+    return std::string("Error");
+  });
+  Logger::Flush();
+
+  // Messages below the log level are neither queued nor formatted.
+  EXPECT_EQ(formatted, 1);
+
+  Logger::DisableAsynchronousLogging();
+  Logger::SetListener(nullptr);
+}
+
+namespace {
+// Holds the listener until Release() is called, so that the queue fills up.
+class BlockedListener final {
+  std::mutex m_mutex;
+  std::condition_variable m_released;
+  bool m_isReleased{};
+
+public:
+  std::atomic<int> Delivered{0};
+
+  void operator()()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_released.wait(lock, [this]() { return m_isReleased; });
+    ++Delivered;
+  }
+
+  void Release()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isReleased = true;
+    }
+    m_released.notify_all();
+  }
+};
+} // namespace
+
+TEST(Logger, AsynchronousDropsWhenFull)
+{
+  BlockedListener listener;
+  Logger::SetListener([&](auto, auto) { listener(); });
+  Logger::SetLevel(Logger::Level::Verbose);
+
+  Logger::AsynchronousOptions options;
+  options.QueueCapacity = 4;
+  options.WhenQueueIsFull = Logger::QueueFullBehavior::DropMessage;
+  Logger::EnableAsynchronousLogging(options);
+
+  auto const droppedBefore = Logger::GetDroppedMessageCount();
+  for (int i = 0; i < 100; ++i)
+  {
+    Log::Write(Logger::Level::Verbose, "Message");
+  }
+  listener.Release();
+  Logger::Flush();
+
+  // At most one message is being delivered while the others wait in the queue.
+  auto const dropped = Logger::GetDroppedMessageCount() - droppedBefore;
+  EXPECT_GE(dropped, 95u);
+  EXPECT_EQ(static_cast<std::uint64_t>(listener.Delivered) + dropped, 100u);
+
+  Logger::DisableAsynchronousLogging();
+  Logger::SetListener(nullptr);
+}
+
+TEST(Logger, AsynchronousBlocksWhenFull)
+{
+  BlockedListener listener;
+  Logger::SetListener([&](auto, auto) { listener(); });
+  Logger::SetLevel(Logger::Level::Verbose);
+
+  Logger::AsynchronousOptions options;
+  options.QueueCapacity = 4;
+  options.WhenQueueIsFull = Logger::QueueFullBehavior::Block;
+  Logger::EnableAsynchronousLogging(options);
+
+  auto const droppedBefore = Logger::GetDroppedMessageCount();
+  std::vector<std::thread> writers;
+  for (int i = 0; i < 4; ++i)
+  {
+    writers.emplace_back([]() {
+      for (int j = 0; j < 25; ++j)
+      {
+        Log::Write(Logger::Level::Verbose, "Message");
+      }
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  listener.Release();
+  for (auto& writer : writers)
+  {
+    writer.join();
+  }
+  Logger::Flush();
+
+  EXPECT_EQ(listener.Delivered, 100);
+  EXPECT_EQ(Logger::GetDroppedMessageCount(), droppedBefore);
+
+  Logger::DisableAsynchronousLogging();
+  Logger::SetListener(nullptr);
+}
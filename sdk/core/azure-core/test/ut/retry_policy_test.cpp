@@ -833,3 +833,76 @@ TEST(RetryPolicy, LogMessages)
   EXPECT_EQ(log.Entries[4].Level, Logger::Level::Informational);
   EXPECT_EQ(log.Entries[4].Message, "HTTP status code 503 won't be retried.");
 }
+
+TEST(RetryPolicy, RetryBudget)
+{
+  RetryBudget budget(4, 0.5);
+  // Retries are allowed while more than half of the tokens are left.
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  EXPECT_FALSE(budget.TryAcquireRetry());
+
+  // Successes give back half a token each.
+  budget.RecordSuccess();
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  EXPECT_FALSE(budget.TryAcquireRetry());
+  budget.RecordSuccess();
+  EXPECT_FALSE(budget.TryAcquireRetry());
+
+  // The bucket never holds more than its capacity.
+  for (int i = 0; i < 100; ++i)
+  {
+    budget.RecordSuccess();
+  }
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  EXPECT_TRUE(budget.TryAcquireRetry());
+  EXPECT_FALSE(budget.TryAcquireRetry());
+}
+
+TEST(RetryPolicy, RetryBudgetSharedByPipelines)
+{
+  using namespace std::chrono_literals;
+  RetryOptions const retryOptions{5, 1ms, 1ms, {HttpStatusCode::ServiceUnavailable}};
+  auto const budget = std::make_shared<RetryBudget>(6, 0.1);
+
+  auto requestCount = 0;
+  auto const send = [&]() {
+    std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+    policies.emplace_back(std::make_unique<RetryPolicy>(retryOptions, budget));
+    policies.emplace_back(std::make_unique<TestTransportPolicy>([&]() {
+      ++requestCount;
+      return std::make_unique<RawResponse>(1, 1, HttpStatusCode::ServiceUnavailable, "Test");
+    }));
+    Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+
+    Request request(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+    return pipeline.Send(request, Azure::Core::Context())->GetStatusCode();
+  };
+
+  // The budget allows 3 retries in total, so the second pipeline can only retry once.
+  EXPECT_EQ(send(), HttpStatusCode::ServiceUnavailable);
+  EXPECT_EQ(requestCount, 4);
+  requestCount = 0;
+  EXPECT_EQ(send(), HttpStatusCode::ServiceUnavailable);
+  EXPECT_EQ(requestCount, 1);
+}
+
+TEST(RetryPolicy, RetryDelayBeyondDeadline)
+{
+  using namespace std::chrono_literals;
+  RetryOptions const retryOptions{3, 10min, 10min, {HttpStatusCode::ServiceUnavailable}};
+
+  std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+  policies.emplace_back(std::make_unique<RetryPolicy>(retryOptions));
+  policies.emplace_back(std::make_unique<TestTransportPolicy>([&]() {
+    return std::make_unique<RawResponse>(1, 1, HttpStatusCode::ServiceUnavailable, "Test");
+  }));
+  Azure::Core::Http::_internal::HttpPipeline pipeline(policies);
+
+  Request request(HttpMethod::Get, Azure::Core::Url("https://www.microsoft.com"));
+  auto const context = Azure::Core::Context().WithDeadline(std::chrono::system_clock::now() + 50ms);
+  auto const start = std::chrono::steady_clock::now();
+  EXPECT_THROW(pipeline.Send(request, context), Azure::Core::OperationCancelledException);
+  // The wait ends at the deadline instead of after the retry delay.
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 1min);
+}
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <azure/core/internal/timer_wheel.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using Azure::Core::_internal::TimerWheel;
+
+namespace Azure { namespace Core { namespace Test {
+
+  TEST(TimerWheel, NeverFiresEarly)
+  {
+    using namespace std::chrono_literals;
+    TimerWheel timerWheel;
+
+    std::vector<std::chrono::milliseconds> const delays{0ms, 1ms, 5ms, 63ms, 64ms, 65ms, 300ms};
+    std::vector<std::shared_ptr<std::promise<std::chrono::steady_clock::time_point>>> fired;
+    auto const start = std::chrono::steady_clock::now();
+    for (auto const delay : delays)
+    {
+      auto promise = std::make_shared<std::promise<std::chrono::steady_clock::time_point>>();
+      fired.push_back(promise);
+      timerWheel.Schedule(
+          delay, [promise]() { promise->set_value(std::chrono::steady_clock::now()); });
+    }
+
+    for (size_t index = 0; index < delays.size(); ++index)
+    {
+      auto future = fired[index]->get_future();
+      ASSERT_EQ(future.wait_for(10s), std::future_status::ready);
+      EXPECT_GE(future.get() - start, delays[index]);
+    }
+  }
+
+  TEST(TimerWheel, FiresInOrder)
+  {
+    using namespace std::chrono_literals;
+    TimerWheel timerWheel;
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::promise<void> done;
+    // Delays which land in the first and in the second wheel, scheduled in reverse order.
+    for (int index = 4; index >= 0; --index)
+    {
+      timerWheel.Schedule(std::chrono::milliseconds(index * 40), [&, index]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(index);
+        if (order.size() == 5)
+        {
+          done.set_value();
+        }
+      });
+    }
+    ASSERT_EQ(done.get_future().wait_for(10s), std::future_status::ready);
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+  }
+
+  TEST(TimerWheel, Cancel)
+  {
+    using namespace std::chrono_literals;
+    TimerWheel timerWheel;
+
+    std::atomic<int> cancelledCount{0};
+    std::promise<void> done;
+    auto const cancelled = timerWheel.Schedule(20ms, [&]() { ++cancelledCount; });
+    timerWheel.Schedule(100ms, [&]() { done.set_value(); });
+
+    EXPECT_TRUE(timerWheel.Cancel(cancelled));
+    EXPECT_FALSE(timerWheel.Cancel(cancelled));
+    ASSERT_EQ(done.get_future().wait_for(10s), std::future_status::ready);
+    EXPECT_EQ(cancelledCount, 0);
+  }
+
+  TEST(TimerWheel, ManyTimers)
+  {
+    using namespace std::chrono_literals;
+    TimerWheel timerWheel;
+
+    constexpr int TimerCount = 10000;
+    std::atomic<int> firedCount{0};
+    std::promise<void> done;
+    for (int index = 0; index < TimerCount; ++index)
+    {
+      timerWheel.Schedule(std::chrono::milliseconds(index % 200), [&]() {
+        if (++firedCount == TimerCount)
+        {
+          done.set_value();
+        }
+      });
+    }
+    ASSERT_EQ(done.get_future().wait_for(10s), std::future_status::ready);
+  }
+
+  TEST(TimerWheel, DestroyWithPendingTimers)
+  {
+    using namespace std::chrono_literals;
+    std::atomic<bool> fired{false};
+    {
+      TimerWheel timerWheel;
+      timerWheel.Schedule(1h, [&]() { fired = true; });
+    }
+    EXPECT_FALSE(fired);
+  }
+}}} // namespace Azure::Core::Test
@@ -9,6 +9,7 @@
 #include <azure/core/response.hpp>
 #include <azure/core/rtti.hpp>
 
+#include <future>
 #include <iostream>
 #include <string>
 #include <thread>
@@ -445,6 +446,110 @@ namespace Azure { namespace Core { namespace Test {
     }
   }
 
+  TEST_P(TransportAdapter, getAsync)
+  {
+    Azure::Core::Url host(AzureSdkHttpbinServer::Get());
+    auto transport
+        = Azure::Core::Http::Policies::_detail::GetTransportAdapter(GetParam().TransportAdapter);
+
+    // Keep several requests in flight at once, then wait for all of them.
+    std::vector<Azure::Core::Http::Request> requests;
+    for (int i = 0; i < 5; i++)
+    {
+      requests.emplace_back(Azure::Core::Http::HttpMethod::Get, host);
+      requests.back().SetHeader("123", std::to_string(i));
+    }
+    std::vector<std::future<std::unique_ptr<Azure::Core::Http::RawResponse>>> responses;
+    for (auto& request : requests)
+    {
+      responses.emplace_back(transport->SendAsync(request, Context{}));
+    }
+
+    for (size_t i = 0; i < responses.size(); i++)
+    {
+      auto response = responses[i].get();
+      checkResponseCode(response->GetStatusCode());
+      auto expectedResponseBodySize = std::stoull(response->GetHeaders().at("content-length"));
+      CheckBodyFromBuffer(*response, expectedResponseBodySize);
+
+      auto jsonBody = json::parse(response->GetBody());
+      ASSERT_TRUE(jsonBody["headers"].contains("123"));
+      EXPECT_EQ(jsonBody["headers"]["123"].get<std::string>(), std::to_string(i));
+    }
+  }
+
+  TEST_P(TransportAdapter, putAsync)
+  {
+    Azure::Core::Url host(AzureSdkHttpbinServer::Put());
+
+    auto requestBodyVector = std::vector<uint8_t>(1024, 'x');
+    auto bodyRequest = Azure::Core::IO::MemoryBodyStream(requestBodyVector);
+    auto request
+        = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, host, &bodyRequest);
+    auto transport
+        = Azure::Core::Http::Policies::_detail::GetTransportAdapter(GetParam().TransportAdapter);
+    auto response = transport->SendAsync(request, Context{}).get();
+    checkResponseCode(response->GetStatusCode());
+    auto expectedResponseBodySize = std::stoull(response->GetHeaders().at("content-length"));
+    CheckBodyFromBuffer(*response, expectedResponseBodySize);
+
+    json responseJson = json::parse(response->GetBody());
+    std::string bodyAsString{
+        requestBodyVector.data(), requestBodyVector.data() + requestBodyVector.size()};
+    EXPECT_EQ(responseJson["data"].get<std::string>(), bodyAsString);
+  }
+
+  TEST_P(TransportAdapter, putAsyncRewindsBody)
+  {
+    Azure::Core::Url host(AzureSdkHttpbinServer::Put());
+
+    auto requestBodyVector = std::vector<uint8_t>(1024, 'x');
+    auto bodyRequest = Azure::Core::IO::MemoryBodyStream(requestBodyVector);
+    auto request
+        = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Put, host, &bodyRequest);
+    auto transport
+        = Azure::Core::Http::Policies::_detail::GetTransportAdapter(GetParam().TransportAdapter);
+
+    // Send the same request twice, the second send must not see an exhausted body stream.
+    for (int i = 0; i < 2; i++)
+    {
+      auto response = transport->SendAsync(request, Context{}).get();
+      checkResponseCode(response->GetStatusCode());
+
+      json responseJson = json::parse(response->GetBody());
+      std::string bodyAsString{
+          requestBodyVector.data(), requestBodyVector.data() + requestBodyVector.size()};
+      EXPECT_EQ(responseJson["data"].get<std::string>(), bodyAsString);
+    }
+  }
+
+  TEST_P(TransportAdapter, getAsyncNoBuffer)
+  {
+    Azure::Core::Url host(AzureSdkHttpbinServer::Get());
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, host, false);
+    auto transport
+        = Azure::Core::Http::Policies::_detail::GetTransportAdapter(GetParam().TransportAdapter);
+
+    auto response = transport->SendAsync(request, Context{}).get();
+    checkResponseCode(response->GetStatusCode());
+    EXPECT_TRUE(response->GetBody().empty());
+    auto expectedResponseBodySize = std::stoull(response->GetHeaders().at("content-length"));
+    CheckBodyFromStream(*response, expectedResponseBodySize);
+  }
+
+  TEST_P(TransportAdapter, cancelRequestAsync)
+  {
+    Azure::Core::Url hostPath(AzureSdkHttpbinServer::Delay() + "/2"); // 2 seconds delay on server
+    auto transport
+        = Azure::Core::Http::Policies::_detail::GetTransportAdapter(GetParam().TransportAdapter);
+
+    Azure::Core::Context cancelThis;
+    auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, hostPath);
+    auto response = transport->SendAsync(request, cancelThis);
+    cancelThis.Cancel();
+    EXPECT_THROW(response.get(), Azure::Core::OperationCancelledException);
+  }
+
   TEST_P(TransportAdapter, cancelTransferDownload)
   {
     // public big blob (321MB)
@@ -12,6 +12,7 @@
 #include "azure/perf/argagg.hpp"
 #include "azure/perf/base_test.hpp"
 #include "azure/perf/dynamic_test_options.hpp"
+#include "azure/perf/latency_histogram.hpp"
 #include "azure/perf/options.hpp"
 #include "azure/perf/program.hpp"
 #include "azure/perf/test.hpp"
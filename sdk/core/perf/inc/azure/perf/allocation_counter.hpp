@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Define a counter of the heap allocations made by the process.
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace Azure { namespace Perf {
+  /**
+   * @brief Counts the heap allocations made through the global `operator new`.
+   *
+   * @details The perf framework replaces the global allocation functions to count the number and
+   * the size of the allocations. Counting is off until #Enable is called, so that tests which do
+   * not ask for it only pay for one relaxed load per allocation.
+   *
+   * @remark The counters are process-wide: allocations made by the framework itself while the
+   * test runs, such as the progress reporting, are counted too.
+   *
+   */
+  class AllocationCounter final {
+  public:
+    /**
+     * @brief Start counting allocations.
+     *
+     */
+    static void Enable();
+
+    /**
+     * @brief The number of allocations made since #Enable was called.
+     *
+     */
+    static uint64_t GetAllocationCount();
+
+    /**
+     * @brief The number of bytes requested by the allocations made since #Enable was called.
+     *
+     */
+    static uint64_t GetAllocatedBytes();
+  };
+}} // namespace Azure::Perf
@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Define a histogram to record per-operation latency.
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace Azure { namespace Perf {
+  /**
+   * @brief A histogram of operation latencies with a bounded relative error.
+   *
+   * @details Latencies are counted in log-linear buckets, in the manner of HdrHistogram: values
+   * below 256ns are counted exactly and every higher power of two is split into 128 linear
+   * buckets, so any reported value is within 1% of the recorded one. Recording never allocates,
+   * so each parallel test records into its own histogram and the histograms are merged when the
+   * test completes.
+   *
+   */
+  class LatencyHistogram final {
+  public:
+    /**
+     * @brief Construct an empty histogram.
+     *
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Record the latency of one operation.
+     *
+     * @param latency The operation latency. Negative values are recorded as 0.
+     */
+    void Record(std::chrono::nanoseconds latency);
+
+    /**
+     * @brief Add all the values recorded in another histogram to this one.
+     *
+     * @param other The histogram to merge.
+     */
+    void Merge(LatencyHistogram const& other);
+
+    /**
+     * @brief The number of recorded values.
+     *
+     */
+    uint64_t Count() const { return m_count; }
+
+    /**
+     * @brief The smallest recorded value, or 0 if the histogram is empty.
+     *
+     */
+    std::chrono::nanoseconds Min() const;
+
+    /**
+     * @brief The largest recorded value, or 0 if the histogram is empty.
+     *
+     */
+    std::chrono::nanoseconds Max() const;
+
+    /**
+     * @brief The mean of the recorded values, or 0 if the histogram is empty.
+     *
+     */
+    std::chrono::nanoseconds Mean() const;
+
+    /**
+     * @brief The value that the given percentage of the recorded values are less than or equal
+     * to.
+     *
+     * @param percentile A percentage between 0 and 100.
+     */
+    std::chrono::nanoseconds ValueAtPercentile(double percentile) const;
+
+  private:
+    std::vector<uint64_t> m_counts;
+    uint64_t m_count = 0;
+    uint64_t m_min = 0;
+    uint64_t m_max = 0;
+    uint64_t m_sum = 0;
+  };
+}} // namespace Azure::Perf
@@ -27,6 +27,12 @@ namespace Azure { namespace Perf {
    */
   struct GlobalTestOptions
   {
+    /**
+     * @brief Count and print the heap allocations per operation.
+     *
+     */
+    bool Allocations = false;
+
     /**
      * @brief Define the duration of test in seconds
      *
@@ -89,6 +95,13 @@ namespace Azure { namespace Perf {
      */
     Azure::Nullable<int> Rate;
 
+    /**
+     * @brief Write the results to this file, as CSV if the name ends with `.csv` or as JSON
+     * otherwise. No file is written by default.
+     *
+     */
+    std::string ResultsFile;
+
     /**
      * @brief Duration of warmup in seconds.
      *
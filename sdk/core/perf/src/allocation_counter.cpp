@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/perf/allocation_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<bool> g_isEnabled(false);
+std::atomic<uint64_t> g_allocationCount(0);
+std::atomic<uint64_t> g_allocatedBytes(0);
+
+inline void* Allocate(std::size_t size) noexcept
+{
+  if (g_isEnabled.load(std::memory_order_relaxed))
+  {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+  }
+  // malloc(0) may return nullptr, while operator new must return a unique pointer.
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+inline void* AllocateOrThrow(std::size_t size)
+{
+  for (;;)
+  {
+    if (auto pointer = Allocate(size))
+    {
+      return pointer;
+    }
+    auto handler = std::get_new_handler();
+    if (handler == nullptr)
+    {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+} // namespace
+
+void Azure::Perf::AllocationCounter::Enable()
+{
+  g_isEnabled.store(true, std::memory_order_relaxed);
+}
+
+uint64_t Azure::Perf::AllocationCounter::GetAllocationCount()
+{
+  return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+uint64_t Azure::Perf::AllocationCounter::GetAllocatedBytes()
+{
+  return g_allocatedBytes.load(std::memory_order_relaxed);
+}
+
+// Replacements of the global allocation functions. The aligned overloads of C++17 are left to the
+// standard library, so over-aligned allocations are not counted.
+void* operator new(std::size_t size) { return AllocateOrThrow(size); }
+void* operator new[](std::size_t size) { return AllocateOrThrow(size); }
+void* operator new(std::size_t size, std::nothrow_t const&) noexcept { return Allocate(size); }
+void* operator new[](std::size_t size, std::nothrow_t const&) noexcept { return Allocate(size); }
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::nothrow_t const&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::nothrow_t const&) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
@@ -10,6 +10,24 @@
 
 #define GET_ARG(Name, Is)
 
+namespace {
+// Accepts the `true`/`false` spelling used by the other language perf frameworks, as well as any
+// integer.
+bool AsBool(argagg::option_results const& option)
+{
+  auto const value = option.as<std::string>();
+  if (value == "true")
+  {
+    return true;
+  }
+  if (value == "false")
+  {
+    return false;
+  }
+  return option.as<bool>();
+}
+} // namespace
+
 argagg::parser_results Azure::Perf::Program::ArgParser::Parse(
     int argc,
     char** argv,
@@ -50,6 +68,10 @@ Azure::Perf::GlobalTestOptions Azure::Perf::Program::ArgParser::Parse(
     argagg::parser_results const& parsedArgs)
 {
   Azure::Perf::GlobalTestOptions options;
+  if (parsedArgs["Allocations"])
+  {
+    options.Allocations = AsBool(parsedArgs["Allocations"]);
+  }
   if (parsedArgs["Duration"])
   {
     options.Duration = parsedArgs["Duration"];
@@ -68,15 +90,15 @@ Azure::Perf::GlobalTestOptions Azure::Perf::Program::ArgParser::Parse(
   }
   if (parsedArgs["JobStatistics"])
   {
-    options.JobStatistics = parsedArgs["JobStatistics"].as<bool>();
+    options.JobStatistics = AsBool(parsedArgs["JobStatistics"]);
   }
   if (parsedArgs["Latency"])
   {
-    options.Latency = parsedArgs["Latency"].as<bool>();
+    options.Latency = AsBool(parsedArgs["Latency"]);
   }
   if (parsedArgs["NoCleanup"])
   {
-    options.NoCleanup = parsedArgs["NoCleanup"].as<bool>();
+    options.NoCleanup = AsBool(parsedArgs["NoCleanup"]);
   }
   if (parsedArgs["Parallel"])
   {
@@ -89,6 +111,14 @@ Azure::Perf::GlobalTestOptions Azure::Perf::Program::ArgParser::Parse(
   if (parsedArgs["Rate"])
   {
     options.Rate = parsedArgs["Rate"];
+    if (options.Rate.Value() <= 0)
+    {
+      throw std::invalid_argument("The target throughput (--rate) must be greater than 0.");
+    }
+  }
+  if (parsedArgs["ResultsFile"])
+  {
+    options.ResultsFile = parsedArgs["ResultsFile"].as<std::string>();
   }
   if (parsedArgs["Warmup"])
   {
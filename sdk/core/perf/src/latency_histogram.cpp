@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/perf/latency_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// Values below 2^SubBucketBits are counted exactly. Above that, each power of two is split into
+// 2^(SubBucketBits - 1) buckets.
+constexpr uint32_t SubBucketBits = 8;
+constexpr uint64_t SubBucketCount = uint64_t(1) << SubBucketBits;
+constexpr uint64_t SubBucketHalfCount = SubBucketCount / 2;
+constexpr size_t BucketCount
+    = static_cast<size_t>(SubBucketCount + (64 - SubBucketBits) * SubBucketHalfCount);
+
+inline size_t GetBucketIndex(uint64_t value)
+{
+  if (value < SubBucketCount)
+  {
+    return static_cast<size_t>(value);
+  }
+  uint32_t mostSignificantBit = 0;
+  for (uint64_t v = value >> 1; v != 0; v >>= 1)
+  {
+    ++mostSignificantBit;
+  }
+  uint32_t const shift = mostSignificantBit - SubBucketBits + 1;
+  uint64_t const mantissa = value >> shift;
+  return static_cast<size_t>(
+      SubBucketCount + (shift - 1) * SubBucketHalfCount + (mantissa - SubBucketHalfCount));
+}
+
+// Returns the largest value which is counted in the bucket.
+inline uint64_t GetBucketHighestValue(size_t index)
+{
+  if (index < SubBucketCount)
+  {
+    return index;
+  }
+  uint64_t const offset = index - SubBucketCount;
+  uint64_t const shift = offset / SubBucketHalfCount + 1;
+  uint64_t const mantissa = SubBucketHalfCount + offset % SubBucketHalfCount;
+  return ((mantissa + 1) << shift) - 1;
+}
+} // namespace
+
+Azure::Perf::LatencyHistogram::LatencyHistogram() : m_counts(BucketCount) {}
+
+void Azure::Perf::LatencyHistogram::Record(std::chrono::nanoseconds latency)
+{
+  uint64_t const value = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+  ++m_counts[GetBucketIndex(value)];
+  m_min = m_count == 0 ? value : (std::min)(m_min, value);
+  m_max = (std::max)(m_max, value);
+  m_sum += value;
+  ++m_count;
+}
+
+void Azure::Perf::LatencyHistogram::Merge(LatencyHistogram const& other)
+{
+  if (other.m_count == 0)
+  {
+    return;
+  }
+  for (size_t index = 0; index != m_counts.size(); index++)
+  {
+    m_counts[index] += other.m_counts[index];
+  }
+  m_min = m_count == 0 ? other.m_min : (std::min)(m_min, other.m_min);
+  m_max = (std::max)(m_max, other.m_max);
+  m_sum += other.m_sum;
+  m_count += other.m_count;
+}
+
+std::chrono::nanoseconds Azure::Perf::LatencyHistogram::Min() const
+{
+  return std::chrono::nanoseconds(m_min);
+}
+
+std::chrono::nanoseconds Azure::Perf::LatencyHistogram::Max() const
+{
+  return std::chrono::nanoseconds(m_max);
+}
+
+std::chrono::nanoseconds Azure::Perf::LatencyHistogram::Mean() const
+{
+  return std::chrono::nanoseconds(m_count == 0 ? 0 : m_sum / m_count);
+}
+
+std::chrono::nanoseconds Azure::Perf::LatencyHistogram::ValueAtPercentile(double percentile) const
+{
+  if (m_count == 0)
+  {
+    return std::chrono::nanoseconds(0);
+  }
+  percentile = (std::min)((std::max)(percentile, 0.0), 100.0);
+  auto const target = (std::max)(
+      uint64_t(1), static_cast<uint64_t>(std::ceil(percentile / 100.0 * m_count)));
+
+  uint64_t seen = 0;
+  for (size_t index = 0; index != m_counts.size(); index++)
+  {
+    seen += m_counts[index];
+    if (seen >= target)
+    {
+      return std::chrono::nanoseconds(
+          (std::max)(m_min, (std::min)(GetBucketHighestValue(index), m_max)));
+    }
+  }
+  return std::chrono::nanoseconds(m_max);
+}
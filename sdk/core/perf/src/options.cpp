@@ -8,6 +8,7 @@
 void Azure::Perf::to_json(Azure::Core::Json::_internal::json& j, const GlobalTestOptions& p)
 {
   j = Azure::Core::Json::_internal::json{
+      {"Allocations", p.Allocations},
       {"Duration", p.Duration},
       {"Host", p.Host},
       {"Insecure", p.Insecure},
@@ -16,6 +17,7 @@ void Azure::Perf::to_json(Azure::Core::Json::_internal::json& j, const GlobalTes
       {"Latency", p.Latency},
       {"NoCleanup", p.NoCleanup},
       {"Parallel", p.Parallel},
+      {"ResultsFile", p.ResultsFile.empty() ? "N/A" : p.ResultsFile},
       {"Warmup", p.Warmup}};
   if (p.Port)
   {
@@ -61,6 +63,10 @@ std::vector<Azure::Perf::TestOption> Azure::Perf::GlobalTestOptions::GetOptionMe
     [Option('x', "proxy", Default = "", HelpText = "Proxy server")]
   */
   return {
+      {"Allocations",
+       {"--allocations"},
+       "Count and print the heap allocations per operation. Default to false.",
+       1},
       {"Duration",
        {"-d", "--duration"},
        "Duration of the test in seconds. Default to 10 seconds.",
@@ -83,7 +89,15 @@ std::vector<Azure::Perf::TestOption> Azure::Perf::GlobalTestOptions::GetOptionMe
        "Number of operations to execute in parallel. Default to 1.",
        1},
       {"Port", {"--port"}, "Port to redirect HTTP requests. Default to no redirection.", 1},
-      {"Rate", {"-r", "--rate"}, "Target throughput (ops/sec). Default to no throughput.", 1},
+      {"Rate",
+       {"-r", "--rate"},
+       "Target throughput (ops/sec) across all parallel operations. Latency is measured from "
+       "the scheduled start of each operation. Default to no throughput.",
+       1},
+      {"ResultsFile",
+       {"--results-file"},
+       "Write the results to this file, as CSV if it ends with .csv or as JSON otherwise.",
+       1},
 
       {"Sync", {"-y", "--sync"}, "Runs sync version of test, not implemented", 0},
       {"TestProxies", {"-x", "--test-proxies"}, "URIs of TestProxy Servers (separated by ';')", 1},
@@ -3,16 +3,23 @@
 
 #include "azure/perf/program.hpp"
 
+#include "azure/perf/allocation_counter.hpp"
 #include "azure/perf/argagg.hpp"
+#include "azure/perf/latency_histogram.hpp"
 
 #include <azure/core/internal/diagnostics/global_exception.hpp>
 #include <azure/core/internal/json/json.hpp>
 #include <azure/core/internal/strings.hpp>
 #include <azure/core/platform.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <csignal>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 #include <thread>
 
 namespace {
@@ -114,19 +121,73 @@ inline void PrintOptions(
   }
 }
 
+/**
+ * @brief Schedules the operations of all the parallel tests at a fixed rate.
+ *
+ * @details Operation N is due at `start + N / rate` whether or not the previous operations have
+ * completed (open-loop). When the tests fall behind, the operations queue up and the time spent
+ * waiting is part of their latency, instead of being hidden by issuing fewer operations.
+ */
+class RatePacer final {
+public:
+  RatePacer(int rate, std::chrono::seconds duration)
+      : m_rate(rate), m_start(std::chrono::steady_clock::now()), m_deadline(m_start + duration)
+  {
+  }
+
+  // Gets the scheduled start of the next operation. Returns false once it is past the deadline.
+  bool TryGetNextStart(std::chrono::steady_clock::time_point& operationStart)
+  {
+    auto const operation = m_nextOperation.fetch_add(1);
+    operationStart = m_start + std::chrono::nanoseconds(operation * 1000000000 / m_rate);
+    return operationStart < m_deadline;
+  }
+
+private:
+  uint64_t const m_rate;
+  std::chrono::steady_clock::time_point const m_start;
+  std::chrono::steady_clock::time_point const m_deadline;
+  std::atomic<uint64_t> m_nextOperation{0};
+};
+
 inline void RunLoop(
     Azure::Core::Context const& context,
     Azure::Perf::PerfTest& test,
     uint64_t& completedOperations,
     std::chrono::nanoseconds& lastCompletionTimes,
-    bool latency,
+    Azure::Perf::LatencyHistogram* latency,
+    RatePacer* pacer,
     bool& isCancelled)
 {
-  (void)latency;
   auto start = std::chrono::system_clock::now();
   while (!isCancelled)
   {
-    test.Run(context);
+    if (pacer != nullptr)
+    {
+      // Latency is measured from the scheduled start, so that it includes the time the operation
+      // spent waiting for a test to be available.
+      std::chrono::steady_clock::time_point operationStart;
+      if (!pacer->TryGetNextStart(operationStart))
+      {
+        break;
+      }
+      std::this_thread::sleep_until(operationStart);
+      test.Run(context);
+      if (latency != nullptr)
+      {
+        latency->Record(std::chrono::steady_clock::now() - operationStart);
+      }
+    }
+    else if (latency != nullptr)
+    {
+      auto operationStart = std::chrono::steady_clock::now();
+      test.Run(context);
+      latency->Record(std::chrono::steady_clock::now() - operationStart);
+    }
+    else
+    {
+      test.Run(context);
+    }
     completedOperations += 1;
     lastCompletionTimes = std::chrono::system_clock::now() - start;
   }
@@ -188,21 +249,288 @@ inline std::vector<double> ZipAvg(
   return s;
 }
 
-inline void RunTests(
+// Percentiles reported for latency, besides the max.
+constexpr double LatencyPercentiles[] = {50.0, 90.0, 99.0, 99.9};
+
+struct RunResults
+{
+  std::string Title;
+  std::vector<uint64_t> CompletedOperations;
+  std::vector<std::chrono::nanoseconds> LastCompletionTimes;
+  // One histogram per parallel test, only set when latency is tracked.
+  std::vector<Azure::Perf::LatencyHistogram> Latencies;
+  // Only set when allocations are counted.
+  bool HasAllocations = false;
+  uint64_t Allocations = 0;
+  uint64_t AllocatedBytes = 0;
+};
+
+inline double PerOperation(uint64_t value, uint64_t operations)
+{
+  return operations == 0 ? 0.0 : static_cast<double>(value) / operations;
+}
+
+inline double ToMilliseconds(std::chrono::nanoseconds value)
+{
+  return std::chrono::duration<double, std::milli>(value).count();
+}
+
+inline std::string FormatMilliseconds(std::chrono::nanoseconds value)
+{
+  std::ostringstream stream;
+  stream << std::fixed << std::setprecision(3) << ToMilliseconds(value) << "ms";
+  return stream.str();
+}
+
+// Formats a percentile for use in a column or field name, e.g. 99.9 as "99_9".
+inline std::string PercentileName(double percentile)
+{
+  std::ostringstream stream;
+  stream << percentile;
+  auto name = stream.str();
+  std::replace(name.begin(), name.end(), '.', '_');
+  return name;
+}
+
+inline Azure::Perf::LatencyHistogram MergeLatencies(
+    std::vector<Azure::Perf::LatencyHistogram> const& latencies)
+{
+  Azure::Perf::LatencyHistogram merged;
+  for (auto const& latency : latencies)
+  {
+    merged.Merge(latency);
+  }
+  return merged;
+}
+
+inline void PrintLatencyDistribution(Azure::Perf::LatencyHistogram const& latency)
+{
+  std::cout << "=== Latency Distribution ===" << std::endl;
+  for (auto percentile : LatencyPercentiles)
+  {
+    std::ostringstream label;
+    label << std::fixed << std::setprecision(2) << std::setw(6) << percentile;
+    std::cout << "[" << label.str() << "%] " << std::setw(12)
+              << FormatMilliseconds(latency.ValueAtPercentile(percentile)) << std::endl;
+  }
+  std::cout << "[   max ] " << std::setw(12) << FormatMilliseconds(latency.Max()) << std::endl
+            << "[  mean ] " << std::setw(12) << FormatMilliseconds(latency.Mean()) << std::endl
+            << std::endl;
+}
+
+inline void PrintJobStatistics(RunResults const& results)
+{
+  std::cout << "=== Job Statistics ===" << std::endl << "Task\tOperations\tops/s";
+  if (!results.Latencies.empty())
+  {
+    std::cout << "\t\tp50\t\tp99\t\tmax";
+  }
+  std::cout << std::endl;
+  for (size_t index = 0; index != results.CompletedOperations.size(); index++)
+  {
+    auto const operations = results.CompletedOperations[index];
+    auto const seconds
+        = std::chrono::duration<double>(results.LastCompletionTimes[index]).count();
+    std::cout << index << "\t" << operations << "\t\t" << std::fixed << std::setprecision(2)
+              << (seconds > 0 ? operations / seconds : 0.0);
+    if (!results.Latencies.empty())
+    {
+      auto const& latency = results.Latencies[index];
+      std::cout << "\t\t" << FormatMilliseconds(latency.ValueAtPercentile(50)) << "\t\t"
+                << FormatMilliseconds(latency.ValueAtPercentile(99)) << "\t\t"
+                << FormatMilliseconds(latency.Max());
+    }
+    std::cout << std::endl;
+  }
+  std::cout.unsetf(std::ios_base::floatfield);
+  std::cout << std::setprecision(6) << std::endl;
+}
+
+inline Azure::Core::Json::_internal::json LatencyToJson(
+    Azure::Perf::LatencyHistogram const& latency)
+{
+  Azure::Core::Json::_internal::json result;
+  result["Count"] = latency.Count();
+  result["MinMs"] = ToMilliseconds(latency.Min());
+  result["MeanMs"] = ToMilliseconds(latency.Mean());
+  for (auto percentile : LatencyPercentiles)
+  {
+    std::ostringstream name;
+    name << "P" << PercentileName(percentile) << "Ms";
+    result[name.str()] = ToMilliseconds(latency.ValueAtPercentile(percentile));
+  }
+  result["MaxMs"] = ToMilliseconds(latency.Max());
+  return result;
+}
+
+inline void WriteResultsFile(
+    std::string const& fileName,
+    std::string const& testName,
+    Azure::Perf::GlobalTestOptions const& options,
+    std::vector<RunResults> const& allResults)
+{
+  std::ofstream file(fileName);
+  if (!file)
+  {
+    throw std::runtime_error("Unable to open results file: " + fileName);
+  }
+
+  bool const asCsv = fileName.size() >= 4
+      && Azure::Core::_internal::StringExtensions::LocaleInvariantCaseInsensitiveEqual(
+                         fileName.substr(fileName.size() - 4), ".csv");
+  if (asCsv)
+  {
+    file << "iteration,task,operations,seconds,ops_per_sec";
+    for (auto percentile : LatencyPercentiles)
+    {
+      file << ",p" << PercentileName(percentile) << "_ms";
+    }
+    file << ",max_ms,allocs_per_op,alloc_bytes_per_op" << std::endl;
+
+    auto writeRow = [&file](
+                        std::string const& title,
+                        std::string const& task,
+                        uint64_t operations,
+                        double seconds,
+                        double operationsPerSecond,
+                        Azure::Perf::LatencyHistogram const* latency,
+                        RunResults const* allocations) {
+      file << title << "," << task << "," << operations << "," << seconds << ","
+           << operationsPerSecond;
+      for (auto percentile : LatencyPercentiles)
+      {
+        file << ",";
+        if (latency != nullptr)
+        {
+          file << ToMilliseconds(latency->ValueAtPercentile(percentile));
+        }
+      }
+      file << ",";
+      if (latency != nullptr)
+      {
+        file << ToMilliseconds(latency->Max());
+      }
+      file << ",";
+      if (allocations != nullptr)
+      {
+        file << PerOperation(allocations->Allocations, operations) << ","
+             << PerOperation(allocations->AllocatedBytes, operations);
+      }
+      else
+      {
+        file << ",";
+      }
+      file << std::endl;
+    };
+
+    for (auto const& results : allResults)
+    {
+      auto const hasLatency = !results.Latencies.empty();
+      for (size_t index = 0; index != results.CompletedOperations.size(); index++)
+      {
+        auto const seconds
+            = std::chrono::duration<double>(results.LastCompletionTimes[index]).count();
+        writeRow(
+            results.Title,
+            std::to_string(index),
+            results.CompletedOperations[index],
+            seconds,
+            seconds > 0 ? results.CompletedOperations[index] / seconds : 0.0,
+            hasLatency ? &results.Latencies[index] : nullptr,
+            nullptr);
+      }
+      auto const totalOperations = Sum(results.CompletedOperations);
+      auto const operationsPerSecond
+          = Sum(ZipAvg(results.CompletedOperations, results.LastCompletionTimes));
+      auto const merged = MergeLatencies(results.Latencies);
+      writeRow(
+          results.Title,
+          "all",
+          totalOperations,
+          operationsPerSecond > 0 ? totalOperations / operationsPerSecond : 0.0,
+          operationsPerSecond,
+          hasLatency ? &merged : nullptr,
+          results.HasAllocations ? &results : nullptr);
+    }
+    return;
+  }
+
+  Azure::Core::Json::_internal::json json;
+  json["Test"] = testName;
+  json["Options"] = options;
+  json["Iterations"] = Azure::Core::Json::_internal::json::array();
+  for (auto const& results : allResults)
+  {
+    Azure::Core::Json::_internal::json iteration;
+    iteration["Title"] = results.Title;
+    iteration["Operations"] = Sum(results.CompletedOperations);
+    iteration["OperationsPerSecond"]
+        = Sum(ZipAvg(results.CompletedOperations, results.LastCompletionTimes));
+    if (!results.Latencies.empty())
+    {
+      iteration["Latency"] = LatencyToJson(MergeLatencies(results.Latencies));
+    }
+    if (results.HasAllocations)
+    {
+      auto const operations = Sum(results.CompletedOperations);
+      iteration["Allocations"] = {
+          {"Count", results.Allocations},
+          {"Bytes", results.AllocatedBytes},
+          {"PerOperation", PerOperation(results.Allocations, operations)},
+          {"BytesPerOperation", PerOperation(results.AllocatedBytes, operations)},
+      };
+    }
+    iteration["Tasks"] = Azure::Core::Json::_internal::json::array();
+    for (size_t index = 0; index != results.CompletedOperations.size(); index++)
+    {
+      Azure::Core::Json::_internal::json task;
+      auto const seconds
+          = std::chrono::duration<double>(results.LastCompletionTimes[index]).count();
+      task["Index"] = index;
+      task["Operations"] = results.CompletedOperations[index];
+      task["OperationsPerSecond"]
+          = seconds > 0 ? results.CompletedOperations[index] / seconds : 0.0;
+      if (!results.Latencies.empty())
+      {
+        task["Latency"] = LatencyToJson(results.Latencies[index]);
+      }
+      iteration["Tasks"].push_back(task);
+    }
+    json["Iterations"].push_back(iteration);
+  }
+  file << json.dump(2) << std::endl;
+}
+
+inline RunResults RunTests(
     Azure::Core::Context const& context,
     std::vector<std::unique_ptr<Azure::Perf::PerfTest>> const& tests,
     Azure::Perf::GlobalTestOptions const& options,
     std::string const& title,
     bool warmup = false)
 {
-  (void)title;
   auto parallelTestsCount = options.Parallel;
   auto durationInSeconds = warmup ? options.Warmup : options.Duration;
-  // auto jobStatistics = warmup ? false : options.JobStatistics;
-  // auto latency = warmup ? false : options.Latency;
+  auto jobStatistics = warmup ? false : options.JobStatistics;
+  auto latency = warmup ? false : options.Latency;
+  auto allocations = warmup ? false : options.Allocations;
+
+  RunResults results;
+  results.Title = title;
+  auto& completedOperations = results.CompletedOperations;
+  auto& lastCompletionTimes = results.LastCompletionTimes;
+  completedOperations.resize(parallelTestsCount);
+  lastCompletionTimes.resize(parallelTestsCount);
+  if (latency)
+  {
+    results.Latencies.resize(parallelTestsCount);
+  }
 
-  std::vector<uint64_t> completedOperations(parallelTestsCount);
-  std::vector<std::chrono::nanoseconds> lastCompletionTimes(parallelTestsCount);
+  std::unique_ptr<RatePacer> pacer;
+  if (options.Rate)
+  {
+    pacer = std::make_unique<RatePacer>(
+        options.Rate.Value(), std::chrono::seconds(durationInSeconds));
+  }
 
   /********************* Progress Reporter ******************************/
   Azure::Core::Context progressToken;
@@ -224,13 +552,23 @@ inline void RunTests(
         }
       });
 
+  uint64_t const startAllocations = Azure::Perf::AllocationCounter::GetAllocationCount();
+  uint64_t const startAllocatedBytes = Azure::Perf::AllocationCounter::GetAllocatedBytes();
+
   /********************* parallel test creation ******************************/
   std::vector<std::thread> tasks(tests.size());
   auto deadLineSeconds = std::chrono::seconds(durationInSeconds);
   for (size_t index = 0; index != tests.size(); index++)
   {
     tasks[index] = std::thread(
-        [index, &tests, &completedOperations, &lastCompletionTimes, &deadLineSeconds, &context]() {
+        [index,
+         &tests,
+         &results,
+         &completedOperations,
+         &lastCompletionTimes,
+         &deadLineSeconds,
+         &pacer,
+         &context]() {
           bool isCancelled = false;
           // Azure::Context is not good performer for checking cancellation inside the test loop
           auto manualCancellation = std::thread([&deadLineSeconds, &isCancelled] {
@@ -243,7 +581,8 @@ inline void RunTests(
               *tests[index],
               completedOperations[index],
               lastCompletionTimes[index],
-              false,
+              results.Latencies.empty() ? nullptr : &results.Latencies[index],
+              pacer.get(),
               isCancelled);
 
           manualCancellation.join();
@@ -255,6 +594,15 @@ inline void RunTests(
     t.join();
   }
 
+  if (allocations)
+  {
+    results.HasAllocations = true;
+    results.Allocations
+        = Azure::Perf::AllocationCounter::GetAllocationCount() - startAllocations;
+    results.AllocatedBytes
+        = Azure::Perf::AllocationCounter::GetAllocatedBytes() - startAllocatedBytes;
+  }
+
   // Stop progress
   progressToken.Cancel();
   progressThread.join();
@@ -271,8 +619,32 @@ inline void RunTests(
             << " operations in a weighted-average of "
             << FormatNumber(weightedAverageSeconds, false) << "s ("
             << FormatNumber(operationsPerSecond) << " ops/s, " << secondsPerOperation << " s/op)"
-            << std::endl
             << std::endl;
+  if (pacer)
+  {
+    std::cout << "Target throughput was " << FormatNumber(options.Rate.Value(), false)
+              << " ops/s" << std::endl;
+  }
+  if (allocations)
+  {
+    std::ostringstream allocationsInfo;
+    allocationsInfo << std::fixed << std::setprecision(2) << "Allocations: "
+                    << PerOperation(results.Allocations, totalOperations) << " per operation, "
+                    << PerOperation(results.AllocatedBytes, totalOperations)
+                    << " bytes per operation";
+    std::cout << allocationsInfo.str() << std::endl;
+  }
+  std::cout << std::endl;
+
+  if (latency)
+  {
+    PrintLatencyDistribution(MergeLatencies(results.Latencies));
+  }
+  if (jobStatistics)
+  {
+    PrintJobStatistics(results);
+  }
+  return results;
 }
 
 } // namespace
@@ -313,6 +685,10 @@ void Azure::Perf::Program::Run(
   // ReCreate Test with parsed results
   test = testGenerator(Azure::Perf::TestOptions(argResults));
   GlobalTestOptions options = Azure::Perf::Program::ArgParser::Parse(argResults);
+  if (options.Allocations)
+  {
+    Azure::Perf::AllocationCounter::Enable();
+  }
 
   if (options.JobStatistics)
   {
@@ -393,13 +769,20 @@ void Azure::Perf::Program::Run(
 
   /******************** Tests ******************************/
   std::string iterationInfo;
+  std::vector<RunResults> allResults;
   for (int iteration = 0; iteration < options.Iterations; iteration++)
   {
     if (iteration > 0)
     {
       iterationInfo.append(FormatNumber(iteration));
     }
-    RunTests(context, parallelTest, options, "Test" + iterationInfo);
+    allResults.push_back(RunTests(context, parallelTest, options, "Test" + iterationInfo));
+  }
+
+  if (!options.ResultsFile.empty())
+  {
+    WriteResultsFile(options.ResultsFile, testMetadata->Name, options, allResults);
+    std::cout << std::endl << "Results written to " << options.ResultsFile << std::endl;
   }
 
   std::cout << std::endl << "=== Pre-Cleanup ===" << std::endl;
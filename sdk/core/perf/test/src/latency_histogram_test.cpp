@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include <azure/perf/latency_histogram.hpp>
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+TEST(latency_histogram, empty)
+{
+  Azure::Perf::LatencyHistogram histogram;
+  EXPECT_EQ(histogram.Count(), 0U);
+  EXPECT_EQ(histogram.Min(), 0ns);
+  EXPECT_EQ(histogram.Max(), 0ns);
+  EXPECT_EQ(histogram.Mean(), 0ns);
+  EXPECT_EQ(histogram.ValueAtPercentile(50), 0ns);
+}
+
+TEST(latency_histogram, exactSmallValues)
+{
+  Azure::Perf::LatencyHistogram histogram;
+  for (int i = 1; i <= 100; i++)
+  {
+    histogram.Record(std::chrono::nanoseconds(i));
+  }
+  EXPECT_EQ(histogram.Count(), 100U);
+  EXPECT_EQ(histogram.Min(), 1ns);
+  EXPECT_EQ(histogram.Max(), 100ns);
+  EXPECT_EQ(histogram.Mean(), 50ns);
+  EXPECT_EQ(histogram.ValueAtPercentile(50), 50ns);
+  EXPECT_EQ(histogram.ValueAtPercentile(99), 99ns);
+  EXPECT_EQ(histogram.ValueAtPercentile(100), 100ns);
+  EXPECT_EQ(histogram.ValueAtPercentile(0), 1ns);
+}
+
+TEST(latency_histogram, relativeError)
+{
+  Azure::Perf::LatencyHistogram histogram;
+  for (int i = 1; i <= 10000; i++)
+  {
+    histogram.Record(std::chrono::microseconds(i));
+  }
+  EXPECT_EQ(histogram.Min(), 1us);
+  EXPECT_EQ(histogram.Max(), 10000us);
+
+  auto const expectNear = [&histogram](double percentile, std::chrono::nanoseconds expected) {
+    auto const actual = histogram.ValueAtPercentile(percentile);
+    EXPECT_GE(actual, expected);
+    EXPECT_LE(actual.count(), expected.count() + expected.count() / 100);
+  };
+  expectNear(50, 5000us);
+  expectNear(90, 9000us);
+  expectNear(99, 9900us);
+  expectNear(99.9, 9990us);
+}
+
+TEST(latency_histogram, merge)
+{
+  Azure::Perf::LatencyHistogram first;
+  Azure::Perf::LatencyHistogram second;
+  first.Record(10ms);
+  first.Record(20ms);
+  second.Record(1ms);
+  second.Record(30ms);
+
+  first.Merge(second);
+  first.Merge(Azure::Perf::LatencyHistogram());
+  EXPECT_EQ(first.Count(), 4U);
+  EXPECT_EQ(first.Min(), 1ms);
+  EXPECT_EQ(first.Max(), 30ms);
+  EXPECT_EQ(first.Mean(), 15250us);
+  EXPECT_EQ(first.ValueAtPercentile(100), 30ms);
+}
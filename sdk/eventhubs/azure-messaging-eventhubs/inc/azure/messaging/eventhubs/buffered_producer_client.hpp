@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+#include "models/event_data.hpp"
+#include "producer_client.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/datetime.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Messaging { namespace EventHubs {
+  namespace _detail {
+    class BufferedPartitionPublisher;
+  }
+
+  /**@brief Contains options for the BufferedProducerClient creation.
+   */
+  struct BufferedProducerClientOptions final
+  {
+    /**@brief MaxWaitTime is how long a partially filled batch waits for more events before it is
+     * sent. The default value is 1 second.
+     */
+    Azure::DateTime::duration MaxWaitTime{std::chrono::seconds(1)};
+
+    /**@brief MaxEventBufferLengthPerPartition is the number of events that can be buffered for a
+     * partition, including the events being sent. Enqueue blocks while the buffer of the
+     * partition is full. The default value is 1500 events.
+     */
+    std::uint32_t MaxEventBufferLengthPerPartition{1500};
+
+    /**@brief MaxConcurrentSendsPerPartition is the number of batches that can be in flight to a
+     * partition at the same time. Each concurrent send uses its own link, and events may be
+     * published out of order when this is greater than 1. The default value is 1.
+     */
+    std::uint32_t MaxConcurrentSendsPerPartition{1};
+
+    /**@brief OnSendSucceeded is called with the events of each batch that was published.
+     */
+    std::function<
+        void(std::string const& partitionId, std::vector<Models::EventData> const& events)>
+        OnSendSucceeded;
+
+    /**@brief OnSendFailed is called with the events of each batch that could not be published,
+     * after the retries of the ProducerClient have been exhausted. When it is not set, the failure
+     * is logged.
+     */
+    std::function<void(
+        std::string const& partitionId,
+        std::vector<Models::EventData> const& events,
+        std::exception const& error)>
+        OnSendFailed;
+  };
+
+  /**@brief Contains options for the BufferedProducerClient::Enqueue operation.
+   */
+  struct EnqueueEventOptions final
+  {
+    /**@brief PartitionId is the ID of the partition to send the event to. When it is empty, the
+     * events are distributed across the partitions of the Event Hub in a round-robin fashion.
+     */
+    std::string PartitionId;
+  };
+
+  /**@brief BufferedProducerClient publishes events to an Event Hub without the application having
+   * to build batches.
+   *
+   * @remark Enqueued events are buffered per partition and packed into batches of the maximum
+   * size by background workers. A batch is sent when it is full, when it has waited for
+   * MaxWaitTime, or when Flush or Close is called. The outcome of each send is reported through
+   * the OnSendSucceeded and OnSendFailed callbacks, which are called from the background workers.
+   */
+  class BufferedProducerClient final {
+  public:
+    /**@brief Constructs a new BufferedProducerClient instance.
+     *
+     * @param producerClient The ProducerClient used to send the batches.
+     * @param options Additional options for buffering the events.
+     */
+    BufferedProducerClient(
+        std::shared_ptr<ProducerClient> producerClient,
+        BufferedProducerClientOptions const& options = {});
+
+    /**@brief Sends the buffered events and stops the background workers.
+     */
+    ~BufferedProducerClient();
+
+    /** Create a BufferedProducerClient from another BufferedProducerClient. */
+    BufferedProducerClient(BufferedProducerClient const& other) = delete;
+
+    /** Assign a BufferedProducerClient to another BufferedProducerClient. */
+    BufferedProducerClient& operator=(BufferedProducerClient const& other) = delete;
+
+    /**@brief Adds an event to the buffer of its partition.
+     *
+     * @param eventData The event to publish.
+     * @param options Options for the partition assignment of the event.
+     * @param context Context for the operation; cancelling it stops waiting for buffer space.
+     *
+     * @remark This function blocks while the buffer of the partition is full.
+     */
+    void Enqueue(
+        Models::EventData const& eventData,
+        EnqueueEventOptions const& options = {},
+        Core::Context const& context = {});
+
+    /**@brief Sends all buffered events and waits until they have been published or have failed.
+     *
+     * @param context Context for the operation can be used for request cancellation.
+     */
+    void Flush(Core::Context const& context = {});
+
+    /**@brief Sends all buffered events and stops the background workers. Events cannot be
+     * enqueued once the client has been closed.
+     *
+     * @remark When \p context is cancelled, the sends in progress are cancelled and their events
+     * are reported through the OnSendFailed callback.
+     *
+     * @param context Context for the operation can be used for request cancellation.
+     */
+    void Close(Core::Context const& context = {});
+
+    /**@brief Gets the number of events that have been enqueued and have not been published or
+     * failed yet.
+     */
+    std::size_t GetBufferedEventCount() const;
+
+  private:
+    std::shared_ptr<ProducerClient> m_producerClient;
+    BufferedProducerClientOptions m_options;
+
+    mutable std::mutex m_publishersLock;
+    std::map<std::string, std::unique_ptr<_detail::BufferedPartitionPublisher>> m_publishers;
+    std::vector<std::string> m_partitionIds;
+    std::size_t m_nextPartition{};
+    bool m_closed{};
+
+    _detail::BufferedPartitionPublisher& GetPublisher(
+        EnqueueEventOptions const& options,
+        Core::Context const& context);
+  };
+}}} // namespace Azure::Messaging::EventHubs
@@ -61,6 +61,21 @@ namespace Azure { namespace Messaging { namespace EventHubs {
         Core::Context const& context = {})
         = 0;
 
+    /**@brief  UpdateCheckpoints updates the checkpoints of several partitions.
+     *
+     * The default implementation calls UpdateCheckpoint for each checkpoint. Stores which can write
+     * several checkpoints in fewer round trips should override it.
+     */
+    virtual void UpdateCheckpoints(
+        std::vector<Models::Checkpoint> const& checkpoints,
+        Core::Context const& context = {})
+    {
+      for (auto const& checkpoint : checkpoints)
+      {
+        UpdateCheckpoint(checkpoint, context);
+      }
+    }
+
     virtual ~CheckpointStore() = default;
   };
 
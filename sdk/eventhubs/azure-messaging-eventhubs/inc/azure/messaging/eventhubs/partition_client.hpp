@@ -11,9 +11,13 @@
 #include <azure/core/http/policies/policy.hpp>
 #include <azure/core/nullable.hpp>
 
+#include <cstdint>
+#include <memory>
+
 namespace Azure { namespace Messaging { namespace EventHubs {
   namespace _detail {
     class PartitionClientFactory;
+    class ReceivedEventPrefetcher;
   }
   /**brief PartitionClientOptions provides options for the ConsumerClient::CreatePartitionClient
    * function.
@@ -48,6 +52,15 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      */
 
     int32_t Prefetch = 300;
+
+    /**@brief DecodedEventBufferSize is the number of received events which are decoded ahead of
+     * ReceiveEvents(). When set, a background thread converts the received AMQP messages into
+     * ReceivedEventData, so that ReceiveEvents() returns events which are already decoded.
+     *
+     * Disabled (events are decoded by ReceiveEvents()) if DecodedEventBufferSize == 0, which is
+     * the default.
+     */
+    std::uint32_t DecodedEventBufferSize = 0;
   };
 
   /** PartitionClient is used to receive events from an Event Hub partition.
@@ -85,7 +98,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
 
     /** @brief Closes the connection to the Event Hub service.
      */
-    void Close(Core::Context const& context) { m_receiver.Close(context); }
+    void Close(Core::Context const& context);
 
   private:
     friend class _detail::PartitionClientFactory;
@@ -103,6 +116,9 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      */
     Azure::Core::Http::Policies::RetryOptions m_retryOptions{};
 
+    /// Decodes the received events ahead of ReceiveEvents, when DecodedEventBufferSize is set.
+    std::shared_ptr<_detail::ReceivedEventPrefetcher> m_prefetcher;
+
     /** Creates a new PartitionClient
      *
      * @param messageReceiver Message Receiver for the partition client.
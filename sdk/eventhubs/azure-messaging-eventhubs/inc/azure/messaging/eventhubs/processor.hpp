@@ -67,6 +67,26 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      * of partitions to process.
      */
     int32_t MaximumNumberOfPartitions{0};
+
+    /** @brief Specifies how often checkpoints are written to the CheckpointStore.
+     *
+     * When this or CheckpointFlushCount is set, ProcessorPartitionClient::UpdateCheckpoint records
+     * the checkpoint and returns without waiting for the CheckpointStore. Only the most recent
+     * checkpoint of each partition is kept, and the checkpoints are written by a background thread.
+     * The pending checkpoint of a partition is also written when its partition client is closed,
+     * and all pending checkpoints are written when the processor is stopped. The pending
+     * checkpoint of a partition whose ownership is lost to another processor is discarded.
+     *
+     * By default, each call to UpdateCheckpoint updates the CheckpointStore before returning.
+     */
+    Azure::DateTime::duration CheckpointFlushInterval{};
+
+    /** @brief Specifies the number of checkpoint updates after which the pending checkpoints are
+     * written to the CheckpointStore, without waiting for CheckpointFlushInterval to elapse.
+     *
+     * Zero means the number of updates does not trigger a write.
+     */
+    uint32_t CheckpointFlushCount{0};
   };
 
   /**@brief Processor uses a [ConsumerClient] and [CheckpointStore] to provide automatic
@@ -76,7 +96,8 @@ namespace Azure { namespace Messaging { namespace EventHubs {
 
   namespace _detail {
     class ProcessorLoadBalancer;
-  }
+    class CheckpointCoalescer;
+  } // namespace _detail
 
   /** @brief Processor uses a ConsumerClient and CheckpointStore to provide automatic load balancing
    * between multiple Processor instances, even in separate processes or on separate machines.
@@ -273,6 +294,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     Channel<std::shared_ptr<ProcessorPartitionClient>> m_nextPartitionClients;
     Models::ConsumerClientDetails m_consumerClientDetails;
     std::shared_ptr<_detail::ProcessorLoadBalancer> m_loadBalancer;
+    std::shared_ptr<_detail::CheckpointCoalescer> m_checkpointCoalescer;
     int64_t m_processorOwnerLevel{0};
     bool m_isRunning{false};
     std::thread m_processorThread;
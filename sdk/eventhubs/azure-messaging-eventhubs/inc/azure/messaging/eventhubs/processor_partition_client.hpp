@@ -5,6 +5,9 @@
 #include "consumer_client.hpp"
 
 namespace Azure { namespace Messaging { namespace EventHubs {
+  namespace _detail {
+    class CheckpointCoalescer;
+  }
 
   /**@brief  ProcessorPartitionClient allows you to receive events, similar to a [PartitionClient],
    * with a checkpoint store for tracking progress.
@@ -48,6 +51,10 @@ namespace Azure { namespace Messaging { namespace EventHubs {
      *
      * Subsequent partition client reads will start from this event.
      *
+     * @remark If the processor was created with ProcessorOptions::CheckpointFlushInterval or
+     * ProcessorOptions::CheckpointFlushCount, the checkpoint is written to the checkpoint store
+     * later, by a background thread, and errors writing it are logged rather than thrown.
+     *
      * @param eventData The event data to use for updating the checkpoint.
      * @param context The context to pass to the update checkpoint operation.
      */
@@ -59,17 +66,14 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     std::string PartitionId() const { return m_partitionId; }
 
     /** @brief Closes the partition client.
+     *
+     * The checkpoint of this partition which has not been written to the checkpoint store yet is
+     * written first. If writing it fails, the checkpoint is discarded and the partition client is
+     * still closed before the error is thrown.
      *
      * @param context The context to pass to the close operation.
      */
-    void Close(Core::Context const& context = {})
-    {
-      if (m_cleanupFunc)
-      {
-        m_cleanupFunc();
-      }
-      m_partitionClient->Close(context);
-    }
+    void Close(Core::Context const& context = {});
 
   private:
     std::string m_partitionId;
@@ -77,23 +81,30 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     std::shared_ptr<CheckpointStore> m_checkpointStore;
     std::function<void()> m_cleanupFunc;
     Models::ConsumerClientDetails m_consumerClientDetails;
+    std::shared_ptr<_detail::CheckpointCoalescer> m_checkpointCoalescer;
 
     /**  Constructs a new instance of the ProcessorPartitionClient.
      * @param partitionId The identifier of the partition to connect the client to.
      * @param checkpointStore The [CheckpointStore] to use for storing checkpoints.
      * @param consumerClientDetails The [ConsumerClientDetails] to use for storing checkpoints.
      * @param cleanupFunc The function to call when the ProcessorPartitionClient is closed.
+     * @param checkpointCoalescer If not null, collects the checkpoints to write them in the
+     * background.
      */
     ProcessorPartitionClient(
         std::string partitionId,
         std::shared_ptr<CheckpointStore> checkpointStore,
         Models::ConsumerClientDetails consumerClientDetails,
-        std::function<void()> cleanupFunc)
+        std::function<void()> cleanupFunc,
+        std::shared_ptr<_detail::CheckpointCoalescer> checkpointCoalescer = nullptr)
         : m_partitionId(partitionId), m_checkpointStore(checkpointStore),
-          m_cleanupFunc(cleanupFunc), m_consumerClientDetails(consumerClientDetails)
+          m_cleanupFunc(cleanupFunc), m_consumerClientDetails(consumerClientDetails),
+          m_checkpointCoalescer(std::move(checkpointCoalescer))
     {
     }
 
+    void WriteCheckpoint(Models::Checkpoint const& checkpoint, Core::Context const& context);
+
     void SetPartitionClient(std::unique_ptr<PartitionClient>& partitionClient)
     {
       m_partitionClient = std::move(partitionClient);
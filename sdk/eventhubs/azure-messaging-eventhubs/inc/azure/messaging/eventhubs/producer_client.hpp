@@ -21,6 +21,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
   } // namespace _detail
 
   class ProducerClient;
+  class BufferedProducerClient;
 
   /**@brief Contains options for the ProducerClient creation
    */
@@ -172,6 +173,9 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     }
 
   private:
+    // The buffered producer sends on the links of this client.
+    friend class BufferedProducerClient;
+
     /// The connection string for the Event Hubs namespace
     std::string m_connectionString;
 
@@ -214,13 +218,22 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     // Ensure that a session for the specified partition ID has been established.
     void EnsureSession(std::string const& partitionId, Azure::Core::Context const& context);
 
-    // Ensure that a message sender for the specified partition has been created.
-    void EnsureSender(std::string const& partitionId, Azure::Core::Context const& context);
+    // Ensure that a message sender for the specified partition has been created. Additional
+    // links to the same partition (linkIndex > 0) let several batches be in flight at once.
+    void EnsureSender(
+        std::string const& partitionId,
+        Azure::Core::Context const& context,
+        size_t linkIndex = 0);
+
+    // Send a batch on one of the links to its partition. The link must have been created.
+    void Send(EventDataBatch const& eventDataBatch, size_t linkIndex, Core::Context const& context);
 
     std::shared_ptr<_detail::EventHubsPropertiesClient> GetPropertiesClient(
         Azure::Core::Context const& context);
 
-    Azure::Core::Amqp::_internal::MessageSender GetSender(std::string const& partitionId);
+    Azure::Core::Amqp::_internal::MessageSender GetSender(
+        std::string const& partitionId,
+        size_t linkIndex = 0);
     Azure::Core::Amqp::_internal::Session GetSession(std::string const& partitionId);
   };
 }}} // namespace Azure::Messaging::EventHubs
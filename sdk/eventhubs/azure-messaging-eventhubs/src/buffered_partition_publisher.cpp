@@ -0,0 +1,251 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "private/buffered_partition_publisher.hpp"
+
+#include <azure/core/diagnostics/logger.hpp>
+#include <azure/core/internal/diagnostics/log.hpp>
+
+#include <chrono>
+#include <stdexcept>
+
+using namespace Azure::Core::Diagnostics::_internal;
+using namespace Azure::Core::Diagnostics;
+
+namespace {
+// How often a caller blocked on the buffer checks its context for cancellation.
+constexpr auto CancellationPollInterval = std::chrono::milliseconds(100);
+} // namespace
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+
+  BufferedPartitionPublisher::BufferedPartitionPublisher(
+      std::size_t maxBufferLength,
+      std::size_t maxConcurrentSends,
+      Azure::DateTime::duration maxWaitTime,
+      CreateBatchFunction createBatch,
+      SendBatchFunction sendBatch,
+      CompletionFunction onComplete)
+      : m_maxBufferLength{maxBufferLength == 0 ? 1 : maxBufferLength},
+        m_maxWaitTime{maxWaitTime}, m_createBatch{std::move(createBatch)},
+        m_sendBatch{std::move(sendBatch)}, m_onComplete{std::move(onComplete)}
+  {
+    if (maxConcurrentSends == 0)
+    {
+      maxConcurrentSends = 1;
+    }
+    m_workers.reserve(maxConcurrentSends);
+    for (std::size_t linkIndex = 0; linkIndex < maxConcurrentSends; ++linkIndex)
+    {
+      m_workers.emplace_back([this, linkIndex]() { RunWorker(linkIndex); });
+    }
+  }
+
+  BufferedPartitionPublisher::~BufferedPartitionPublisher()
+  {
+    // Don't wait for the buffered events; they are reported as failed.
+    Azure::Core::Context cancelled;
+    cancelled.Cancel();
+    Close(cancelled);
+  }
+
+  void BufferedPartitionPublisher::Enqueue(
+      Models::EventData const& eventData,
+      Azure::Core::Context const& context)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_closing && m_bufferedEventCount >= m_maxBufferLength)
+    {
+      context.ThrowIfCancelled();
+      m_eventsCompleted.wait_for(lock, CancellationPollInterval);
+    }
+    if (m_closing)
+    {
+      throw std::runtime_error("Events cannot be enqueued after the producer has been closed.");
+    }
+    m_events.push_back(eventData);
+    ++m_bufferedEventCount;
+    m_workAvailable.notify_one();
+  }
+
+  void BufferedPartitionPublisher::Flush(Azure::Core::Context const& context)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    ++m_pendingFlushes;
+    m_workAvailable.notify_all();
+    try
+    {
+      while (m_bufferedEventCount != 0)
+      {
+        context.ThrowIfCancelled();
+        m_eventsCompleted.wait_for(lock, CancellationPollInterval);
+      }
+    }
+    catch (...)
+    {
+      --m_pendingFlushes;
+      throw;
+    }
+    --m_pendingFlushes;
+  }
+
+  void BufferedPartitionPublisher::Close(Azure::Core::Context const& context)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (m_closing)
+      {
+        return;
+      }
+      m_closing = true;
+    }
+    m_workAvailable.notify_all();
+    m_eventsCompleted.notify_all();
+
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      while (m_bufferedEventCount != 0 && !context.IsCancelled())
+      {
+        m_eventsCompleted.wait_for(lock, CancellationPollInterval);
+      }
+    }
+    m_context.Cancel();
+
+    for (auto& worker : m_workers)
+    {
+      if (worker.joinable())
+      {
+        worker.join();
+      }
+    }
+  }
+
+  std::size_t BufferedPartitionPublisher::GetBufferedEventCount() const
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_bufferedEventCount;
+  }
+
+  void BufferedPartitionPublisher::Complete(
+      std::vector<Models::EventData> const& events,
+      std::exception_ptr error)
+  {
+    try
+    {
+      m_onComplete(events, error);
+    }
+    catch (std::exception const& ex)
+    {
+      Log::Stream(Logger::Level::Warning)
+          << "Exception thrown by the send completion handler: " << ex.what();
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_bufferedEventCount -= events.size();
+    m_eventsCompleted.notify_all();
+  }
+
+  void BufferedPartitionPublisher::RunWorker(std::size_t linkIndex)
+  {
+    Azure::Core::Context const& context = m_context;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;)
+    {
+      m_workAvailable.wait(lock, [this]() { return !m_events.empty() || m_closing; });
+      if (m_events.empty())
+      {
+        // Closing, and every buffered event has been taken by a worker.
+        return;
+      }
+
+      lock.unlock();
+      std::unique_ptr<EventDataBatch> batch;
+      try
+      {
+        batch = std::make_unique<EventDataBatch>(m_createBatch(context));
+      }
+      catch (...)
+      {
+        // The batch can't be created (typically because the link can't be opened); fail the
+        // oldest event so that a broken partition doesn't hold the buffer indefinitely.
+        auto error = std::current_exception();
+        lock.lock();
+        if (m_events.empty())
+        {
+          continue;
+        }
+        std::vector<Models::EventData> failed{m_events.front()};
+        m_events.pop_front();
+        lock.unlock();
+        Complete(failed, error);
+        lock.lock();
+        continue;
+      }
+      lock.lock();
+
+      // Fill the batch, lingering for more events until the deadline or a flush or close.
+      std::vector<Models::EventData> events;
+      auto const deadline = std::chrono::steady_clock::now() + m_maxWaitTime;
+      for (;;)
+      {
+        if (m_events.empty())
+        {
+          if (ShouldSendNow()
+              || !m_workAvailable.wait_until(lock, deadline, [this]() {
+                   return !m_events.empty() || ShouldSendNow();
+                 }))
+          {
+            break;
+          }
+          continue;
+        }
+
+        auto eventData = std::move(m_events.front());
+        m_events.pop_front();
+        lock.unlock();
+        bool const added = batch->TryAdd(eventData);
+        lock.lock();
+
+        if (added)
+        {
+          events.push_back(std::move(eventData));
+        }
+        else if (events.empty())
+        {
+          // The event doesn't fit in an empty batch, so it can never be sent.
+          lock.unlock();
+          Complete(
+              {eventData},
+              std::make_exception_ptr(
+                  std::runtime_error("The event is too large to fit in a batch.")));
+          lock.lock();
+        }
+        else
+        {
+          // The batch is full; the event goes first in the next batch.
+          m_events.push_front(std::move(eventData));
+          m_workAvailable.notify_one();
+          break;
+        }
+      }
+
+      if (events.empty())
+      {
+        continue;
+      }
+
+      lock.unlock();
+      std::exception_ptr error;
+      try
+      {
+        m_sendBatch(*batch, linkIndex, context);
+      }
+      catch (...)
+      {
+        error = std::current_exception();
+      }
+      Complete(events, error);
+      lock.lock();
+    }
+  }
+}}}} // namespace Azure::Messaging::EventHubs::_detail
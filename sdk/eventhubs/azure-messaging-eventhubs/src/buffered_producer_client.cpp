@@ -0,0 +1,188 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/messaging/eventhubs/buffered_producer_client.hpp"
+
+#include "private/buffered_partition_publisher.hpp"
+
+#include <azure/core/diagnostics/logger.hpp>
+#include <azure/core/internal/diagnostics/log.hpp>
+
+#include <exception>
+#include <stdexcept>
+
+using namespace Azure::Core::Diagnostics::_internal;
+using namespace Azure::Core::Diagnostics;
+
+namespace Azure { namespace Messaging { namespace EventHubs {
+
+  BufferedProducerClient::BufferedProducerClient(
+      std::shared_ptr<ProducerClient> producerClient,
+      BufferedProducerClientOptions const& options)
+      : m_producerClient{std::move(producerClient)}, m_options{options}
+  {
+  }
+
+  BufferedProducerClient::~BufferedProducerClient()
+  {
+    try
+    {
+      Close();
+    }
+    catch (std::exception const& ex)
+    {
+      Log::Stream(Logger::Level::Warning)
+          << "Exception caught closing buffered producer: " << ex.what();
+    }
+  }
+
+  _detail::BufferedPartitionPublisher& BufferedProducerClient::GetPublisher(
+      EnqueueEventOptions const& options,
+      Core::Context const& context)
+  {
+    std::unique_lock<std::mutex> lock(m_publishersLock);
+    if (m_closed)
+    {
+      throw std::runtime_error("Events cannot be enqueued after the producer has been closed.");
+    }
+
+    std::string partitionId{options.PartitionId};
+    if (partitionId.empty())
+    {
+      if (m_partitionIds.empty())
+      {
+        m_partitionIds = m_producerClient->GetEventHubProperties(context).PartitionIds;
+        if (m_partitionIds.empty())
+        {
+          throw std::runtime_error("The Event Hub does not have any partitions.");
+        }
+      }
+      partitionId = m_partitionIds[m_nextPartition++ % m_partitionIds.size()];
+    }
+
+    auto publisher = m_publishers.find(partitionId);
+    if (publisher == m_publishers.end())
+    {
+      auto producerClient = m_producerClient;
+      auto onSendSucceeded = m_options.OnSendSucceeded;
+      auto onSendFailed = m_options.OnSendFailed;
+      publisher = m_publishers
+                      .emplace(
+                          partitionId,
+                          std::make_unique<_detail::BufferedPartitionPublisher>(
+                              m_options.MaxEventBufferLengthPerPartition,
+                              m_options.MaxConcurrentSendsPerPartition,
+                              m_options.MaxWaitTime,
+                              [producerClient, partitionId](Core::Context const& context) {
+                                EventDataBatchOptions batchOptions;
+                                batchOptions.PartitionId = partitionId;
+                                return producerClient->CreateBatch(batchOptions, context);
+                              },
+                              [producerClient, partitionId](
+                                  EventDataBatch const& batch,
+                                  std::size_t linkIndex,
+                                  Core::Context const& context) {
+                                producerClient->EnsureSender(partitionId, context, linkIndex);
+                                producerClient->Send(batch, linkIndex, context);
+                              },
+                              [partitionId, onSendSucceeded, onSendFailed](
+                                  std::vector<Models::EventData> const& events,
+                                  std::exception_ptr error) {
+                                if (!error)
+                                {
+                                  if (onSendSucceeded)
+                                  {
+                                    onSendSucceeded(partitionId, events);
+                                  }
+                                  return;
+                                }
+                                try
+                                {
+                                  std::rethrow_exception(error);
+                                }
+                                catch (std::exception const& ex)
+                                {
+                                  if (onSendFailed)
+                                  {
+                                    onSendFailed(partitionId, events, ex);
+                                  }
+                                  else
+                                  {
+                                    Log::Stream(Logger::Level::Warning)
+                                        << "Failed to send " << events.size()
+                                        << " events to partition " << partitionId << ": "
+                                        << ex.what();
+                                  }
+                                }
+                              }))
+                      .first;
+    }
+    return *publisher->second;
+  }
+
+  void BufferedProducerClient::Enqueue(
+      Models::EventData const& eventData,
+      EnqueueEventOptions const& options,
+      Core::Context const& context)
+  {
+    // Publishers live as long as the client, so the lock isn't held while waiting for space.
+    GetPublisher(options, context).Enqueue(eventData, context);
+  }
+
+  void BufferedProducerClient::Flush(Core::Context const& context)
+  {
+    std::vector<_detail::BufferedPartitionPublisher*> publishers;
+    {
+      std::unique_lock<std::mutex> lock(m_publishersLock);
+      for (auto const& publisher : m_publishers)
+      {
+        publishers.push_back(publisher.second.get());
+      }
+    }
+    for (auto publisher : publishers)
+    {
+      publisher->Flush(context);
+    }
+  }
+
+  void BufferedProducerClient::Close(Core::Context const& context)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_publishersLock);
+      if (m_closed)
+      {
+        return;
+      }
+      m_closed = true;
+    }
+    // The publishers are closed even when the flush is cancelled, which cancels their sends.
+    std::exception_ptr error;
+    try
+    {
+      Flush(context);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+    for (auto const& publisher : m_publishers)
+    {
+      publisher.second->Close(context);
+    }
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+  std::size_t BufferedProducerClient::GetBufferedEventCount() const
+  {
+    std::unique_lock<std::mutex> lock(m_publishersLock);
+    std::size_t count{};
+    for (auto const& publisher : m_publishers)
+    {
+      count += publisher.second->GetBufferedEventCount();
+    }
+    return count;
+  }
+}}} // namespace Azure::Messaging::EventHubs
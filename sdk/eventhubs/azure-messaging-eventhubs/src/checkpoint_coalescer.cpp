@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "private/checkpoint_coalescer.hpp"
+
+#include <azure/core/diagnostics/logger.hpp>
+#include <azure/core/internal/diagnostics/log.hpp>
+
+#include <vector>
+
+using namespace Azure::Core::Diagnostics::_internal;
+using namespace Azure::Core::Diagnostics;
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+
+  CheckpointCoalescer::CheckpointCoalescer(
+      std::shared_ptr<CheckpointStore> checkpointStore,
+      Azure::DateTime::duration flushInterval,
+      std::uint32_t flushCount)
+      : m_checkpointStore{std::move(checkpointStore)}, m_flushInterval{flushInterval},
+        m_flushCount{flushCount}
+  {
+    m_thread = std::thread([this]() { Run(); });
+  }
+
+  CheckpointCoalescer::~CheckpointCoalescer()
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_stopping = true;
+    }
+    m_flushNeeded.notify_one();
+    m_thread.join();
+  }
+
+  void CheckpointCoalescer::UpdateCheckpoint(Models::Checkpoint const& checkpoint)
+  {
+    bool flushNeeded{};
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_pendingCheckpoints[checkpoint.PartitionId] = checkpoint;
+      m_updatesSinceFlush += 1;
+      flushNeeded = m_flushCount != 0 && m_updatesSinceFlush >= m_flushCount;
+    }
+    if (flushNeeded)
+    {
+      m_flushNeeded.notify_one();
+    }
+  }
+
+  void CheckpointCoalescer::Flush(Core::Context const& context)
+  {
+    std::lock_guard<std::mutex> flushLock(m_flushLock);
+
+    std::map<std::string, Models::Checkpoint> pending;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      pending.swap(m_pendingCheckpoints);
+      m_updatesSinceFlush = 0;
+    }
+    WriteCheckpoints(pending, true, context);
+  }
+
+  void CheckpointCoalescer::Flush(std::string const& partitionId, Core::Context const& context)
+  {
+    // Taking the flush lock also waits for a background flush which may be writing a checkpoint
+    // of this partition, so nothing is written for it once this returns.
+    std::lock_guard<std::mutex> flushLock(m_flushLock);
+
+    std::map<std::string, Models::Checkpoint> pending;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto checkpoint = m_pendingCheckpoints.find(partitionId);
+      if (checkpoint == m_pendingCheckpoints.end())
+      {
+        return;
+      }
+      pending.emplace(partitionId, std::move(checkpoint->second));
+      m_pendingCheckpoints.erase(checkpoint);
+    }
+    WriteCheckpoints(pending, false, context);
+  }
+
+  void CheckpointCoalescer::DiscardCheckpointsExcept(std::set<std::string> const& ownedPartitionIds)
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto checkpoint = m_pendingCheckpoints.begin(); checkpoint != m_pendingCheckpoints.end();)
+    {
+      if (ownedPartitionIds.find(checkpoint->first) == ownedPartitionIds.end())
+      {
+        Log::Stream(Logger::Level::Verbose)
+            << "Discarding the pending checkpoint of partition " << checkpoint->first
+            << ", which is no longer owned.";
+        checkpoint = m_pendingCheckpoints.erase(checkpoint);
+      }
+      else
+      {
+        ++checkpoint;
+      }
+    }
+  }
+
+  void CheckpointCoalescer::WriteCheckpoints(
+      std::map<std::string, Models::Checkpoint>& pending,
+      bool keepOnFailure,
+      Core::Context const& context)
+  {
+    if (pending.empty())
+    {
+      return;
+    }
+
+    std::vector<Models::Checkpoint> checkpoints;
+    checkpoints.reserve(pending.size());
+    for (auto const& checkpoint : pending)
+    {
+      checkpoints.push_back(checkpoint.second);
+    }
+
+    try
+    {
+      m_checkpointStore->UpdateCheckpoints(checkpoints, context);
+    }
+    catch (...)
+    {
+      if (keepOnFailure)
+      {
+        // Keep the checkpoints for the next flush; emplace leaves newer checkpoints in place.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& checkpoint : pending)
+        {
+          m_pendingCheckpoints.emplace(checkpoint.first, std::move(checkpoint.second));
+        }
+      }
+      throw;
+    }
+  }
+
+  void CheckpointCoalescer::Run()
+  {
+    for (;;)
+    {
+      bool stopping{};
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto const flushNeeded = [this]() {
+          return m_stopping || (m_flushCount != 0 && m_updatesSinceFlush >= m_flushCount);
+        };
+        if (m_flushInterval > Azure::DateTime::duration::zero())
+        {
+          m_flushNeeded.wait_for(lock, m_flushInterval, flushNeeded);
+        }
+        else
+        {
+          m_flushNeeded.wait(lock, flushNeeded);
+        }
+        stopping = m_stopping;
+      }
+
+      try
+      {
+        Flush();
+      }
+      catch (std::exception const& ex)
+      {
+        Log::Stream(Logger::Level::Warning) << "Failed to write checkpoints: " << ex.what();
+      }
+
+      if (stopping)
+      {
+        return;
+      }
+    }
+  }
+}}}} // namespace Azure::Messaging::EventHubs::_detail
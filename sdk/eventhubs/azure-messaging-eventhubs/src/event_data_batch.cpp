@@ -9,6 +9,10 @@
 #include <azure/core/diagnostics/logger.hpp>
 #include <azure/core/internal/diagnostics/log.hpp>
 
+#include <cstddef>
+#include <memory>
+#include <utility>
+
 using namespace Azure::Core::Diagnostics::_internal;
 using namespace Azure::Core::Diagnostics;
 
@@ -22,7 +26,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
   Azure::Core::Amqp::Models::AmqpMessage EventDataBatch::ToAmqpMessage() const
   {
     Azure::Core::Amqp::Models::AmqpMessage returnValue{m_batchEnvelope};
-    if (m_marshalledMessages.empty())
+    if (m_marshalledMessageSizes.empty())
     {
       throw std::runtime_error("No messages added to the batch.");
     }
@@ -34,56 +38,72 @@ namespace Azure { namespace Messaging { namespace EventHubs {
           _detail::PartitionKeyAnnotation, Azure::Core::Amqp::Models::AmqpValue(m_partitionKey));
     }
 
+    // Each message is copied once, from the batch buffer into its data section.
     std::vector<Azure::Core::Amqp::Models::AmqpBinaryData> messageList;
-    for (auto const& marshalledMessage : m_marshalledMessages)
+    messageList.reserve(m_marshalledMessageSizes.size());
+    auto marshalledMessage = m_marshalledMessages.begin();
+    for (auto const messageSize : m_marshalledMessageSizes)
     {
-      Azure::Core::Amqp::Models::AmqpBinaryData data(marshalledMessage);
-      messageList.push_back(data);
+      auto const messageEnd = marshalledMessage + static_cast<std::ptrdiff_t>(messageSize);
+      messageList.emplace_back(std::vector<uint8_t>(marshalledMessage, messageEnd));
+      marshalledMessage = messageEnd;
     }
 
-    returnValue.SetBody(messageList);
+    returnValue.SetBody(std::move(messageList));
     return returnValue;
   }
 
   bool EventDataBatch::TryAddAmqpMessage(
       std::shared_ptr<Azure::Core::Amqp::Models::AmqpMessage const> const& message)
   {
-    Azure::Core::Amqp::Models::AmqpMessage messageToSend{*message};
-
-    // Fix up some properties in the message to send if they have not been already set.
-    if (message->Properties.MessageId.IsNull())
+    // Fix up some properties in the message to send if they have not been already set. This
+    // needs a copy of the message, so it is only made when there is something to fix up.
+    std::unique_ptr<Azure::Core::Amqp::Models::AmqpMessage> fixedUpMessage;
+    if (message->Properties.MessageId.IsNull() || !m_partitionKey.empty())
     {
-      messageToSend.Properties.MessageId
-          = Azure::Core::Amqp::Models::AmqpValue(Azure::Core::Uuid::CreateUuid().ToString());
-    }
+      fixedUpMessage = std::make_unique<Azure::Core::Amqp::Models::AmqpMessage>(*message);
+      if (message->Properties.MessageId.IsNull())
+      {
+        fixedUpMessage->Properties.MessageId
+            = Azure::Core::Amqp::Models::AmqpValue(Azure::Core::Uuid::CreateUuid().ToString());
+      }
 
-    if (!m_partitionKey.empty())
-    {
-      messageToSend.MessageAnnotations.emplace(
-          _detail::PartitionKeyAnnotation, Azure::Core::Amqp::Models::AmqpValue(m_partitionKey));
+      if (!m_partitionKey.empty())
+      {
+        fixedUpMessage->MessageAnnotations.emplace(
+            _detail::PartitionKeyAnnotation,
+            Azure::Core::Amqp::Models::AmqpValue(m_partitionKey));
+      }
     }
-
-    auto serializedMessage = Azure::Core::Amqp::Models::AmqpMessage::Serialize(messageToSend);
+    Azure::Core::Amqp::Models::AmqpMessage const& messageToSend
+        = fixedUpMessage ? *fixedUpMessage : *message;
 
     std::lock_guard<std::mutex> lock(m_rwMutex);
 
-    if (m_marshalledMessages.empty())
+    // Serialize the message straight onto the end of the batch buffer, and trim it back off
+    // again if it does not fit.
+    auto const marshalledMessageStart = m_marshalledMessages.size();
+    Azure::Core::Amqp::Models::AmqpMessage::Serialize(messageToSend, m_marshalledMessages);
+    auto const serializedMessageSize = m_marshalledMessages.size() - marshalledMessageStart;
+
+    if (m_marshalledMessageSizes.empty())
     {
       // The first message is special - we use its properties and annotations on the envelope for
       // the batch message.
       m_batchEnvelope = CreateBatchEnvelope(message);
-      m_currentSize = serializedMessage.size();
+      m_currentSize = serializedMessageSize;
     }
-    auto actualPayloadSize = CalculateActualSizeForPayload(serializedMessage);
+    auto actualPayloadSize = CalculateActualSizeForPayload(serializedMessageSize);
     if (m_currentSize + actualPayloadSize > m_maxBytes.Value())
     {
       Log::Stream(Logger::Level::Informational)
           << "Batch is full. Cannot add more messages. "
           << "Message size: " << actualPayloadSize << " size: " << m_currentSize
           << " Max size: " << m_maxBytes.Value() << std::endl;
+      m_marshalledMessages.resize(marshalledMessageStart);
       // If we don't have any messages and we can't add this one, then we can't add it at all.
       // Discard the contents of the batch.
-      if (m_marshalledMessages.empty())
+      if (m_marshalledMessageSizes.empty())
       {
         m_currentSize = 0;
         m_batchEnvelope = nullptr;
@@ -92,7 +112,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     }
 
     m_currentSize += actualPayloadSize;
-    m_marshalledMessages.push_back(serializedMessage);
+    m_marshalledMessageSizes.push_back(serializedMessageSize);
     return true;
   }
 
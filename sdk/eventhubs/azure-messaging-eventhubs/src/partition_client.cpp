@@ -6,6 +6,7 @@
 #include "azure/messaging/eventhubs/eventhubs_exception.hpp"
 #include "private/eventhubs_constants.hpp"
 #include "private/eventhubs_utilities.hpp"
+#include "private/received_event_prefetcher.hpp"
 #include "private/retry_operation.hpp"
 
 #include <azure/core/amqp.hpp>
@@ -206,15 +207,40 @@ namespace Azure { namespace Messaging { namespace EventHubs {
       Core::Http::Policies::RetryOptions retryOptions)
       : m_receiver{messageReceiver}, m_partitionOptions{options}, m_retryOptions{retryOptions}
   {
+    if (m_partitionOptions.DecodedEventBufferSize != 0)
+    {
+      auto receiver = m_receiver;
+      m_prefetcher = std::make_shared<_detail::ReceivedEventPrefetcher>(
+          m_partitionOptions.DecodedEventBufferSize,
+          [receiver](Core::Context const& context) mutable {
+            auto result = receiver.WaitForIncomingMessage(context);
+            if (!result.first)
+            {
+              throw _detail::EventHubsExceptionFactory::CreateEventHubsException(result.second);
+            }
+            return std::make_shared<Models::ReceivedEventData const>(result.first);
+          });
+    }
   }
 
   PartitionClient::~PartitionClient()
   {
     Log::Stream(Logger::Level::Verbose) << "~PartitionClient() "
                                         << "Close Receiver.";
+    // The prefetcher uses the receiver, so it is stopped first.
+    m_prefetcher.reset();
     m_receiver.Close();
   }
 
+  void PartitionClient::Close(Core::Context const& context)
+  {
+    if (m_prefetcher)
+    {
+      m_prefetcher->Stop();
+    }
+    m_receiver.Close(context);
+  }
+
   /** Receive events from the partition.
    *
    * @param maxMessages The maximum number of messages to receive.
@@ -228,6 +254,17 @@ namespace Azure { namespace Messaging { namespace EventHubs {
   {
     std::vector<std::shared_ptr<const Models::ReceivedEventData>> messages;
 
+    if (m_prefetcher)
+    {
+      if (maxMessages != 0 && !context.IsCancelled())
+      {
+        m_prefetcher->ReceiveEvents(messages, maxMessages, context);
+      }
+      Log::Stream(Logger::Level::Verbose)
+          << "Receive Events. Return " << messages.size() << " decoded messages.";
+      return messages;
+    }
+
     while (messages.size() < maxMessages && !context.IsCancelled())
     {
       std::pair<
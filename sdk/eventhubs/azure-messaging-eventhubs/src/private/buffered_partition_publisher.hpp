@@ -0,0 +1,117 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/messaging/eventhubs/event_data_batch.hpp"
+#include "azure/messaging/eventhubs/models/event_data.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/datetime.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+
+  /**
+   * @brief Buffers the events for one partition and packs them into batches on background
+   * workers.
+   *
+   * Each worker owns one link to the partition (identified by its link index) and keeps at most
+   * one batch in flight on it. A worker sends its batch when the next event doesn't fit, when the
+   * batch has lingered for the maximum wait time, or when a flush or close is requested.
+   *
+   * The buffered event count includes the events being sent, so memory is bounded by the buffer
+   * length: Enqueue blocks while the buffer is full.
+   */
+  class BufferedPartitionPublisher final {
+  public:
+    /// Creates an empty batch for the partition.
+    using CreateBatchFunction = std::function<EventDataBatch(Azure::Core::Context const&)>;
+
+    /// Sends a batch on the link with the given index.
+    using SendBatchFunction = std::function<
+        void(EventDataBatch const&, std::size_t linkIndex, Azure::Core::Context const&)>;
+
+    /// Reports the outcome of a send; the exception is null when the send succeeded.
+    using CompletionFunction
+        = std::function<void(std::vector<Models::EventData> const&, std::exception_ptr)>;
+
+    BufferedPartitionPublisher(
+        std::size_t maxBufferLength,
+        std::size_t maxConcurrentSends,
+        Azure::DateTime::duration maxWaitTime,
+        CreateBatchFunction createBatch,
+        SendBatchFunction sendBatch,
+        CompletionFunction onComplete);
+
+    ~BufferedPartitionPublisher();
+
+    BufferedPartitionPublisher(BufferedPartitionPublisher const&) = delete;
+    BufferedPartitionPublisher& operator=(BufferedPartitionPublisher const&) = delete;
+
+    /**
+     * @brief Adds an event to the buffer, waiting for space while the buffer is full.
+     *
+     * @throw Azure::Core::OperationCancelledException if the context is cancelled while waiting.
+     * @throw std::runtime_error if the publisher has been closed.
+     */
+    void Enqueue(Models::EventData const& eventData, Azure::Core::Context const& context);
+
+    /**
+     * @brief Sends the buffered events without waiting for the linger time and waits until they
+     * have all completed.
+     *
+     * @throw Azure::Core::OperationCancelledException if the context is cancelled while waiting.
+     */
+    void Flush(Azure::Core::Context const& context);
+
+    /**
+     * @brief Sends the buffered events and stops the workers. Events can't be enqueued after the
+     * publisher has been closed.
+     *
+     * @remark Once the buffered events have completed, or when \p context is cancelled first, the
+     * sends still in progress are cancelled, so that a send which never completes doesn't keep
+     * the workers from stopping. The events of a cancelled send are reported as failed.
+     */
+    void Close(Azure::Core::Context const& context = {});
+
+    /**
+     * @brief The number of events that have been enqueued and have not completed yet.
+     */
+    std::size_t GetBufferedEventCount() const;
+
+  private:
+    std::size_t const m_maxBufferLength;
+    Azure::DateTime::duration const m_maxWaitTime;
+    CreateBatchFunction const m_createBatch;
+    SendBatchFunction const m_sendBatch;
+    CompletionFunction const m_onComplete;
+
+    mutable std::mutex m_mutex;
+    // Signaled when events are enqueued, or when a flush or close is requested.
+    std::condition_variable m_workAvailable;
+    // Signaled when events complete.
+    std::condition_variable m_eventsCompleted;
+    std::deque<Models::EventData> m_events;
+    std::size_t m_bufferedEventCount{};
+    std::size_t m_pendingFlushes{};
+    bool m_closing{};
+
+    // Passed to the workers' batch creations and sends, and cancelled by Close().
+    Azure::Core::Context m_context;
+    std::vector<std::thread> m_workers;
+
+    void RunWorker(std::size_t linkIndex);
+    bool ShouldSendNow() const { return m_closing || m_pendingFlushes != 0; }
+    void Complete(std::vector<Models::EventData> const& events, std::exception_ptr error);
+  };
+}}}} // namespace Azure::Messaging::EventHubs::_detail
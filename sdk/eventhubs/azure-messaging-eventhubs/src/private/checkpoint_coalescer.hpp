@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/messaging/eventhubs/checkpoint_store.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/core/datetime.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+
+  /**
+   * @brief Collects the checkpoints of a processor and writes them to the checkpoint store on a
+   * background thread.
+   *
+   * Only the most recent checkpoint of each partition is kept, so a partition which is
+   * checkpointed after every event costs one store update per flush. The pending checkpoints are
+   * written when the flush interval elapses or when the number of updates since the last flush
+   * reaches the flush count, whichever comes first. A zero interval or count disables that
+   * trigger.
+   */
+  class CheckpointCoalescer final {
+  public:
+    CheckpointCoalescer(
+        std::shared_ptr<CheckpointStore> checkpointStore,
+        Azure::DateTime::duration flushInterval,
+        std::uint32_t flushCount);
+
+    /**
+     * @brief Writes the pending checkpoints and stops the background thread.
+     *
+     */
+    ~CheckpointCoalescer();
+
+    CheckpointCoalescer(CheckpointCoalescer const&) = delete;
+    CheckpointCoalescer& operator=(CheckpointCoalescer const&) = delete;
+
+    /**
+     * @brief Records the checkpoint, replacing any pending checkpoint of the same partition.
+     *
+     */
+    void UpdateCheckpoint(Models::Checkpoint const& checkpoint);
+
+    /**
+     * @brief Writes the pending checkpoints on the calling thread.
+     *
+     * @throw The error of the checkpoint store. The checkpoints which could not be written stay
+     * pending, unless a newer checkpoint of the same partition was recorded in the meantime.
+     */
+    void Flush(Core::Context const& context = {});
+
+    /**
+     * @brief Writes the pending checkpoint of a partition on the calling thread.
+     *
+     * Used when the partition is about to be released, so the checkpoint is dropped rather than
+     * kept for a later flush if it cannot be written.
+     *
+     * @throw The error of the checkpoint store.
+     */
+    void Flush(std::string const& partitionId, Core::Context const& context = {});
+
+    /**
+     * @brief Drops the pending checkpoints of every partition which is not in the given set.
+     *
+     * Called when the processor's ownership is updated, so a checkpoint is never written for a
+     * partition after its ownership has moved to another processor.
+     */
+    void DiscardCheckpointsExcept(std::set<std::string> const& ownedPartitionIds);
+
+  private:
+    std::shared_ptr<CheckpointStore> const m_checkpointStore;
+    Azure::DateTime::duration const m_flushInterval;
+    std::uint32_t const m_flushCount;
+
+    std::mutex m_mutex;
+    std::condition_variable m_flushNeeded;
+    // Keyed by partition ID.
+    std::map<std::string, Models::Checkpoint> m_pendingCheckpoints;
+    std::uint32_t m_updatesSinceFlush{};
+    bool m_stopping{};
+
+    // Held while writing to the store, so an older checkpoint of a partition is never written
+    // after a newer one.
+    std::mutex m_flushLock;
+
+    std::thread m_thread;
+
+    void WriteCheckpoints(
+        std::map<std::string, Models::Checkpoint>& pending,
+        bool keepOnFailure,
+        Core::Context const& context);
+    void Run();
+  };
+}}}} // namespace Azure::Messaging::EventHubs::_detail
@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/messaging/eventhubs/models/event_data.hpp"
+
+#include <azure/core/context.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+
+  /**
+   * @brief Receives and decodes the events of a partition on a background thread.
+   *
+   * The background thread is the only producer and the thread calling ReceiveEvents is the only
+   * consumer of a bounded queue of decoded events. The producer stops receiving while the queue is
+   * full, so at most the buffer size of decoded events are held in memory. Once receiving fails,
+   * the error is reported to the consumer after the events received before it.
+   */
+  class ReceivedEventPrefetcher final {
+  public:
+    /// Waits for the next event; it throws if the event couldn't be received.
+    using ReceiveFunction = std::function<std::shared_ptr<Models::ReceivedEventData const>(
+        Azure::Core::Context const&)>;
+
+    ReceivedEventPrefetcher(std::size_t bufferSize, ReceiveFunction receive);
+
+    ~ReceivedEventPrefetcher();
+
+    ReceivedEventPrefetcher(ReceivedEventPrefetcher const&) = delete;
+    ReceivedEventPrefetcher& operator=(ReceivedEventPrefetcher const&) = delete;
+
+    /**
+     * @brief Waits until at least one event has been decoded, then moves up to \p maxEvents of
+     * the decoded events into \p events.
+     *
+     * @throw Azure::Core::OperationCancelledException if the context is cancelled while waiting.
+     * @throw The error of the background thread once all the events received before it have been
+     * returned.
+     */
+    void ReceiveEvents(
+        std::vector<std::shared_ptr<Models::ReceivedEventData const>>& events,
+        std::uint32_t maxEvents,
+        Azure::Core::Context const& context);
+
+    /**
+     * @brief Stops the background thread. The events which have not been returned are discarded.
+     */
+    void Stop();
+
+  private:
+    std::size_t const m_bufferSize;
+    ReceiveFunction const m_receive;
+    // Cancelled to stop the background thread while it waits for an event.
+    Azure::Core::Context m_receiveContext;
+
+    std::mutex m_mutex;
+    std::condition_variable m_eventsAvailable;
+    std::condition_variable m_spaceAvailable;
+    std::deque<std::shared_ptr<Models::ReceivedEventData const>> m_events;
+    std::exception_ptr m_error;
+    bool m_stopping{};
+
+    std::thread m_thread;
+
+    void Run();
+  };
+}}}} // namespace Azure::Messaging::EventHubs::_detail
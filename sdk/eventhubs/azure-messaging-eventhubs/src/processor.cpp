@@ -5,12 +5,14 @@
 
 #include "azure/messaging/eventhubs/models/management_models.hpp"
 #include "azure/messaging/eventhubs/models/partition_client_models.hpp"
+#include "private/checkpoint_coalescer.hpp"
 #include "private/processor_load_balancer.hpp"
 
 #include <azure/core/diagnostics/logger.hpp>
 #include <azure/core/internal/diagnostics/log.hpp>
 
 #include <iomanip>
+#include <set>
 
 using namespace Azure::Core::Diagnostics::_internal;
 using namespace Azure::Core::Diagnostics;
@@ -39,6 +41,13 @@ namespace Azure { namespace Messaging { namespace EventHubs {
             ? std::chrono::minutes(1)
             : std::chrono::duration_cast<std::chrono::minutes>(
                 options.PartitionExpirationDuration));
+
+    if (options.CheckpointFlushInterval > Azure::DateTime::duration::zero()
+        || options.CheckpointFlushCount != 0)
+    {
+      m_checkpointCoalescer = std::make_shared<_detail::CheckpointCoalescer>(
+          m_checkpointStore, options.CheckpointFlushInterval, options.CheckpointFlushCount);
+    }
   }
 
   Processor::~Processor()
@@ -74,6 +83,19 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     {
       m_processorThread.join();
     }
+
+    if (m_checkpointCoalescer)
+    {
+      try
+      {
+        m_checkpointCoalescer->Flush();
+      }
+      catch (std::exception const& ex)
+      {
+        Log::Stream(Logger::Level::Warning)
+            << "Failed to write checkpoints when stopping the processor: " << ex.what();
+      }
+    }
   }
 
   void Processor::Run(Core::Context const& context) { RunInternal(context, true); }
@@ -123,6 +145,18 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     std::vector<Models::Ownership> ownerships
         = m_loadBalancer->LoadBalance(eventHubProperties.PartitionIds, context);
 
+    if (m_checkpointCoalescer)
+    {
+      // Partitions which could not be claimed again now belong to another processor; their
+      // pending checkpoints must not be written over that processor's.
+      std::set<std::string> ownedPartitionIds;
+      for (auto const& ownership : ownerships)
+      {
+        ownedPartitionIds.insert(ownership.PartitionId);
+      }
+      m_checkpointCoalescer->DiscardCheckpointsExcept(ownedPartitionIds);
+    }
+
     std::map<std::string, Models::Checkpoint> checkpoints = GetCheckpointsMap(context);
 
     for (auto const& ownership : ownerships)
@@ -167,7 +201,8 @@ namespace Azure { namespace Messaging { namespace EventHubs {
               {
                 strongConsumers->erase(ownership.PartitionId);
               }
-            }));
+            },
+            m_checkpointCoalescer));
 
     // Try to add the partition client to the map. If it's already there, we discard the one we just
     // created in favor of the existing processor partition client.
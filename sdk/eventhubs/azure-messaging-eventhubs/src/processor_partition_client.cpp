@@ -2,11 +2,13 @@
 // Licensed under the MIT License.
 #include "azure/messaging/eventhubs/processor_partition_client.hpp"
 
+#include "private/checkpoint_coalescer.hpp"
 #include "private/eventhubs_constants.hpp"
 
 #include <azure/core/diagnostics/logger.hpp>
 #include <azure/core/internal/diagnostics/log.hpp>
 
+#include <exception>
 #include <iomanip>
 
 using namespace Azure::Core::Diagnostics::_internal;
@@ -58,7 +60,7 @@ namespace Azure { namespace Messaging { namespace EventHubs {
            offset,
            sequenceNumber};
 
-    m_checkpointStore->UpdateCheckpoint(checkpoint, context);
+    WriteCheckpoint(checkpoint, context);
   }
 
   void ProcessorPartitionClient::UpdateCheckpoint(
@@ -87,7 +89,50 @@ namespace Azure { namespace Messaging { namespace EventHubs {
     checkpoint.EventHubName = m_consumerClientDetails.EventHubName;
     checkpoint.SequenceNumber = sequenceNumber;
     checkpoint.Offset = offset;
-    m_checkpointStore->UpdateCheckpoint(checkpoint, context);
+    WriteCheckpoint(checkpoint, context);
+  }
+
+  void ProcessorPartitionClient::WriteCheckpoint(
+      Models::Checkpoint const& checkpoint,
+      Core::Context const& context)
+  {
+    if (m_checkpointCoalescer)
+    {
+      m_checkpointCoalescer->UpdateCheckpoint(checkpoint);
+    }
+    else
+    {
+      m_checkpointStore->UpdateCheckpoint(checkpoint, context);
+    }
+  }
+
+  void ProcessorPartitionClient::Close(Core::Context const& context)
+  {
+    if (m_cleanupFunc)
+    {
+      m_cleanupFunc();
+    }
+    // The receiver link is closed even when the pending checkpoint can't be written, and the
+    // checkpoint store error is thrown afterwards. The partition is released once it is closed,
+    // so its checkpoint is not left for the background thread to write later, and any checkpoint
+    // recorded after this point is written straight to the checkpoint store.
+    std::exception_ptr flushError;
+    if (auto checkpointCoalescer = std::move(m_checkpointCoalescer))
+    {
+      try
+      {
+        checkpointCoalescer->Flush(m_partitionId, context);
+      }
+      catch (...)
+      {
+        flushError = std::current_exception();
+      }
+    }
+    m_partitionClient->Close(context);
+    if (flushError)
+    {
+      std::rethrow_exception(flushError);
+    }
   }
 
 }}} // namespace Azure::Messaging::EventHubs
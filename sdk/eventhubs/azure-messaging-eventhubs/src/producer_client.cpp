@@ -13,12 +13,21 @@
 #include <azure/core/amqp/internal/message_sender.hpp>
 #include <azure/core/diagnostics/logger.hpp>
 #include <azure/core/internal/diagnostics/log.hpp>
+#include <azure/core/uuid.hpp>
+
+#include <string>
 
 using namespace Azure::Core::Diagnostics::_internal;
 using namespace Azure::Core::Diagnostics;
 namespace {
 const std::string DefaultAuthScope = "https://eventhubs.azure.net/.default";
+
+// Senders are keyed by partition ID; the additional links to a partition get a suffix.
+std::string GetSenderKey(std::string const& partitionId, size_t linkIndex)
+{
+  return linkIndex == 0 ? partitionId : partitionId + "#" + std::to_string(linkIndex);
 }
+} // namespace
 
 namespace Azure { namespace Messaging { namespace EventHubs {
 
@@ -85,13 +94,21 @@ namespace Azure { namespace Messaging { namespace EventHubs {
   }
 
   void ProducerClient::Send(EventDataBatch const& eventDataBatch, Core::Context const& context)
+  {
+    Send(eventDataBatch, 0, context);
+  }
+
+  void ProducerClient::Send(
+      EventDataBatch const& eventDataBatch,
+      size_t linkIndex,
+      Core::Context const& context)
   {
     auto message = eventDataBatch.ToAmqpMessage();
 
     Azure::Messaging::EventHubs::_detail::RetryOperation retryOp(
         m_producerClientOptions.RetryOptions);
     retryOp.Execute([&]() -> bool {
-      auto result = GetSender(eventDataBatch.GetPartitionId()).Send(message, context);
+      auto result = GetSender(eventDataBatch.GetPartitionId(), linkIndex).Send(message, context);
 #if ENABLE_UAMQP
       auto sendStatus = std::get<0>(result);
       if (sendStatus == Azure::Core::Amqp::_internal::MessageSendStatus::Ok)
@@ -195,10 +212,12 @@ namespace Azure { namespace Messaging { namespace EventHubs {
 
   void ProducerClient::EnsureSender(
       std::string const& partitionId,
-      Azure::Core::Context const& context)
+      Azure::Core::Context const& context,
+      size_t linkIndex)
   {
     std::unique_lock<std::mutex> lock(m_sendersLock);
-    if (m_senders.find(partitionId) == m_senders.end())
+    auto const senderKey = GetSenderKey(partitionId, linkIndex);
+    if (m_senders.find(senderKey) == m_senders.end())
     {
       EnsureSession(partitionId, context);
 
@@ -210,6 +229,13 @@ namespace Azure { namespace Messaging { namespace EventHubs {
 
       Azure::Core::Amqp::_internal::MessageSenderOptions senderOptions;
       senderOptions.Name = m_producerClientOptions.Name;
+      if (linkIndex != 0)
+      {
+        // Link names have to be unique within the session.
+        senderOptions.Name = m_producerClientOptions.Name.empty()
+            ? Azure::Core::Uuid::CreateUuid().ToString()
+            : m_producerClientOptions.Name + "-" + std::to_string(linkIndex);
+      }
       senderOptions.EnableTrace = _detail::EnableAmqpTrace;
       senderOptions.MaxMessageSize = m_producerClientOptions.MaxMessageSize;
 
@@ -224,13 +250,15 @@ namespace Azure { namespace Messaging { namespace EventHubs {
         throw Azure::Messaging::EventHubs::_detail::EventHubsExceptionFactory::
             CreateEventHubsException(openResult);
       }
-      m_senders.emplace(partitionId, std::move(sender));
+      m_senders.emplace(senderKey, std::move(sender));
     }
   }
   Azure::Core::Amqp::_internal::MessageSender ProducerClient::GetSender(
-      std::string const& partitionId)
+      std::string const& partitionId,
+      size_t linkIndex)
   {
-    return m_senders.at(partitionId);
+    std::unique_lock<std::mutex> lock(m_sendersLock);
+    return m_senders.at(GetSenderKey(partitionId, linkIndex));
   }
 
   Azure::Core::Amqp::_internal::Session ProducerClient::CreateSession(
@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "private/received_event_prefetcher.hpp"
+
+#include <azure/core/diagnostics/logger.hpp>
+#include <azure/core/internal/diagnostics/log.hpp>
+
+#include <chrono>
+
+using namespace Azure::Core::Diagnostics::_internal;
+using namespace Azure::Core::Diagnostics;
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace _detail {
+
+  ReceivedEventPrefetcher::ReceivedEventPrefetcher(std::size_t bufferSize, ReceiveFunction receive)
+      : m_bufferSize{bufferSize != 0 ? bufferSize : 1}, m_receive{std::move(receive)}
+  {
+    m_thread = std::thread([this]() { Run(); });
+  }
+
+  ReceivedEventPrefetcher::~ReceivedEventPrefetcher() { Stop(); }
+
+  void ReceivedEventPrefetcher::Stop()
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      if (m_stopping)
+      {
+        return;
+      }
+      m_stopping = true;
+    }
+    m_receiveContext.Cancel();
+    m_spaceAvailable.notify_one();
+    m_thread.join();
+  }
+
+  void ReceivedEventPrefetcher::Run()
+  {
+    for (;;)
+    {
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_spaceAvailable.wait(
+            lock, [this]() { return m_stopping || m_events.size() < m_bufferSize; });
+        if (m_stopping)
+        {
+          return;
+        }
+      }
+
+      try
+      {
+        auto event = m_receive(m_receiveContext);
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_events.push_back(std::move(event));
+        }
+        m_eventsAvailable.notify_one();
+      }
+      catch (...)
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!m_stopping)
+        {
+          Log::Stream(Logger::Level::Verbose) << "Stop prefetching events after a receive error.";
+          m_error = std::current_exception();
+        }
+        lock.unlock();
+        m_eventsAvailable.notify_one();
+        return;
+      }
+    }
+  }
+
+  void ReceivedEventPrefetcher::ReceiveEvents(
+      std::vector<std::shared_ptr<Models::ReceivedEventData const>>& events,
+      std::uint32_t maxEvents,
+      Azure::Core::Context const& context)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (m_events.empty())
+    {
+      if (m_error)
+      {
+        std::rethrow_exception(m_error);
+      }
+      if (context.IsCancelled())
+      {
+        throw Azure::Core::OperationCancelledException("Receive Operation was cancelled.");
+      }
+      // The context can't signal the condition variable, so check it periodically.
+      m_eventsAvailable.wait_for(lock, std::chrono::milliseconds(100));
+    }
+
+    while (!m_events.empty() && events.size() < maxEvents)
+    {
+      events.push_back(std::move(m_events.front()));
+      m_events.pop_front();
+    }
+    lock.unlock();
+    m_spaceAvailable.notify_one();
+  }
+}}}} // namespace Azure::Messaging::EventHubs::_detail
@@ -0,0 +1,233 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "private/buffered_partition_publisher.hpp"
+#include "private/eventhubs_utilities.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/messaging/eventhubs.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace Azure::Messaging::EventHubs;
+using namespace Azure::Messaging::EventHubs::_detail;
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace Test {
+
+  class BufferedPartitionPublisherTest : public ::testing::Test {
+  protected:
+    std::mutex m_lock;
+    std::vector<std::size_t> m_sentBatchSizes;
+    std::set<std::size_t> m_linksUsed;
+    std::size_t m_succeededEvents{};
+    std::size_t m_failedEvents{};
+
+    BufferedPartitionPublisher::CreateBatchFunction CreateBatch(std::uint64_t maxBytes = 1024)
+    {
+      return [maxBytes](Azure::Core::Context const&) {
+        EventDataBatchOptions options;
+        options.PartitionId = "0";
+        options.MaxBytes = maxBytes;
+        return EventDataBatchFactory::CreateEventDataBatch(options);
+      };
+    }
+
+    BufferedPartitionPublisher::SendBatchFunction SendBatch(
+        std::chrono::milliseconds delay = std::chrono::milliseconds(0))
+    {
+      return [this, delay](
+                 EventDataBatch const& batch,
+                 std::size_t linkIndex,
+                 Azure::Core::Context const&) {
+        std::this_thread::sleep_for(delay);
+        // NumberOfEvents isn't const.
+        EventDataBatch sent{batch};
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_sentBatchSizes.push_back(sent.NumberOfEvents());
+        m_linksUsed.insert(linkIndex);
+      };
+    }
+
+    BufferedPartitionPublisher::CompletionFunction Complete()
+    {
+      return [this](std::vector<Models::EventData> const& events, std::exception_ptr error) {
+        std::unique_lock<std::mutex> lock(m_lock);
+        (error ? m_failedEvents : m_succeededEvents) += events.size();
+      };
+    }
+  };
+
+  TEST_F(BufferedPartitionPublisherTest, SendsAfterMaxWaitTime)
+  {
+    BufferedPartitionPublisher publisher(
+        100, 1, std::chrono::milliseconds(50), CreateBatch(), SendBatch(), Complete());
+
+    publisher.Enqueue(Models::EventData{1, 2, 3}, {});
+    publisher.Enqueue(Models::EventData{4, 5, 6}, {});
+
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (publisher.GetBufferedEventCount() != 0 && std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(0u, publisher.GetBufferedEventCount());
+    std::unique_lock<std::mutex> lock(m_lock);
+    EXPECT_EQ(2u, m_succeededEvents);
+    ASSERT_EQ(1u, m_sentBatchSizes.size());
+    EXPECT_EQ(2u, m_sentBatchSizes[0]);
+  }
+
+  TEST_F(BufferedPartitionPublisherTest, SendsWhenBatchIsFull)
+  {
+    // A linger time long enough that only full batches (and the final flush) are sent.
+    BufferedPartitionPublisher publisher(
+        1000, 1, std::chrono::minutes(10), CreateBatch(512), SendBatch(), Complete());
+
+    for (int i = 0; i < 50; ++i)
+    {
+      publisher.Enqueue(Models::EventData{std::vector<uint8_t>(64, 0x42)}, {});
+    }
+    publisher.Flush({});
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    EXPECT_EQ(50u, m_succeededEvents);
+    EXPECT_GT(m_sentBatchSizes.size(), 1u);
+    std::size_t total{};
+    for (auto size : m_sentBatchSizes)
+    {
+      EXPECT_GT(size, 0u);
+      total += size;
+    }
+    EXPECT_EQ(50u, total);
+  }
+
+  TEST_F(BufferedPartitionPublisherTest, EnqueueBlocksWhenBufferIsFull)
+  {
+    BufferedPartitionPublisher publisher(
+        2,
+        1,
+        std::chrono::minutes(10),
+        CreateBatch(),
+        SendBatch(std::chrono::milliseconds(200)),
+        Complete());
+
+    publisher.Enqueue(Models::EventData{1}, {});
+    publisher.Enqueue(Models::EventData{2}, {});
+    EXPECT_EQ(2u, publisher.GetBufferedEventCount());
+
+    Azure::Core::Context context
+        = Azure::Core::Context{}.WithDeadline(std::chrono::system_clock::now()
+                                              + std::chrono::milliseconds(100));
+    EXPECT_THROW(
+        publisher.Enqueue(Models::EventData{3}, context), Azure::Core::OperationCancelledException);
+
+    // Space is freed once the buffered events have been sent.
+    publisher.Flush({});
+    publisher.Enqueue(Models::EventData{3}, {});
+    publisher.Close();
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    EXPECT_EQ(3u, m_succeededEvents);
+  }
+
+  TEST_F(BufferedPartitionPublisherTest, ConcurrentSendsUseSeparateLinks)
+  {
+    BufferedPartitionPublisher publisher(
+        1000,
+        4,
+        std::chrono::milliseconds(1),
+        CreateBatch(256),
+        SendBatch(std::chrono::milliseconds(20)),
+        Complete());
+
+    for (int i = 0; i < 200; ++i)
+    {
+      publisher.Enqueue(Models::EventData{std::vector<uint8_t>(64, 0x42)}, {});
+    }
+    publisher.Close();
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    EXPECT_EQ(200u, m_succeededEvents);
+    EXPECT_GT(m_linksUsed.size(), 1u);
+    for (auto link : m_linksUsed)
+    {
+      EXPECT_LT(link, 4u);
+    }
+  }
+
+  TEST_F(BufferedPartitionPublisherTest, ReportsFailedSends)
+  {
+    BufferedPartitionPublisher publisher(
+        100,
+        1,
+        std::chrono::milliseconds(10),
+        CreateBatch(),
+        [](EventDataBatch const&, std::size_t, Azure::Core::Context const&) {
+          throw std::runtime_error("Send failed.");
+        },
+        Complete());
+
+    publisher.Enqueue(Models::EventData{1}, {});
+    publisher.Enqueue(Models::EventData{2}, {});
+    publisher.Flush({});
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    EXPECT_EQ(0u, m_succeededEvents);
+    EXPECT_EQ(2u, m_failedEvents);
+  }
+
+  TEST_F(BufferedPartitionPublisherTest, ReportsEventsTooLargeForABatch)
+  {
+    BufferedPartitionPublisher publisher(
+        100, 1, std::chrono::milliseconds(10), CreateBatch(128), SendBatch(), Complete());
+
+    publisher.Enqueue(Models::EventData{std::vector<uint8_t>(1024, 0x42)}, {});
+    publisher.Enqueue(Models::EventData{1}, {});
+    publisher.Flush({});
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    EXPECT_EQ(1u, m_succeededEvents);
+    EXPECT_EQ(1u, m_failedEvents);
+  }
+
+  TEST_F(BufferedPartitionPublisherTest, EnqueueAfterCloseThrows)
+  {
+    BufferedPartitionPublisher publisher(
+        100, 1, std::chrono::milliseconds(10), CreateBatch(), SendBatch(), Complete());
+    publisher.Close();
+    EXPECT_THROW(publisher.Enqueue(Models::EventData{1}, {}), std::runtime_error);
+  }
+
+  TEST_F(BufferedPartitionPublisherTest, CloseCancelsSendsInProgress)
+  {
+    BufferedPartitionPublisher publisher(
+        100,
+        1,
+        std::chrono::milliseconds(1),
+        CreateBatch(),
+        [](EventDataBatch const&, std::size_t, Azure::Core::Context const& context) {
+          // A send which only completes when it is cancelled.
+          while (!context.IsCancelled())
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          }
+          context.ThrowIfCancelled();
+        },
+        Complete());
+
+    publisher.Enqueue(Models::EventData{1}, {});
+    publisher.Close(Azure::Core::Context{}.WithDeadline(
+        std::chrono::system_clock::now() + std::chrono::milliseconds(100)));
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    EXPECT_EQ(0u, m_succeededEvents);
+    EXPECT_EQ(1u, m_failedEvents);
+  }
+}}}} // namespace Azure::Messaging::EventHubs::Test
@@ -0,0 +1,242 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "private/checkpoint_coalescer.hpp"
+
+#include <azure/core/context.hpp>
+#include <azure/messaging/eventhubs.hpp>
+
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace Azure::Messaging::EventHubs;
+using namespace Azure::Messaging::EventHubs::_detail;
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace Test {
+
+  namespace {
+    // Records the batches of checkpoints it is asked to write.
+    class RecordingCheckpointStore final : public CheckpointStore {
+    public:
+      std::vector<Models::Ownership> ClaimOwnership(
+          std::vector<Models::Ownership> const&,
+          Core::Context const& = {}) override
+      {
+        return {};
+      }
+
+      std::vector<Models::Checkpoint> ListCheckpoints(
+          std::string const&,
+          std::string const&,
+          std::string const&,
+          Core::Context const& = {}) override
+      {
+        return {};
+      }
+
+      std::vector<Models::Ownership> ListOwnership(
+          std::string const&,
+          std::string const&,
+          std::string const&,
+          Core::Context const& = {}) override
+      {
+        return {};
+      }
+
+      void UpdateCheckpoint(Models::Checkpoint const& checkpoint, Core::Context const& = {})
+          override
+      {
+        UpdateCheckpoints({checkpoint});
+      }
+
+      void UpdateCheckpoints(
+          std::vector<Models::Checkpoint> const& checkpoints,
+          Core::Context const& = {}) override
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_failuresRemaining != 0)
+        {
+          m_failuresRemaining -= 1;
+          throw std::runtime_error("Storage is unavailable.");
+        }
+        m_batches.push_back(checkpoints);
+      }
+
+      std::vector<std::vector<Models::Checkpoint>> GetBatches()
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_batches;
+      }
+
+      // Waits for the background thread to write a batch.
+      bool WaitForBatches(std::size_t count)
+      {
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+          if (GetBatches().size() >= count)
+          {
+            return true;
+          }
+          std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return false;
+      }
+
+      void FailNextUpdates(int count)
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_failuresRemaining = count;
+      }
+
+    private:
+      std::mutex m_mutex;
+      std::vector<std::vector<Models::Checkpoint>> m_batches;
+      int m_failuresRemaining{};
+    };
+
+    Models::Checkpoint MakeCheckpoint(std::string const& partitionId, int64_t sequenceNumber)
+    {
+      Models::Checkpoint checkpoint{"$Default", "eventhub", "namespace", partitionId};
+      checkpoint.SequenceNumber = sequenceNumber;
+      checkpoint.Offset = std::to_string(sequenceNumber * 100);
+      return checkpoint;
+    }
+  } // namespace
+
+  TEST(CheckpointCoalescerTest, KeepsLatestCheckpointPerPartition)
+  {
+    auto store = std::make_shared<RecordingCheckpointStore>();
+    CheckpointCoalescer coalescer(store, std::chrono::hours(1), 0);
+
+    for (int64_t i = 0; i < 100; ++i)
+    {
+      coalescer.UpdateCheckpoint(MakeCheckpoint(std::to_string(i % 2), i));
+    }
+    EXPECT_TRUE(store->GetBatches().empty());
+
+    coalescer.Flush();
+    auto batches = store->GetBatches();
+    ASSERT_EQ(batches.size(), 1u);
+    ASSERT_EQ(batches[0].size(), 2u);
+    EXPECT_EQ(batches[0][0].PartitionId, "0");
+    EXPECT_EQ(batches[0][0].SequenceNumber.Value(), 98);
+    EXPECT_EQ(batches[0][1].PartitionId, "1");
+    EXPECT_EQ(batches[0][1].SequenceNumber.Value(), 99);
+
+    // Nothing is pending any more.
+    coalescer.Flush();
+    EXPECT_EQ(store->GetBatches().size(), 1u);
+  }
+
+  TEST(CheckpointCoalescerTest, FlushesOnCount)
+  {
+    auto store = std::make_shared<RecordingCheckpointStore>();
+    CheckpointCoalescer coalescer(store, {}, 10);
+
+    for (int64_t i = 0; i < 9; ++i)
+    {
+      coalescer.UpdateCheckpoint(MakeCheckpoint("0", i));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(store->GetBatches().empty());
+
+    coalescer.UpdateCheckpoint(MakeCheckpoint("0", 9));
+    ASSERT_TRUE(store->WaitForBatches(1));
+    auto batches = store->GetBatches();
+    ASSERT_EQ(batches[0].size(), 1u);
+    EXPECT_EQ(batches[0][0].SequenceNumber.Value(), 9);
+  }
+
+  TEST(CheckpointCoalescerTest, FlushesOnInterval)
+  {
+    auto store = std::make_shared<RecordingCheckpointStore>();
+    CheckpointCoalescer coalescer(store, std::chrono::milliseconds(20), 0);
+
+    coalescer.UpdateCheckpoint(MakeCheckpoint("0", 1));
+    ASSERT_TRUE(store->WaitForBatches(1));
+    EXPECT_EQ(store->GetBatches()[0][0].SequenceNumber.Value(), 1);
+  }
+
+  TEST(CheckpointCoalescerTest, FailedFlushKeepsCheckpoints)
+  {
+    auto store = std::make_shared<RecordingCheckpointStore>();
+    CheckpointCoalescer coalescer(store, std::chrono::hours(1), 0);
+
+    coalescer.UpdateCheckpoint(MakeCheckpoint("0", 1));
+    coalescer.UpdateCheckpoint(MakeCheckpoint("1", 1));
+    store->FailNextUpdates(1);
+    EXPECT_THROW(coalescer.Flush(), std::runtime_error);
+
+    // A newer checkpoint replaces the one which failed; the other one is retried.
+    coalescer.UpdateCheckpoint(MakeCheckpoint("0", 2));
+    coalescer.Flush();
+    auto batches = store->GetBatches();
+    ASSERT_EQ(batches.size(), 1u);
+    ASSERT_EQ(batches[0].size(), 2u);
+    EXPECT_EQ(batches[0][0].SequenceNumber.Value(), 2);
+    EXPECT_EQ(batches[0][1].SequenceNumber.Value(), 1);
+  }
+
+  TEST(CheckpointCoalescerTest, WritesPendingCheckpointsWhenDestroyed)
+  {
+    auto store = std::make_shared<RecordingCheckpointStore>();
+    {
+      CheckpointCoalescer coalescer(store, std::chrono::hours(1), 0);
+      coalescer.UpdateCheckpoint(MakeCheckpoint("0", 5));
+    }
+    auto batches = store->GetBatches();
+    ASSERT_EQ(batches.size(), 1u);
+    EXPECT_EQ(batches[0][0].SequenceNumber.Value(), 5);
+  }
+
+  TEST(CheckpointCoalescerTest, FlushPartitionWritesOnlyThatPartition)
+  {
+    auto store = std::make_shared<RecordingCheckpointStore>();
+    CheckpointCoalescer coalescer(store, std::chrono::hours(1), 0);
+
+    coalescer.UpdateCheckpoint(MakeCheckpoint("0", 1));
+    coalescer.UpdateCheckpoint(MakeCheckpoint("1", 2));
+    coalescer.Flush("0");
+    auto batches = store->GetBatches();
+    ASSERT_EQ(batches.size(), 1u);
+    ASSERT_EQ(batches[0].size(), 1u);
+    EXPECT_EQ(batches[0][0].PartitionId, "0");
+
+    // A released partition's checkpoint is dropped, not retried, when it can't be written.
+    coalescer.UpdateCheckpoint(MakeCheckpoint("0", 3));
+    store->FailNextUpdates(1);
+    EXPECT_THROW(coalescer.Flush("0"), std::runtime_error);
+
+    coalescer.Flush();
+    batches = store->GetBatches();
+    ASSERT_EQ(batches.size(), 2u);
+    ASSERT_EQ(batches[1].size(), 1u);
+    EXPECT_EQ(batches[1][0].PartitionId, "1");
+  }
+
+  TEST(CheckpointCoalescerTest, DiscardsCheckpointsOfLostPartitions)
+  {
+    auto store = std::make_shared<RecordingCheckpointStore>();
+    {
+      CheckpointCoalescer coalescer(store, std::chrono::hours(1), 0);
+      coalescer.UpdateCheckpoint(MakeCheckpoint("0", 1));
+      coalescer.UpdateCheckpoint(MakeCheckpoint("1", 2));
+      coalescer.UpdateCheckpoint(MakeCheckpoint("2", 3));
+
+      // Partitions 0 and 2 have been claimed by another processor.
+      coalescer.DiscardCheckpointsExcept({"1"});
+    }
+    // Destroying the coalescer writes what is left, which is only the owned partition.
+    auto batches = store->GetBatches();
+    ASSERT_EQ(batches.size(), 1u);
+    ASSERT_EQ(batches[0].size(), 1u);
+    EXPECT_EQ(batches[0][0].PartitionId, "1");
+    EXPECT_EQ(batches[0][0].SequenceNumber.Value(), 2);
+  }
+}}}} // namespace Azure::Messaging::EventHubs::Test
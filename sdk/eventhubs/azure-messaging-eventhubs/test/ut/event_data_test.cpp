@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "../src/private/eventhubs_constants.hpp"
+#include "../src/private/eventhubs_utilities.hpp"
 #include "azure/messaging/eventhubs.hpp"
 #include "eventhubs_test_base.hpp"
 
@@ -241,4 +242,42 @@ TEST_F(EventDataTest, ReceivedEventData)
     EXPECT_FALSE(receivedEventData.EnqueuedTime);
     EXPECT_FALSE(receivedEventData.PartitionKey);
   }
-}
\ No newline at end of file
+}
+// Add events to a batch and verify that every event ends up in its own data section of the batch
+// message.
+TEST_F(EventDataTest, EventDataBatchToAmqpMessage)
+{
+  Azure::Messaging::EventHubs::EventDataBatchOptions options;
+  options.PartitionId = "0";
+  options.MaxBytes = 4096;
+  auto batch
+      = Azure::Messaging::EventHubs::_detail::EventDataBatchFactory::CreateEventDataBatch(options);
+
+  EventData first{1, 2, 3};
+  first.MessageId = "first";
+  EXPECT_TRUE(batch.TryAdd(first));
+  EXPECT_TRUE(batch.TryAdd(EventData{std::vector<uint8_t>(300, 0x42)}));
+  EXPECT_TRUE(batch.TryAdd(EventData{4, 5}));
+  EXPECT_FALSE(batch.TryAdd(EventData{std::vector<uint8_t>(4096, 0x42)}));
+  // The rejected event must not leave anything behind in the batch.
+  EXPECT_TRUE(batch.TryAdd(EventData{6}));
+  EXPECT_EQ(4u, batch.NumberOfEvents());
+
+  auto message = batch.ToAmqpMessage();
+  auto const& body = message.GetBodyAsBinary();
+  ASSERT_EQ(4u, body.size());
+
+  auto firstMessage = AmqpMessage::Deserialize(body[0].data(), body[0].size());
+  EXPECT_EQ(AmqpValue{"first"}, firstMessage.Properties.MessageId);
+  EXPECT_EQ((AmqpBinaryData{1, 2, 3}), firstMessage.GetBodyAsBinary()[0]);
+
+  auto secondMessage = AmqpMessage::Deserialize(body[1].data(), body[1].size());
+  EXPECT_FALSE(secondMessage.Properties.MessageId.IsNull());
+  EXPECT_EQ(300u, secondMessage.GetBodyAsBinary()[0].size());
+
+  auto thirdMessage = AmqpMessage::Deserialize(body[2].data(), body[2].size());
+  EXPECT_EQ((AmqpBinaryData{4, 5}), thirdMessage.GetBodyAsBinary()[0]);
+
+  auto fourthMessage = AmqpMessage::Deserialize(body[3].data(), body[3].size());
+  EXPECT_EQ((AmqpBinaryData{6}), fourthMessage.GetBodyAsBinary()[0]);
+}
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "private/received_event_prefetcher.hpp"
+
+#include <azure/core/amqp/models/amqp_message.hpp>
+#include <azure/core/context.hpp>
+#include <azure/messaging/eventhubs.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace Azure::Messaging::EventHubs;
+using namespace Azure::Messaging::EventHubs::_detail;
+
+namespace Azure { namespace Messaging { namespace EventHubs { namespace Test {
+
+  namespace {
+    std::shared_ptr<Models::ReceivedEventData const> MakeEvent(std::uint8_t value)
+    {
+      auto message = std::make_shared<Azure::Core::Amqp::Models::AmqpMessage>();
+      message->SetBody(Azure::Core::Amqp::Models::AmqpBinaryData{value});
+      return std::make_shared<Models::ReceivedEventData const>(message);
+    }
+
+    // Waits for an event the way the message receiver does: until the context is cancelled.
+    std::shared_ptr<Models::ReceivedEventData const> WaitForever(
+        Azure::Core::Context const& context)
+    {
+      while (!context.IsCancelled())
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      throw Azure::Core::OperationCancelledException("Receive Operation was cancelled.");
+    }
+  } // namespace
+
+  TEST(ReceivedEventPrefetcherTest, ReturnsEventsInOrder)
+  {
+    std::uint8_t next{};
+    ReceivedEventPrefetcher prefetcher(8, [&next](Azure::Core::Context const& context) {
+      if (next == 20)
+      {
+        return WaitForever(context);
+      }
+      return MakeEvent(next++);
+    });
+
+    std::vector<std::shared_ptr<Models::ReceivedEventData const>> events;
+    while (events.size() < 20)
+    {
+      auto const before = events.size();
+      prefetcher.ReceiveEvents(events, static_cast<std::uint32_t>(before + 3), {});
+      EXPECT_GT(events.size(), before);
+      EXPECT_LE(events.size(), before + 3);
+    }
+    for (std::uint8_t i = 0; i < 20; ++i)
+    {
+      EXPECT_EQ(events[i]->Body, std::vector<std::uint8_t>{i});
+    }
+  }
+
+  TEST(ReceivedEventPrefetcherTest, BufferIsBounded)
+  {
+    std::atomic<int> received{0};
+    ReceivedEventPrefetcher prefetcher(4, [&received](Azure::Core::Context const&) {
+      ++received;
+      return MakeEvent(0);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    // The buffered events, and the one waiting for space.
+    EXPECT_LE(received, 5);
+
+    std::vector<std::shared_ptr<Models::ReceivedEventData const>> events;
+    prefetcher.ReceiveEvents(events, 100, {});
+    EXPECT_GE(events.size(), 1u);
+    EXPECT_LE(events.size(), 4u);
+  }
+
+  TEST(ReceivedEventPrefetcherTest, ReportsErrorAfterEvents)
+  {
+    int calls{};
+    ReceivedEventPrefetcher prefetcher(8, [&calls](Azure::Core::Context const&) {
+      if (calls++ == 2)
+      {
+        throw std::runtime_error("Link detached.");
+      }
+      return MakeEvent(static_cast<std::uint8_t>(calls));
+    });
+
+    std::vector<std::shared_ptr<Models::ReceivedEventData const>> events;
+    while (events.size() < 2)
+    {
+      prefetcher.ReceiveEvents(events, 10, {});
+    }
+    EXPECT_EQ(events.size(), 2u);
+    EXPECT_THROW(prefetcher.ReceiveEvents(events, 10, {}), std::runtime_error);
+    // The error is reported again on the next call.
+    EXPECT_THROW(prefetcher.ReceiveEvents(events, 10, {}), std::runtime_error);
+  }
+
+  TEST(ReceivedEventPrefetcherTest, CancelledWhileWaiting)
+  {
+    ReceivedEventPrefetcher prefetcher(8, WaitForever);
+
+    std::vector<std::shared_ptr<Models::ReceivedEventData const>> events;
+    auto context = Azure::Core::Context{}.WithDeadline(
+        std::chrono::system_clock::now() + std::chrono::milliseconds(50));
+    EXPECT_THROW(
+        prefetcher.ReceiveEvents(events, 10, context), Azure::Core::OperationCancelledException);
+    EXPECT_TRUE(events.empty());
+
+    // Stopping cancels the receive of the background thread.
+    prefetcher.Stop();
+  }
+}}}} // namespace Azure::Messaging::EventHubs::Test
@@ -9,15 +9,21 @@
 
 #pragma once
 
+#include <azure/core/context.hpp>
 #include <azure/core/credentials/credentials.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 namespace Azure { namespace Identity { namespace _detail {
   /**
@@ -58,10 +64,29 @@ namespace Azure { namespace Identity { namespace _detail {
     {
       Core::Credentials::AccessToken AccessToken;
       std::shared_timed_mutex ElementMutex;
+      // When the token is renewed ahead of its expiration.
+      std::chrono::system_clock::time_point RefreshOn
+          = (std::chrono::system_clock::time_point::max)();
+      // Set while the token is renewed ahead of its expiration.
+      std::atomic<bool> IsRefreshing{false};
+    };
+
+    // Renews tokens ahead of their expiration, one at a time, so that callers don't wait for it.
+    struct RefreshWorker
+    {
+      std::mutex Mutex;
+      std::condition_variable Condition;
+      std::vector<std::function<void()>> PendingRefreshes;
+      bool Stopped = false;
+      std::thread Thread;
     };
 
     mutable std::map<CacheKey, std::shared_ptr<CacheValue>, CacheKeyComparator> m_cache;
     mutable std::shared_timed_mutex m_cacheMutex;
+    double m_refreshRatio = 0;
+    mutable RefreshWorker m_refreshWorker;
+    // Cancelled when the cache is destroyed, so that the destructor doesn't wait for a renewal.
+    Core::Context m_refreshContext;
 
   private:
     TokenCache(TokenCache const&) = delete;
@@ -73,14 +98,42 @@ namespace Azure { namespace Identity { namespace _detail {
         DateTime::duration minimumExpiration,
         std::chrono::system_clock::time_point now);
 
+    // Stores a new token in a cache element. Caller should be holding ElementMutex for write.
+    void SetToken(
+        std::shared_ptr<CacheValue> const& item,
+        Core::Credentials::AccessToken const& token,
+        std::chrono::system_clock::time_point requestedOn) const;
+
     // Gets item from cache, or creates it, puts into cache, and returns.
     std::shared_ptr<CacheValue> GetOrCreateValue(
         CacheKey const& key,
         DateTime::duration minimumExpiration) const;
 
+    // Renews the token of a cache element on the refresh worker thread.
+    void RefreshInBackground(
+        std::shared_ptr<CacheValue> const& item,
+        std::function<Core::Credentials::AccessToken(Core::Context const&)> const& renewToken)
+        const;
+
   public:
     TokenCache() = default;
-    ~TokenCache() = default;
+
+    /**
+     * @brief Construct a token cache.
+     *
+     * @param refreshRatio The fraction of the lifetime of a token after which it is renewed ahead
+     * of its expiration, for example 0.5. A value of 0, which is what the default constructor
+     * uses, disables renewing tokens before they have to be.
+     *
+     */
+    explicit TokenCache(double refreshRatio) : m_refreshRatio(refreshRatio) {}
+
+    /**
+     * @brief Destructs the token cache, after cancelling and waiting for the renewal of a token
+     * ahead of its expiration which is in progress.
+     *
+     */
+    ~TokenCache();
 
     /**
      * @brief Attempts to get token from cache, and if not found, gets the token using the function
@@ -99,6 +152,38 @@ namespace Azure { namespace Identity { namespace _detail {
         std::string const& scopeString,
         std::string const& tenantId,
         DateTime::duration minimumExpiration,
-        std::function<Core::Credentials::AccessToken()> const& getNewToken) const;
+        std::function<Core::Credentials::AccessToken()> const& getNewToken) const
+    {
+      return GetToken(scopeString, tenantId, minimumExpiration, getNewToken, nullptr);
+    }
+
+    /**
+     * @brief Attempts to get token from cache, and if not found, gets the token using the function
+     * provided, caches it, and returns its value. Once the refresh ratio of the lifetime of the
+     * cached token has elapsed, the token is renewed in the background with \p renewToken.
+     *
+     * @param scopeString Authentication scopes (or resource) as string.
+     * @param tenantId TenantId for authentication.
+     * @param minimumExpiration Minimum token lifetime for the cached value to be returned.
+     * @param getNewToken Function to get the new token for the given \p scopeString, in case when
+     * cache does not have it, or if its remaining lifetime is less than \p minimumExpiration.
+     * @param renewToken Function to renew the cached token ahead of its expiration. It is copied
+     * and called later on another thread, so it must not capture anything by reference. The
+     * context it is called with is cancelled when the cache is destroyed.
+     *
+     * @return Authentication token.
+     *
+     * @remark While the token is renewed, callers keep getting the cached token without waiting.
+     * If renewing fails, the cached token is used as long as it is still valid, and renewing it is
+     * retried 30 seconds later.
+     *
+     */
+    Core::Credentials::AccessToken GetToken(
+        std::string const& scopeString,
+        std::string const& tenantId,
+        DateTime::duration minimumExpiration,
+        std::function<Core::Credentials::AccessToken()> const& getNewToken,
+        std::function<Core::Credentials::AccessToken(Core::Context const&)> const& renewToken)
+        const;
   };
 }}} // namespace Azure::Identity::_detail
@@ -235,22 +235,29 @@ Azure::Core::Credentials::AccessToken AppServiceManagedIdentitySource::GetToken(
     }
   }
 
-  // TokenCache::GetToken() and TokenCredentialImpl::GetToken() can only use the lambda argument
-  // when they are being executed. They are not supposed to keep a reference to lambda argument to
-  // call it later. Therefore, any capture made here will outlive the possible time frame when the
-  // lambda might get called.
-  return m_tokenCache.GetToken(scopesStr, {}, tokenRequestContext.MinimumExpiration, [&]() {
-    return TokenCredentialImpl::GetToken(context, true, [&]() {
-      auto request = std::make_unique<TokenRequest>(m_request);
+  // The token can be renewed in the background after this call has returned, so the renewal only
+  // captures copies, and the base class, which outlives the token cache. TokenCredentialImpl
+  // doesn't keep a reference to its lambda arguments once GetToken() returns.
+  auto const renewToken = [this, scopesStr, request = m_request](
+                              Azure::Core::Context const& renewalContext) {
+    return TokenCredentialImpl::GetToken(renewalContext, true, [&]() {
+      auto tokenRequest = std::make_unique<TokenRequest>(request);
 
       if (!scopesStr.empty())
       {
-        request->HttpRequest.GetUrl().AppendQueryParameter("resource", scopesStr);
+        tokenRequest->HttpRequest.GetUrl().AppendQueryParameter("resource", scopesStr);
       }
 
-      return request;
+      return tokenRequest;
     });
-  });
+  };
+
+  return m_tokenCache.GetToken(
+      scopesStr,
+      {},
+      tokenRequestContext.MinimumExpiration,
+      [&]() { return renewToken(context); },
+      renewToken);
 }
 
 std::unique_ptr<ManagedIdentitySource> AppServiceV2017ManagedIdentitySource::Create(
@@ -336,28 +343,34 @@ Azure::Core::Credentials::AccessToken CloudShellManagedIdentitySource::GetToken(
     }
   }
 
-  // TokenCache::GetToken() and TokenCredentialImpl::GetToken() can only use the lambda argument
-  // when they are being executed. They are not supposed to keep a reference to lambda argument to
-  // call it later. Therefore, any capture made here will outlive the possible time frame when the
-  // lambda might get called.
-  return m_tokenCache.GetToken(scopesStr, {}, tokenRequestContext.MinimumExpiration, [&]() {
-    return TokenCredentialImpl::GetToken(context, true, [&]() {
-      using Azure::Core::Url;
-      using Azure::Core::Http::HttpMethod;
-
-      std::string resource;
-
-      if (!scopesStr.empty())
-      {
-        resource = "resource=" + scopesStr;
-      }
-
-      auto request = std::make_unique<TokenRequest>(HttpMethod::Post, m_url, resource);
-      request->HttpRequest.SetHeader("Metadata", "true");
-
-      return request;
-    });
-  });
+  // The token can be renewed in the background after this call has returned, so the renewal only
+  // captures copies, and the base class, which outlives the token cache. TokenCredentialImpl
+  // doesn't keep a reference to its lambda arguments once GetToken() returns.
+  auto const renewToken
+      = [this, scopesStr, url = m_url](Azure::Core::Context const& renewalContext) {
+          return TokenCredentialImpl::GetToken(renewalContext, true, [&]() {
+            using Azure::Core::Http::HttpMethod;
+
+            std::string resource;
+
+            if (!scopesStr.empty())
+            {
+              resource = "resource=" + scopesStr;
+            }
+
+            auto request = std::make_unique<TokenRequest>(HttpMethod::Post, url, resource);
+            request->HttpRequest.SetHeader("Metadata", "true");
+
+            return request;
+          });
+        };
+
+  return m_tokenCache.GetToken(
+      scopesStr,
+      {},
+      tokenRequestContext.MinimumExpiration,
+      [&]() { return renewToken(context); },
+      renewToken);
 }
 
 std::unique_ptr<ManagedIdentitySource> AzureArcManagedIdentitySource::Create(
@@ -415,78 +428,85 @@ Azure::Core::Credentials::AccessToken AzureArcManagedIdentitySource::GetToken(
     }
   }
 
-  auto const createRequest = [&]() {
-    using Azure::Core::Http::HttpMethod;
-    using Azure::Core::Http::Request;
-
-    auto request = std::make_unique<TokenRequest>(Request(HttpMethod::Get, m_url));
-    {
-      auto& httpRequest = request->HttpRequest;
-      httpRequest.SetHeader("Metadata", "true");
-
-      if (!scopesStr.empty())
-      {
-        httpRequest.GetUrl().AppendQueryParameter("resource", scopesStr);
-      }
-    }
-
-    return request;
-  };
-
-  // TokenCache::GetToken() and TokenCredentialImpl::GetToken() can only use the lambda argument
-  // when they are being executed. They are not supposed to keep a reference to lambda argument to
-  // call it later. Therefore, any capture made here will outlive the possible time frame when the
-  // lambda might get called.
-  return m_tokenCache.GetToken(scopesStr, {}, tokenRequestContext.MinimumExpiration, [&]() {
-    return TokenCredentialImpl::GetToken(
-        context,
-        true,
-        createRequest,
-        [&](auto const statusCode, auto const& response) -> std::unique_ptr<TokenRequest> {
-          using Core::Credentials::AuthenticationException;
-          using Core::Http::HttpStatusCode;
-
-          if (statusCode != HttpStatusCode::Unauthorized)
-          {
-            return nullptr;
-          }
-
-          auto const& headers = response.GetHeaders();
-          auto authHeader = headers.find("WWW-Authenticate");
-          if (authHeader == headers.end())
-          {
-            throw AuthenticationException(
-                "Did not receive expected 'WWW-Authenticate' header "
-                "in the response from Azure Arc Managed Identity Endpoint.");
-          }
-
-          constexpr auto ChallengeValueSeparator = '=';
-          auto const& challenge = authHeader->second;
-          auto eq = challenge.find(ChallengeValueSeparator);
-          if (eq == std::string::npos
-              || challenge.find(ChallengeValueSeparator, eq + 1) != std::string::npos)
-          {
-            throw AuthenticationException(
-                "The 'WWW-Authenticate' header in the response from Azure Arc "
-                "Managed Identity Endpoint did not match the expected format.");
-          }
-
-          auto request = createRequest();
-
-          const std::string fileName = challenge.substr(eq + 1);
-          ValidateArcKeyFile(fileName);
-
-          std::ifstream secretFile(fileName);
-          request->HttpRequest.SetHeader(
-              "Authorization",
-              "Basic "
-                  + std::string(
-                      std::istreambuf_iterator<char>(secretFile),
-                      std::istreambuf_iterator<char>()));
-
-          return request;
-        });
-  });
+  // The token can be renewed in the background after this call has returned, so the renewal only
+  // captures copies, and the base class, which outlives the token cache. TokenCredentialImpl
+  // doesn't keep a reference to its lambda arguments once GetToken() returns.
+  auto const renewToken
+      = [this, scopesStr, url = m_url](Azure::Core::Context const& renewalContext) {
+          auto const createRequest = [&]() {
+            using Azure::Core::Http::HttpMethod;
+            using Azure::Core::Http::Request;
+
+            auto request = std::make_unique<TokenRequest>(Request(HttpMethod::Get, url));
+            {
+              auto& httpRequest = request->HttpRequest;
+              httpRequest.SetHeader("Metadata", "true");
+
+              if (!scopesStr.empty())
+              {
+                httpRequest.GetUrl().AppendQueryParameter("resource", scopesStr);
+              }
+            }
+
+            return request;
+          };
+
+          return TokenCredentialImpl::GetToken(
+              renewalContext,
+              true,
+              createRequest,
+              [&](auto const statusCode, auto const& response) -> std::unique_ptr<TokenRequest> {
+                using Core::Credentials::AuthenticationException;
+                using Core::Http::HttpStatusCode;
+
+                if (statusCode != HttpStatusCode::Unauthorized)
+                {
+                  return nullptr;
+                }
+
+                auto const& headers = response.GetHeaders();
+                auto authHeader = headers.find("WWW-Authenticate");
+                if (authHeader == headers.end())
+                {
+                  throw AuthenticationException(
+                      "Did not receive expected 'WWW-Authenticate' header "
+                      "in the response from Azure Arc Managed Identity Endpoint.");
+                }
+
+                constexpr auto ChallengeValueSeparator = '=';
+                auto const& challenge = authHeader->second;
+                auto eq = challenge.find(ChallengeValueSeparator);
+                if (eq == std::string::npos
+                    || challenge.find(ChallengeValueSeparator, eq + 1) != std::string::npos)
+                {
+                  throw AuthenticationException(
+                      "The 'WWW-Authenticate' header in the response from Azure Arc "
+                      "Managed Identity Endpoint did not match the expected format.");
+                }
+
+                auto request = createRequest();
+
+                const std::string fileName = challenge.substr(eq + 1);
+                ValidateArcKeyFile(fileName);
+
+                std::ifstream secretFile(fileName);
+                request->HttpRequest.SetHeader(
+                    "Authorization",
+                    "Basic "
+                        + std::string(
+                            std::istreambuf_iterator<char>(secretFile),
+                            std::istreambuf_iterator<char>()));
+
+                return request;
+              });
+        };
+
+  return m_tokenCache.GetToken(
+      scopesStr,
+      {},
+      tokenRequestContext.MinimumExpiration,
+      [&]() { return renewToken(context); },
+      renewToken);
 }
 
 std::unique_ptr<ManagedIdentitySource> ImdsManagedIdentitySource::Create(
@@ -553,20 +573,27 @@ Azure::Core::Credentials::AccessToken ImdsManagedIdentitySource::GetToken(
     }
   }
 
-  // TokenCache::GetToken() and TokenCredentialImpl::GetToken() can only use the lambda argument
-  // when they are being executed. They are not supposed to keep a reference to lambda argument to
-  // call it later. Therefore, any capture made here will outlive the possible time frame when the
-  // lambda might get called.
-  return m_tokenCache.GetToken(scopesStr, {}, tokenRequestContext.MinimumExpiration, [&]() {
-    return TokenCredentialImpl::GetToken(context, true, [&]() {
-      auto request = std::make_unique<TokenRequest>(m_request);
+  // The token can be renewed in the background after this call has returned, so the renewal only
+  // captures copies, and the base class, which outlives the token cache. TokenCredentialImpl
+  // doesn't keep a reference to its lambda arguments once GetToken() returns.
+  auto const renewToken = [this, scopesStr, request = m_request](
+                              Azure::Core::Context const& renewalContext) {
+    return TokenCredentialImpl::GetToken(renewalContext, true, [&]() {
+      auto tokenRequest = std::make_unique<TokenRequest>(request);
 
       if (!scopesStr.empty())
       {
-        request->HttpRequest.GetUrl().AppendQueryParameter("resource", scopesStr);
+        tokenRequest->HttpRequest.GetUrl().AppendQueryParameter("resource", scopesStr);
       }
 
-      return request;
+      return tokenRequest;
     });
-  });
+  };
+
+  return m_tokenCache.GetToken(
+      scopesStr,
+      {},
+      tokenRequestContext.MinimumExpiration,
+      [&]() { return renewToken(context); },
+      renewToken);
 }
@@ -26,7 +26,9 @@ namespace Azure { namespace Identity { namespace _detail {
         Core::Context const& context) const = 0;
 
   protected:
-    _detail::TokenCache m_tokenCache;
+    // Getting a token from a managed identity endpoint can be slow, so tokens are renewed in the
+    // background once half of their lifetime has elapsed, before callers have to wait for it.
+    _detail::TokenCache m_tokenCache{0.5};
 
     static Core::Url ParseEndpointUrl(
         std::string const& credName,
@@ -3,11 +3,16 @@
 
 #include "azure/identity/detail/token_cache.hpp"
 
+#include "private/identity_log.hpp"
+
 #include <algorithm>
 #include <array>
 #include <limits>
 #include <mutex>
+#include <string>
+#include <utility>
 
+using Azure::Identity::_detail::IdentityLog;
 using Azure::Identity::_detail::TokenCache;
 
 using Azure::DateTime;
@@ -23,9 +28,29 @@ bool TokenCache::IsFresh(
   return (item->AccessToken.ExpiresOn - minimumExpiration) > DateTime(now);
 }
 
+void TokenCache::SetToken(
+    std::shared_ptr<TokenCache::CacheValue> const& item,
+    AccessToken const& token,
+    std::chrono::system_clock::time_point requestedOn) const
+{
+  item->AccessToken = token;
+  item->RefreshOn = (std::chrono::system_clock::time_point::max)();
+
+  auto const expiresOn = static_cast<std::chrono::system_clock::time_point>(token.ExpiresOn);
+  if (m_refreshRatio > 0 && m_refreshRatio < 1 && expiresOn > requestedOn)
+  {
+    item->RefreshOn = requestedOn
+        + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                          (expiresOn - requestedOn) * m_refreshRatio);
+  }
+}
+
 namespace {
 template <typename T> bool ShouldCleanUpCacheFromExpiredItems(T cacheSize);
-}
+
+// How long to wait before renewing a token ahead of its expiration again, after renewing failed.
+constexpr std::chrono::seconds RefreshRetryDelay(30);
+} // namespace
 
 std::shared_ptr<TokenCache::CacheValue> TokenCache::GetOrCreateValue(
     CacheKey const& key,
@@ -86,19 +111,116 @@ std::shared_ptr<TokenCache::CacheValue> TokenCache::GetOrCreateValue(
   return m_cache[key] = std::make_shared<CacheValue>();
 }
 
+TokenCache::~TokenCache()
+{
+  m_refreshContext.Cancel();
+  {
+    std::lock_guard<std::mutex> lock(m_refreshWorker.Mutex);
+    m_refreshWorker.Stopped = true;
+  }
+  m_refreshWorker.Condition.notify_one();
+  if (m_refreshWorker.Thread.joinable())
+  {
+    m_refreshWorker.Thread.join();
+  }
+}
+
+void TokenCache::RefreshInBackground(
+    std::shared_ptr<CacheValue> const& item,
+    std::function<AccessToken(Azure::Core::Context const&)> const& renewToken) const
+{
+  auto refresh = [this, item, renewToken]() {
+    auto const requestedOn = std::chrono::system_clock::now();
+    std::string error;
+    try
+    {
+      auto const newToken = renewToken(m_refreshContext);
+      {
+        std::unique_lock<std::shared_timed_mutex> itemWriteLock(item->ElementMutex);
+        SetToken(item, newToken, requestedOn);
+      }
+      item->IsRefreshing = false;
+      return;
+    }
+    catch (std::exception const& e)
+    {
+      error = e.what();
+    }
+    catch (...)
+    {
+      error = "Unknown error.";
+    }
+
+    {
+      // Don't renew the token on every call while the service is failing.
+      std::unique_lock<std::shared_timed_mutex> itemWriteLock(item->ElementMutex);
+      item->RefreshOn = (std::min)(
+          std::chrono::system_clock::now() + RefreshRetryDelay,
+          static_cast<std::chrono::system_clock::time_point>(item->AccessToken.ExpiresOn));
+    }
+    item->IsRefreshing = false;
+    IdentityLog::Write(
+        IdentityLog::Level::Warning,
+        "Failed to renew a token ahead of its expiration, the cached token is used: " + error);
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(m_refreshWorker.Mutex);
+    if (m_refreshWorker.Stopped)
+    {
+      item->IsRefreshing = false;
+      return;
+    }
+    m_refreshWorker.PendingRefreshes.emplace_back(std::move(refresh));
+    if (!m_refreshWorker.Thread.joinable())
+    {
+      m_refreshWorker.Thread = std::thread([this]() {
+        std::unique_lock<std::mutex> lock(m_refreshWorker.Mutex);
+        for (;;)
+        {
+          m_refreshWorker.Condition.wait(lock, [this]() {
+            return m_refreshWorker.Stopped || !m_refreshWorker.PendingRefreshes.empty();
+          });
+          if (m_refreshWorker.Stopped)
+          {
+            return;
+          }
+          std::vector<std::function<void()>> refreshes;
+          refreshes.swap(m_refreshWorker.PendingRefreshes);
+          lock.unlock();
+          for (auto const& pendingRefresh : refreshes)
+          {
+            pendingRefresh();
+          }
+          lock.lock();
+        }
+      });
+    }
+  }
+  m_refreshWorker.Condition.notify_one();
+}
+
 AccessToken TokenCache::GetToken(
     std::string const& scopeString,
     std::string const& tenantId,
     DateTime::duration minimumExpiration,
-    std::function<AccessToken()> const& getNewToken) const
+    std::function<AccessToken()> const& getNewToken,
+    std::function<AccessToken(Azure::Core::Context const&)> const& renewToken) const
 {
   auto const item = GetOrCreateValue({scopeString, tenantId}, minimumExpiration);
 
   {
     std::shared_lock<std::shared_timed_mutex> itemReadLock(item->ElementMutex);
 
-    if (IsFresh(item, minimumExpiration, std::chrono::system_clock::now()))
+    auto const now = std::chrono::system_clock::now();
+    if (IsFresh(item, minimumExpiration, now))
     {
+      // Only one renewal ahead of the expiration is in progress at a time, and callers keep using
+      // the cached token while it runs.
+      if (renewToken && now >= item->RefreshOn && !item->IsRefreshing.exchange(true))
+      {
+        RefreshInBackground(item, renewToken);
+      }
       return item->AccessToken;
     }
   }
@@ -116,8 +238,9 @@ AccessToken TokenCache::GetToken(
     return item->AccessToken;
   }
 
+  auto const requestedOn = std::chrono::system_clock::now();
   auto const newToken = getNewToken();
-  item->AccessToken = newToken;
+  SetToken(item, newToken, requestedOn);
   return newToken;
 }
 
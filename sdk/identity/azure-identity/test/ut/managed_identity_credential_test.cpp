@@ -5,9 +5,16 @@
 #include "credential_test_helper.hpp"
 
 #include <azure/core/diagnostics/logger.hpp>
+#include <azure/core/http/transport.hpp>
 #include <azure/core/internal/environment.hpp>
+#include <azure/core/io/body_stream.hpp>
 
+#include <chrono>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -3038,4 +3045,103 @@ namespace Azure { namespace Identity { namespace Test {
     EXPECT_LE(response2.AccessToken.ExpiresOn, response2.LatestExpiration + 3600s);
   }
 
+  namespace {
+    class CallbackTransport final : public Azure::Core::Http::HttpTransport {
+    public:
+      using SendCallback = std::function<std::unique_ptr<Azure::Core::Http::RawResponse>()>;
+
+      explicit CallbackTransport(SendCallback send) : m_send(std::move(send)) {}
+
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request&,
+          Azure::Core::Context const&) override
+      {
+        return m_send();
+      }
+
+    private:
+      SendCallback m_send;
+    };
+  } // namespace
+
+  TEST(ManagedIdentityCredential, ImdsRenewsTokenInBackground)
+  {
+    using Azure::Core::Http::RawResponse;
+    using Azure::Core::IO::MemoryBodyStream;
+
+    CredentialTestHelper::EnvironmentOverride const env({
+        {"MSI_ENDPOINT", ""},
+        {"MSI_SECRET", ""},
+        {"IDENTITY_ENDPOINT", ""},
+        {"IMDS_ENDPOINT", ""},
+        {"IDENTITY_HEADER", ""},
+        {"IDENTITY_SERVER_THUMBPRINT", ""},
+    });
+
+    std::string const responses[] = {
+        "{\"expires_in\":2, \"access_token\":\"ACCESSTOKEN1\"}",
+        "{\"expires_in\":3600, \"access_token\":\"ACCESSTOKEN2\"}",
+        "{\"expires_in\":3600, \"access_token\":\"ACCESSTOKEN3\"}",
+    };
+    std::vector<std::vector<uint8_t>> const responseBuffers
+        = {std::vector<uint8_t>(responses[0].begin(), responses[0].end()),
+           std::vector<uint8_t>(responses[1].begin(), responses[1].end()),
+           std::vector<uint8_t>(responses[2].begin(), responses[2].end())};
+
+    std::mutex requestMutex;
+    size_t requestCount = 0;
+    std::promise<void> renewalStarted;
+    std::promise<void> releaseRenewal;
+    auto releaseRenewalFuture = releaseRenewal.get_future();
+
+    TokenCredentialOptions options;
+    options.Transport.Transport = std::make_shared<CallbackTransport>([&]() {
+      size_t requestIndex = 0;
+      {
+        std::lock_guard<std::mutex> lock(requestMutex);
+        requestIndex = (std::min)(requestCount++, responseBuffers.size() - 1);
+      }
+      if (requestIndex == 1)
+      {
+        renewalStarted.set_value();
+        releaseRenewalFuture.wait();
+      }
+      auto response = std::make_unique<RawResponse>(1, 1, HttpStatusCode::Ok, "OK");
+      response->SetBodyStream(std::make_unique<MemoryBodyStream>(responseBuffers[requestIndex]));
+      return response;
+    });
+
+    ManagedIdentityCredential const credential(options);
+
+    Azure::Core::Credentials::TokenRequestContext tokenRequestContext;
+    tokenRequestContext.Scopes = {"https://azure.com/.default"};
+    tokenRequestContext.MinimumExpiration = std::chrono::seconds(0);
+
+    EXPECT_EQ(credential.GetToken(tokenRequestContext, {}).Token, "ACCESSTOKEN1");
+
+    // Once half of the lifetime of the token has elapsed, the cached token is returned while the
+    // token is renewed on another thread. The renewal is held up by the transport until the end
+    // of the test, so a caller which renewed the token itself would never get here.
+    std::this_thread::sleep_for(std::chrono::milliseconds(1200));
+    EXPECT_EQ(credential.GetToken(tokenRequestContext, {}).Token, "ACCESSTOKEN1");
+    renewalStarted.get_future().wait();
+    EXPECT_EQ(credential.GetToken(tokenRequestContext, {}).Token, "ACCESSTOKEN1");
+
+    releaseRenewal.set_value();
+    std::string token;
+    for (int i = 0; i < 100; ++i)
+    {
+      token = credential.GetToken(tokenRequestContext, {}).Token;
+      if (token != "ACCESSTOKEN1")
+      {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(token, "ACCESSTOKEN2");
+
+    std::lock_guard<std::mutex> lock(requestMutex);
+    EXPECT_EQ(requestCount, 2U);
+  }
+
 }}} // namespace Azure::Identity::Test
@@ -4,7 +4,10 @@
 #include "azure/identity/client_secret_credential.hpp"
 #include "azure/identity/detail/token_cache.hpp"
 
+#include <future>
 #include <mutex>
+#include <stdexcept>
+#include <thread>
 
 #include <gtest/gtest.h>
 
@@ -15,6 +18,9 @@ using Azure::Identity::_detail::TokenCache;
 namespace {
 class TestableTokenCache final : public TokenCache {
 public:
+  TestableTokenCache() = default;
+  explicit TestableTokenCache(double refreshRatio) : TokenCache(refreshRatio) {}
+
   using TokenCache::CacheValue;
   using TokenCache::m_cache;
   using TokenCache::m_cacheMutex;
@@ -372,6 +378,253 @@ TEST(TokenCache, MinimumExpiration)
   EXPECT_EQ(token2.Token, "T2");
 }
 
+TEST(TokenCache, NoRefreshAheadByDefault)
+{
+  TestableTokenCache tokenCache;
+
+  DateTime const Tomorrow = std::chrono::system_clock::now() + 24h;
+
+  auto const token1 = tokenCache.GetToken("A", {}, 2min, [=]() {
+    AccessToken result;
+    result.Token = "T1";
+    result.ExpiresOn = Tomorrow;
+    return result;
+  });
+  EXPECT_EQ(token1.Token, "T1");
+
+  auto const item = tokenCache.m_cache[{"A", {}}];
+  EXPECT_EQ(item->RefreshOn, (std::chrono::system_clock::time_point::max)());
+}
+
+namespace {
+// Waits for the renewal of a token ahead of its expiration to complete on the worker thread.
+void WaitForRefresh(TestableTokenCache::CacheValue const& item)
+{
+  for (int i = 0; i < 1000 && item.IsRefreshing; ++i)
+  {
+    std::this_thread::sleep_for(10ms);
+  }
+  EXPECT_FALSE(item.IsRefreshing);
+}
+} // namespace
+
+TEST(TokenCache, RefreshAhead)
+{
+  TestableTokenCache tokenCache(0.5);
+
+  auto const Now = std::chrono::system_clock::now();
+  DateTime const Tomorrow = Now + 24h;
+
+  auto const notRenewed = [](Azure::Core::Context const&) {
+    EXPECT_FALSE("Token is not past its refresh time.");
+    return AccessToken();
+  };
+
+  auto const token1 = tokenCache.GetToken(
+      "A",
+      {},
+      2min,
+      [=]() {
+        AccessToken result;
+        result.Token = "T1";
+        result.ExpiresOn = Tomorrow;
+        return result;
+      },
+      notRenewed);
+  EXPECT_EQ(token1.Token, "T1");
+
+  // The token is renewed once half of its lifetime has elapsed.
+  auto const item = tokenCache.m_cache[{"A", {}}];
+  EXPECT_GE(item->RefreshOn, Now + 12h);
+  EXPECT_LT(item->RefreshOn, Now + 12h + 1min);
+
+  auto const token2 = tokenCache.GetToken(
+      "A",
+      {},
+      2min,
+      [=]() {
+        EXPECT_FALSE("Token is still valid.");
+        return AccessToken();
+      },
+      notRenewed);
+  EXPECT_EQ(token2.Token, "T1");
+
+  // The cached token is returned, and is renewed in the background.
+  item->RefreshOn = std::chrono::system_clock::now() - 1s;
+  auto const token3 = tokenCache.GetToken(
+      "A",
+      {},
+      2min,
+      [=]() {
+        EXPECT_FALSE("Token is still valid.");
+        return AccessToken();
+      },
+      [=](Azure::Core::Context const&) {
+        AccessToken result;
+        result.Token = "T3";
+        result.ExpiresOn = Tomorrow + 1h;
+        return result;
+      });
+  EXPECT_EQ(token3.Token, "T1");
+  WaitForRefresh(*item);
+  EXPECT_EQ(item->AccessToken.Token, "T3");
+  EXPECT_GT(item->RefreshOn, std::chrono::system_clock::now());
+
+  // When renewing fails, the cached token is still valid and is used.
+  item->RefreshOn = std::chrono::system_clock::now() - 1s;
+  auto const token4 = tokenCache.GetToken(
+      "A",
+      {},
+      2min,
+      [=]() {
+        EXPECT_FALSE("Token is still valid.");
+        return AccessToken();
+      },
+      [=](Azure::Core::Context const&) -> AccessToken {
+        throw std::runtime_error("Service unavailable.");
+      });
+  EXPECT_EQ(token4.Token, "T3");
+  WaitForRefresh(*item);
+  EXPECT_EQ(item->AccessToken.Token, "T3");
+
+  // Renewing the token is retried later, rather than by every caller while the service fails.
+  EXPECT_GT(item->RefreshOn, std::chrono::system_clock::now() + 20s);
+  EXPECT_LE(item->RefreshOn, std::chrono::system_clock::now() + 30s);
+  auto const token5 = tokenCache.GetToken(
+      "A",
+      {},
+      2min,
+      [=]() {
+        EXPECT_FALSE("Token is still valid.");
+        return AccessToken();
+      },
+      [=](Azure::Core::Context const&) {
+        EXPECT_FALSE("Renewing the token is not retried yet.");
+        return AccessToken();
+      });
+  EXPECT_EQ(token5.Token, "T3");
+}
+
+TEST(TokenCache, RefreshAheadRetryIsCappedAtExpiration)
+{
+  TestableTokenCache tokenCache(0.5);
+
+  DateTime const ExpiresOn = std::chrono::system_clock::now() + 10min;
+
+  static_cast<void>(tokenCache.GetToken("A", {}, 0s, [=]() {
+    AccessToken result;
+    result.Token = "T1";
+    result.ExpiresOn = ExpiresOn;
+    return result;
+  }));
+  auto const item = tokenCache.m_cache[{"A", {}}];
+  item->RefreshOn = std::chrono::system_clock::now() - 1s;
+  item->AccessToken.ExpiresOn = std::chrono::system_clock::now() + 10s;
+
+  auto const token = tokenCache.GetToken(
+      "A",
+      {},
+      0s,
+      [=]() {
+        EXPECT_FALSE("Token is still valid.");
+        return AccessToken();
+      },
+      [=](Azure::Core::Context const&) -> AccessToken {
+        throw std::runtime_error("Service unavailable.");
+      });
+  EXPECT_EQ(token.Token, "T1");
+  WaitForRefresh(*item);
+  EXPECT_EQ(
+      item->RefreshOn,
+      static_cast<std::chrono::system_clock::time_point>(item->AccessToken.ExpiresOn));
+}
+
+TEST(TokenCache, RefreshAheadDoesNotBlockCallers)
+{
+  TestableTokenCache tokenCache(0.5);
+
+  DateTime const Tomorrow = std::chrono::system_clock::now() + 24h;
+
+  static_cast<void>(tokenCache.GetToken("A", {}, 2min, [=]() {
+    AccessToken result;
+    result.Token = "T1";
+    result.ExpiresOn = Tomorrow;
+    return result;
+  }));
+  auto const item = tokenCache.m_cache[{"A", {}}];
+  item->RefreshOn = std::chrono::system_clock::now() - 1s;
+
+  auto const tokenIsValid = [=]() {
+    EXPECT_FALSE("Token is still valid.");
+    return AccessToken();
+  };
+
+  // The caller which finds the token past its refresh time doesn't wait for the renewal either.
+  auto refreshStarted = std::make_shared<std::promise<void>>();
+  auto refreshCompleted = std::make_shared<std::promise<void>>();
+  auto const token1 = tokenCache.GetToken(
+      "A", {}, 2min, tokenIsValid, [=](Azure::Core::Context const&) {
+        refreshStarted->set_value();
+        refreshCompleted->get_future().wait();
+        AccessToken result;
+        result.Token = "T2";
+        result.ExpiresOn = Tomorrow + 1h;
+        return result;
+      });
+  EXPECT_EQ(token1.Token, "T1");
+
+  refreshStarted->get_future().wait();
+  auto const token2
+      = tokenCache.GetToken("A", {}, 2min, tokenIsValid, [=](Azure::Core::Context const&) {
+          EXPECT_FALSE("The token is already being renewed.");
+          return AccessToken();
+        });
+  EXPECT_EQ(token2.Token, "T1");
+
+  refreshCompleted->set_value();
+  WaitForRefresh(*item);
+
+  auto const renewedToken = tokenCache.GetToken("A", {}, 2min, tokenIsValid);
+  EXPECT_EQ(renewedToken.Token, "T2");
+}
+
+TEST(TokenCache, DestructorCancelsRefreshAhead)
+{
+  auto refreshStarted = std::make_shared<std::promise<void>>();
+  {
+    TestableTokenCache tokenCache(0.5);
+
+    static_cast<void>(tokenCache.GetToken("A", {}, 2min, [=]() {
+      AccessToken result;
+      result.Token = "T1";
+      result.ExpiresOn = std::chrono::system_clock::now() + 24h;
+      return result;
+    }));
+    tokenCache.m_cache[{"A", {}}]->RefreshOn = std::chrono::system_clock::now() - 1s;
+
+    auto const token = tokenCache.GetToken(
+        "A",
+        {},
+        2min,
+        [=]() {
+          EXPECT_FALSE("Token is still valid.");
+          return AccessToken();
+        },
+        [=](Azure::Core::Context const& context) -> AccessToken {
+          refreshStarted->set_value();
+          while (!context.IsCancelled())
+          {
+            std::this_thread::sleep_for(1ms);
+          }
+          context.ThrowIfCancelled();
+          return AccessToken();
+        });
+    EXPECT_EQ(token.Token, "T1");
+
+    refreshStarted->get_future().wait();
+  }
+}
+
 TEST(TokenCache, MultithreadedAccess)
 {
   TestableTokenCache tokenCache;
@@ -15,6 +15,9 @@
 
 #include <azure/core/internal/client_options.hpp>
 
+#include <chrono>
+#include <string>
+
 namespace Azure {
   namespace Security {
     namespace KeyVault {
@@ -37,6 +40,27 @@ namespace Azure {
      */
     std::string Version;
 
+    /**
+     * @brief Run public-key operations in-process instead of sending them to Key Vault.
+     *
+     * @details When enabled, the client fetches the key (which requires the keys/get permission)
+     * and runs #CryptographyClient::Encrypt, #CryptographyClient::WrapKey,
+     * #CryptographyClient::Verify and #CryptographyClient::VerifyData locally whenever the key
+     * type, its permitted operations and the algorithm allow it. Every other operation, and any
+     * operation the key can't serve locally, is still sent to Key Vault.
+     *
+     * @remark The `RawResponse` of an operation that ran locally is null.
+     *
+     */
+    bool EnableLocalCryptography = false;
+
+    /**
+     * @brief How long a fetched key is used for local operations before it is fetched again, so
+     * that key rotations and attribute changes are picked up.
+     *
+     */
+    std::chrono::minutes LocalKeyRefreshInterval = std::chrono::minutes(60);
+
     /**
      * @brief Construct a new Key Client Options object.
      *
@@ -10,6 +10,7 @@
 #include "../private/key_verify_parameters.hpp"
 #include "../private/key_wrap_parameters.hpp"
 #include "../private/keyvault_protocol.hpp"
+#include "../private/local_cryptography_provider.hpp"
 #include "../private/package_version.hpp"
 #include "azure/keyvault/keys/key_client_models.hpp"
 
@@ -21,7 +22,10 @@
 #include <azure/keyvault/shared/keyvault_shared.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -61,6 +65,20 @@ inline std::vector<uint8_t> CreateDigest(
   return hashAlgorithm->Final(data.data(), data.size());
 }
 
+// How long to wait before fetching the key for local cryptography again, after the service
+// couldn't be reached.
+constexpr std::chrono::seconds LocalKeyRetryDelay(30);
+
+// Whether fetching the key failed for a reason unrelated to the key itself, such as a network
+// error, throttling, or a service error.
+bool IsTransientFailure(Azure::Core::RequestFailedException const& error)
+{
+  auto const statusCode = static_cast<int>(error.StatusCode);
+  return error.StatusCode == HttpStatusCode::None
+      || error.StatusCode == HttpStatusCode::RequestTimeout
+      || error.StatusCode == HttpStatusCode::TooManyRequests || statusCode >= 500;
+}
+
 } // namespace
 
 Request CryptographyClient::CreateRequest(
@@ -91,6 +109,91 @@ std::unique_ptr<Azure::Core::Http::RawResponse> CryptographyClient::SendCryptoRe
       *m_pipeline, request, context);
 }
 
+std::shared_ptr<LocalCryptographyProvider const> CryptographyClient::GetLocalProvider(
+    Azure::Core::Context const& context) const
+{
+  if (!m_localKeyCache)
+  {
+    return nullptr;
+  }
+  auto& cache = *m_localKeyCache;
+
+  std::shared_ptr<LocalCryptographyProvider const> provider;
+  {
+    std::lock_guard<std::mutex> lock(cache.Mutex);
+    if (std::chrono::steady_clock::now() < cache.RefreshOn)
+    {
+      return cache.Provider;
+    }
+    provider = cache.Provider;
+  }
+
+  // The key is due to be fetched. One caller fetches it; while it does, the others keep using the
+  // previous key, or wait for it when there is none yet.
+  std::unique_lock<std::mutex> refreshLock(cache.RefreshMutex, std::defer_lock);
+  if (!provider)
+  {
+    refreshLock.lock();
+  }
+  else if (!refreshLock.try_lock())
+  {
+    return provider;
+  }
+  {
+    std::lock_guard<std::mutex> lock(cache.Mutex);
+    if (std::chrono::steady_clock::now() < cache.RefreshOn)
+    {
+      return cache.Provider;
+    }
+  }
+
+  std::unique_ptr<Azure::Core::Http::RawResponse> rawResponse;
+  try
+  {
+    auto request = CreateRequest(HttpMethod::Get);
+    request.SetHeader(HttpShared::Accept, HttpShared::ApplicationJson);
+    rawResponse = Azure::Security::KeyVault::_detail::KeyVaultKeysCommonRequest::SendRequest(
+        *m_pipeline, request, context);
+  }
+  catch (Azure::Core::RequestFailedException const& e)
+  {
+    if (IsTransientFailure(e))
+    {
+      // The service couldn't be reached, which says nothing about the key. Keep using the
+      // previous key, if any, and try again soon rather than after the refresh interval.
+      std::chrono::steady_clock::duration const retryDelay = LocalKeyRetryDelay;
+      std::lock_guard<std::mutex> lock(cache.Mutex);
+      cache.RefreshOn
+          = std::chrono::steady_clock::now() + (std::min)(retryDelay, cache.RefreshInterval);
+      return cache.Provider;
+    }
+    rawResponse = nullptr;
+  }
+
+  // Without the keys/get permission, or with a key that can't be read, every operation goes to
+  // the service until the key is due to be fetched again.
+  provider = nullptr;
+  if (rawResponse)
+  {
+    // Parsing throws JSON, Base64url and date range errors for a key that can't be read. Nothing
+    // else runs in this block, so a cancellation from the request above still propagates.
+    try
+    {
+      provider = std::make_shared<LocalCryptographyProvider const>(
+          LocalCryptographyProvider::KeyVaultKeyDeserialize(*rawResponse));
+    }
+    catch (std::exception const&)
+    {
+      provider = nullptr;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.Provider = provider;
+  cache.RefreshOn = std::chrono::steady_clock::now() + cache.RefreshInterval;
+  return provider;
+}
+
 CryptographyClient::~CryptographyClient() = default;
 
 CryptographyClient::CryptographyClient(
@@ -116,12 +219,26 @@ CryptographyClient::CryptographyClient(
       PackageVersion::ToString(),
       std::move(perRetryPolicies),
       std::move(perCallPolicies));
+
+  if (options.EnableLocalCryptography)
+  {
+    m_localKeyCache = std::make_shared<LocalKeyCache>(options.LocalKeyRefreshInterval);
+  }
 }
 
 Azure::Response<EncryptResult> CryptographyClient::Encrypt(
     EncryptParameters const& parameters,
     Azure::Core::Context const& context)
 {
+  if (auto localProvider = GetLocalProvider(context))
+  {
+    auto localResult = localProvider->Encrypt(parameters);
+    if (localResult.HasValue())
+    {
+      return Azure::Response<EncryptResult>(std::move(localResult.Value()), nullptr);
+    }
+  }
+
   // Send and parse response
   auto rawResponse = SendCryptoRequest(
       {EncryptValue}, EncryptParametersSerializer::EncryptParametersSerialize(parameters), context);
@@ -147,6 +264,15 @@ Azure::Response<WrapResult> CryptographyClient::WrapKey(
     std::vector<uint8_t> const& key,
     Azure::Core::Context const& context)
 {
+  if (auto localProvider = GetLocalProvider(context))
+  {
+    auto localResult = localProvider->WrapKey(algorithm, key);
+    if (localResult.HasValue())
+    {
+      return Azure::Response<WrapResult>(std::move(localResult.Value()), nullptr);
+    }
+  }
+
   // Send and parse response
   auto rawResponse = SendCryptoRequest(
       {WrapKeyValue},
@@ -212,6 +338,15 @@ Azure::Response<VerifyResult> CryptographyClient::Verify(
     std::vector<uint8_t> const& signature,
     Azure::Core::Context const& context)
 {
+  if (auto localProvider = GetLocalProvider(context))
+  {
+    auto localResult = localProvider->Verify(algorithm, digest, signature);
+    if (localResult.HasValue())
+    {
+      return Azure::Response<VerifyResult>(std::move(localResult.Value()), nullptr);
+    }
+  }
+
   // Send and parse response
   auto rawResponse = SendCryptoRequest(
       {VerifyValue},
@@ -0,0 +1,594 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "../private/local_cryptography_provider.hpp"
+
+#include "../private/key_constants.hpp"
+#include "../private/key_serializers.hpp"
+#include "azure/keyvault/keys/cryptography/cryptography_client_models.hpp"
+#include "azure/keyvault/keys/key_client_models.hpp"
+
+#include <azure/core/base64.hpp>
+#include <azure/core/datetime.hpp>
+#include <azure/core/internal/json/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <openssl/err.h>
+#include <openssl/rsa.h>
+#include <openssl/x509.h>
+
+// cspell:ignore PKCS OAEP mgf1 PUBKEY ecdsa secp
+
+using namespace Azure::Core::Json::_internal;
+using namespace Azure::Security::KeyVault::Keys::_detail;
+
+namespace {
+using Azure::Core::_internal::Base64Url;
+
+struct EvpPkeyCtxDeleter
+{
+  void operator()(EVP_PKEY_CTX* context) { EVP_PKEY_CTX_free(context); }
+};
+using EvpPkeyCtx = std::unique_ptr<EVP_PKEY_CTX, EvpPkeyCtxDeleter>;
+
+struct EvpCipherCtxDeleter
+{
+  void operator()(EVP_CIPHER_CTX* context) { EVP_CIPHER_CTX_free(context); }
+};
+using EvpCipherCtx = std::unique_ptr<EVP_CIPHER_CTX, EvpCipherCtxDeleter>;
+
+/***************** DER encoding of the public keys *****************/
+
+// Encoded OIDs (tag, length and value) used in a SubjectPublicKeyInfo.
+const std::vector<uint8_t> RsaEncryptionOid
+    = {0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01};
+const std::vector<uint8_t> EcPublicKeyOid = {0x06, 0x07, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x02, 0x01};
+const std::vector<uint8_t> P256Oid = {0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x03, 0x01, 0x07};
+const std::vector<uint8_t> P256KOid = {0x06, 0x05, 0x2b, 0x81, 0x04, 0x00, 0x0a};
+const std::vector<uint8_t> P384Oid = {0x06, 0x05, 0x2b, 0x81, 0x04, 0x00, 0x22};
+const std::vector<uint8_t> P521Oid = {0x06, 0x05, 0x2b, 0x81, 0x04, 0x00, 0x23};
+const std::vector<uint8_t> DerNull = {0x05, 0x00};
+
+constexpr uint8_t DerIntegerTag = 0x02;
+constexpr uint8_t DerBitStringTag = 0x03;
+constexpr uint8_t DerSequenceTag = 0x30;
+
+std::vector<uint8_t> DerElement(uint8_t tag, std::vector<uint8_t> const& content)
+{
+  std::vector<uint8_t> element;
+  element.reserve(content.size() + 6);
+  element.push_back(tag);
+  if (content.size() < 0x80)
+  {
+    element.push_back(static_cast<uint8_t>(content.size()));
+  }
+  else
+  {
+    uint8_t lengthSize = 0;
+    for (size_t length = content.size(); length > 0; length >>= 8)
+    {
+      ++lengthSize;
+    }
+    element.push_back(static_cast<uint8_t>(0x80 | lengthSize));
+    for (uint8_t i = lengthSize; i > 0; --i)
+    {
+      element.push_back(static_cast<uint8_t>(content.size() >> ((i - 1) * 8)));
+    }
+  }
+  element.insert(element.end(), content.begin(), content.end());
+  return element;
+}
+
+// Encodes an unsigned big-endian integer as a DER INTEGER.
+std::vector<uint8_t> DerUnsignedInteger(uint8_t const* value, size_t size)
+{
+  while (size > 1 && *value == 0)
+  {
+    ++value;
+    --size;
+  }
+  std::vector<uint8_t> content;
+  content.reserve(size + 1);
+  if (size == 0 || (*value & 0x80) != 0)
+  {
+    content.push_back(0);
+  }
+  content.insert(content.end(), value, value + size);
+  return DerElement(DerIntegerTag, content);
+}
+
+std::vector<uint8_t> DerSequence(std::vector<std::vector<uint8_t>> const& elements)
+{
+  std::vector<uint8_t> content;
+  for (auto const& element : elements)
+  {
+    content.insert(content.end(), element.begin(), element.end());
+  }
+  return DerElement(DerSequenceTag, content);
+}
+
+std::vector<uint8_t> DerBitString(std::vector<uint8_t> const& value)
+{
+  // The leading byte is the number of unused bits in the last byte.
+  std::vector<uint8_t> content;
+  content.reserve(value.size() + 1);
+  content.push_back(0);
+  content.insert(content.end(), value.begin(), value.end());
+  return DerElement(DerBitStringTag, content);
+}
+
+EVP_PKEY* ParsePublicKey(std::vector<uint8_t> const& subjectPublicKeyInfo)
+{
+  auto const* data = subjectPublicKeyInfo.data();
+  auto* publicKey
+      = d2i_PUBKEY(nullptr, &data, static_cast<long>(subjectPublicKeyInfo.size()));
+  if (publicKey == nullptr)
+  {
+    ERR_clear_error();
+  }
+  return publicKey;
+}
+
+EVP_PKEY* CreateRsaPublicKey(std::vector<uint8_t> const& n, std::vector<uint8_t> const& e)
+{
+  if (n.empty() || e.empty())
+  {
+    return nullptr;
+  }
+  auto rsaPublicKey = DerSequence(
+      {DerUnsignedInteger(n.data(), n.size()), DerUnsignedInteger(e.data(), e.size())});
+  return ParsePublicKey(
+      DerSequence({DerSequence({RsaEncryptionOid, DerNull}), DerBitString(rsaPublicKey)}));
+}
+
+// The OID and the size of a coordinate (in bytes) of a curve supported by Key Vault.
+std::pair<std::vector<uint8_t> const*, size_t> GetCurve(
+    Azure::Security::KeyVault::Keys::KeyCurveName const& curveName)
+{
+  using Azure::Security::KeyVault::Keys::KeyCurveName;
+  if (curveName == KeyCurveName::P256)
+  {
+    return {&P256Oid, 32};
+  }
+  if (curveName == KeyCurveName::P256K)
+  {
+    return {&P256KOid, 32};
+  }
+  if (curveName == KeyCurveName::P384)
+  {
+    return {&P384Oid, 48};
+  }
+  if (curveName == KeyCurveName::P521)
+  {
+    return {&P521Oid, 66};
+  }
+  return {nullptr, 0};
+}
+
+// Left-pads a big-endian coordinate to the size of the curve.
+bool AppendCoordinate(std::vector<uint8_t>& point, std::vector<uint8_t> const& value, size_t size)
+{
+  auto first = std::find_if(value.begin(), value.end(), [](uint8_t b) { return b != 0; });
+  auto significant = static_cast<size_t>(value.end() - first);
+  if (significant > size)
+  {
+    return false;
+  }
+  point.insert(point.end(), size - significant, 0);
+  point.insert(point.end(), first, value.end());
+  return true;
+}
+
+EVP_PKEY* CreateEcPublicKey(Azure::Security::KeyVault::Keys::JsonWebKey const& key)
+{
+  if (!key.CurveName.HasValue())
+  {
+    return nullptr;
+  }
+  auto curve = GetCurve(key.CurveName.Value());
+  if (curve.first == nullptr)
+  {
+    return nullptr;
+  }
+
+  // Uncompressed point: 0x04 || X || Y.
+  std::vector<uint8_t> point;
+  point.reserve(1 + curve.second * 2);
+  point.push_back(0x04);
+  if (!AppendCoordinate(point, key.X, curve.second)
+      || !AppendCoordinate(point, key.Y, curve.second))
+  {
+    return nullptr;
+  }
+  return ParsePublicKey(
+      DerSequence({DerSequence({EcPublicKeyOid, *curve.first}), DerBitString(point)}));
+}
+
+/***************** Algorithms *****************/
+
+bool IsRsaKey(Azure::Security::KeyVault::Keys::KeyVaultKeyType const& keyType)
+{
+  return keyType.ToString() == RsaValue || keyType.ToString() == RsaHsmValue;
+}
+
+bool IsEcKey(Azure::Security::KeyVault::Keys::KeyVaultKeyType const& keyType)
+{
+  return keyType.ToString() == EcValue || keyType.ToString() == EcHsmValue;
+}
+
+bool IsOctKey(Azure::Security::KeyVault::Keys::KeyVaultKeyType const& keyType)
+{
+  return keyType.ToString() == OctValue || keyType.ToString() == OctHsmValue;
+}
+
+// Gets the OpenSSL padding and OAEP digest of an RSA encryption or key wrap algorithm.
+bool GetRsaPadding(std::string const& algorithm, int& padding, EVP_MD const*& oaepDigest)
+{
+  if (algorithm == Rsa15Value)
+  {
+    padding = RSA_PKCS1_PADDING;
+    oaepDigest = nullptr;
+  }
+  else if (algorithm == RsaOaepValue)
+  {
+    padding = RSA_PKCS1_OAEP_PADDING;
+    oaepDigest = EVP_sha1();
+  }
+  else if (algorithm == RsaOaep256Value)
+  {
+    padding = RSA_PKCS1_OAEP_PADDING;
+    oaepDigest = EVP_sha256();
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+Azure::Nullable<std::vector<uint8_t>> RsaEncrypt(
+    EVP_PKEY* publicKey,
+    std::string const& algorithm,
+    std::vector<uint8_t> const& plaintext)
+{
+  int padding = 0;
+  EVP_MD const* oaepDigest = nullptr;
+  if (!GetRsaPadding(algorithm, padding, oaepDigest))
+  {
+    return {};
+  }
+
+  EvpPkeyCtx context(EVP_PKEY_CTX_new(publicKey, nullptr));
+  size_t ciphertextLength = 0;
+  if (!context || EVP_PKEY_encrypt_init(context.get()) != 1
+      || EVP_PKEY_CTX_set_rsa_padding(context.get(), padding) <= 0
+      || (oaepDigest != nullptr
+          && (EVP_PKEY_CTX_set_rsa_oaep_md(context.get(), oaepDigest) <= 0
+              || EVP_PKEY_CTX_set_rsa_mgf1_md(context.get(), oaepDigest) <= 0))
+      || EVP_PKEY_encrypt(
+             context.get(), nullptr, &ciphertextLength, plaintext.data(), plaintext.size())
+          != 1)
+  {
+    ERR_clear_error();
+    return {};
+  }
+
+  std::vector<uint8_t> ciphertext(ciphertextLength);
+  if (EVP_PKEY_encrypt(
+          context.get(), ciphertext.data(), &ciphertextLength, plaintext.data(), plaintext.size())
+      != 1)
+  {
+    // Typically a plaintext too long for the key.
+    ERR_clear_error();
+    return {};
+  }
+  ciphertext.resize(ciphertextLength);
+  return ciphertext;
+}
+
+Azure::Nullable<std::vector<uint8_t>> AesKeyWrap(
+    std::string const& algorithm,
+    std::vector<uint8_t> const& kek,
+    std::vector<uint8_t> const& key)
+{
+  EVP_CIPHER const* cipher = nullptr;
+  if (algorithm == A128KWValueValue && kek.size() == 16)
+  {
+    cipher = EVP_aes_128_wrap();
+  }
+  else if (algorithm == A192KWValueValue && kek.size() == 24)
+  {
+    cipher = EVP_aes_192_wrap();
+  }
+  else if (algorithm == A256KWValueValue && kek.size() == 32)
+  {
+    cipher = EVP_aes_256_wrap();
+  }
+  // RFC 3394 wraps at least two 64-bit blocks.
+  if (cipher == nullptr || key.size() < 16 || key.size() % 8 != 0)
+  {
+    return {};
+  }
+
+  EvpCipherCtx context(EVP_CIPHER_CTX_new());
+  std::vector<uint8_t> wrapped(key.size() + 8);
+  int updateLength = 0;
+  int finalLength = 0;
+  if (!context)
+  {
+    return {};
+  }
+  EVP_CIPHER_CTX_set_flags(context.get(), EVP_CIPHER_CTX_FLAG_WRAP_ALLOW);
+  if (EVP_EncryptInit_ex(context.get(), cipher, nullptr, kek.data(), nullptr) != 1
+      || EVP_EncryptUpdate(
+             context.get(), wrapped.data(), &updateLength, key.data(), static_cast<int>(key.size()))
+          != 1
+      || EVP_EncryptFinal_ex(context.get(), wrapped.data() + updateLength, &finalLength) != 1)
+  {
+    ERR_clear_error();
+    return {};
+  }
+  wrapped.resize(static_cast<size_t>(updateLength + finalLength));
+  return wrapped;
+}
+
+struct SignatureScheme final
+{
+  EVP_MD const* Digest;
+  // RSA_PKCS1_PADDING or RSA_PKCS1_PSS_PADDING for RSA, 0 for ECDSA.
+  int Padding;
+  // The curve an ECDSA signature is computed on.
+  char const* Curve;
+};
+
+bool GetSignatureScheme(std::string const& algorithm, SignatureScheme& scheme)
+{
+  static const struct
+  {
+    char const* Name;
+    SignatureScheme Scheme;
+  } Schemes[] = {
+      {RS256Value, {EVP_sha256(), RSA_PKCS1_PADDING, nullptr}},
+      {RS384Value, {EVP_sha384(), RSA_PKCS1_PADDING, nullptr}},
+      {RS512Value, {EVP_sha512(), RSA_PKCS1_PADDING, nullptr}},
+      {PS256Value, {EVP_sha256(), RSA_PKCS1_PSS_PADDING, nullptr}},
+      {PS384Value, {EVP_sha384(), RSA_PKCS1_PSS_PADDING, nullptr}},
+      {PS512Value, {EVP_sha512(), RSA_PKCS1_PSS_PADDING, nullptr}},
+      {ES256Value, {EVP_sha256(), 0, P256Value}},
+      {ES384Value, {EVP_sha384(), 0, P384Value}},
+      {ES512Value, {EVP_sha512(), 0, P521Value}},
+      {ES256KValue, {EVP_sha256(), 0, P256KValue}},
+  };
+  for (auto const& entry : Schemes)
+  {
+    if (algorithm == entry.Name)
+    {
+      scheme = entry.Scheme;
+      return true;
+    }
+  }
+  return false;
+}
+} // namespace
+
+namespace Azure {
+  namespace Security {
+    namespace KeyVault {
+      namespace Keys {
+        namespace Cryptography {
+
+  _detail::LocalCryptographyProvider::LocalCryptographyProvider(KeyVaultKey key)
+      : m_key(std::move(key)), m_publicKey(nullptr, EVP_PKEY_free)
+  {
+    if (IsRsaKey(m_key.Key.KeyType))
+    {
+      m_publicKey.reset(CreateRsaPublicKey(m_key.Key.N, m_key.Key.E));
+    }
+    else if (IsEcKey(m_key.Key.KeyType))
+    {
+      m_publicKey.reset(CreateEcPublicKey(m_key.Key));
+    }
+  }
+
+  KeyVaultKey _detail::LocalCryptographyProvider::KeyVaultKeyDeserialize(
+      Azure::Core::Http::RawResponse const& rawResponse)
+  {
+    auto const& body = rawResponse.GetBody();
+    auto const jsonParser = json::parse(body);
+
+    KeyVaultKey result;
+    if (jsonParser.contains("key") && jsonParser["key"].is_object())
+    {
+      auto const& key = jsonParser["key"];
+      auto const readBytes = [&key](char const* name, std::vector<uint8_t>& destination) {
+        if (key.contains(name) && key[name].is_string())
+        {
+          destination = Base64Url::Base64UrlDecode(key[name].get<std::string>());
+        }
+      };
+
+      if (key.contains(KeyIdPropertyName) && key[KeyIdPropertyName].is_string())
+      {
+        result.Key.Id = key[KeyIdPropertyName].get<std::string>();
+        KeyVaultKeySerializer::ParseKeyUrl(result.Properties, result.Key.Id);
+      }
+      if (key.contains("kty") && key["kty"].is_string())
+      {
+        result.Key.KeyType = KeyVaultKeyType(key["kty"].get<std::string>());
+      }
+      if (key.contains("crv") && key["crv"].is_string())
+      {
+        result.Key.CurveName = KeyCurveName(key["crv"].get<std::string>());
+      }
+      if (key.contains("key_ops") && key["key_ops"].is_array())
+      {
+        std::vector<KeyOperation> keyOperations;
+        for (auto const& keyOperation : key["key_ops"])
+        {
+          keyOperations.emplace_back(KeyOperation(keyOperation.get<std::string>()));
+        }
+        result.Key.SetKeyOperations(keyOperations);
+      }
+      readBytes("n", result.Key.N);
+      readBytes("e", result.Key.E);
+      readBytes("x", result.Key.X);
+      readBytes("y", result.Key.Y);
+      readBytes("k", result.Key.K);
+    }
+
+    if (jsonParser.contains("attributes") && jsonParser["attributes"].is_object())
+    {
+      auto const& attributes = jsonParser["attributes"];
+      if (attributes.contains("enabled") && attributes["enabled"].is_boolean())
+      {
+        result.Properties.Enabled = attributes["enabled"].get<bool>();
+      }
+      if (attributes.contains("nbf") && attributes["nbf"].is_number())
+      {
+        result.Properties.NotBefore = Azure::Core::_internal::PosixTimeConverter::
+            PosixTimeToDateTime(attributes["nbf"].get<int64_t>());
+      }
+      if (attributes.contains("exp") && attributes["exp"].is_number())
+      {
+        result.Properties.ExpiresOn = Azure::Core::_internal::PosixTimeConverter::
+            PosixTimeToDateTime(attributes["exp"].get<int64_t>());
+      }
+    }
+    return result;
+  }
+
+  bool _detail::LocalCryptographyProvider::IsActive() const
+  {
+    auto const& properties = m_key.Properties;
+    if (properties.Enabled.HasValue() && !properties.Enabled.Value())
+    {
+      return false;
+    }
+    auto const now = Azure::DateTime(std::chrono::system_clock::now());
+    return (!properties.NotBefore.HasValue() || properties.NotBefore.Value() <= now)
+        && (!properties.ExpiresOn.HasValue() || now < properties.ExpiresOn.Value());
+  }
+
+  Azure::Nullable<EncryptResult> _detail::LocalCryptographyProvider::Encrypt(
+      EncryptParameters const& parameters) const
+  {
+    if (!m_publicKey || !m_key.Key.SupportsOperation(KeyOperation::Encrypt) || !IsActive())
+    {
+      return {};
+    }
+
+    auto ciphertext = RsaEncrypt(
+        m_publicKey.get(), parameters.Algorithm.ToString(), parameters.Plaintext);
+    if (!ciphertext.HasValue())
+    {
+      return {};
+    }
+
+    EncryptResult result;
+    result.KeyId = m_key.Key.Id;
+    result.Ciphertext = std::move(ciphertext.Value());
+    result.Algorithm = parameters.Algorithm;
+    return result;
+  }
+
+  Azure::Nullable<WrapResult> _detail::LocalCryptographyProvider::WrapKey(
+      KeyWrapAlgorithm const& algorithm,
+      std::vector<uint8_t> const& key) const
+  {
+    if (!m_key.Key.SupportsOperation(KeyOperation::WrapKey) || !IsActive())
+    {
+      return {};
+    }
+
+    Azure::Nullable<std::vector<uint8_t>> encryptedKey;
+    if (m_publicKey)
+    {
+      encryptedKey = RsaEncrypt(m_publicKey.get(), algorithm.ToString(), key);
+    }
+    else if (IsOctKey(m_key.Key.KeyType) && !m_key.Key.K.empty())
+    {
+      // Key Vault never returns the secret of its own symmetric keys; this only applies to keys
+      // the caller already has the material for.
+      encryptedKey = AesKeyWrap(algorithm.ToString(), m_key.Key.K, key);
+    }
+    if (!encryptedKey.HasValue())
+    {
+      return {};
+    }
+
+    WrapResult result;
+    result.KeyId = m_key.Key.Id;
+    result.EncryptedKey = std::move(encryptedKey.Value());
+    result.Algorithm = algorithm;
+    return result;
+  }
+
+  Azure::Nullable<VerifyResult> _detail::LocalCryptographyProvider::Verify(
+      SignatureAlgorithm const& algorithm,
+      std::vector<uint8_t> const& digest,
+      std::vector<uint8_t> const& signature) const
+  {
+    // Like the service, verification doesn't depend on the validity window of the key.
+    SignatureScheme scheme{};
+    if (!m_publicKey || !m_key.Key.SupportsOperation(KeyOperation::Verify)
+        || !GetSignatureScheme(algorithm.ToString(), scheme)
+        || digest.size() != static_cast<size_t>(EVP_MD_size(scheme.Digest)))
+    {
+      return {};
+    }
+
+    std::vector<uint8_t> derSignature;
+    if (scheme.Curve == nullptr)
+    {
+      if (!IsRsaKey(m_key.Key.KeyType))
+      {
+        return {};
+      }
+      derSignature = signature;
+    }
+    else
+    {
+      if (!IsEcKey(m_key.Key.KeyType) || !m_key.Key.CurveName.HasValue()
+          || m_key.Key.CurveName.Value().ToString() != scheme.Curve)
+      {
+        return {};
+      }
+      // Key Vault signatures are R || S; OpenSSL expects the DER encoded ECDSA-Sig-Value.
+      auto const coordinateSize = GetCurve(m_key.Key.CurveName.Value()).second;
+      if (signature.size() != coordinateSize * 2)
+      {
+        return {};
+      }
+      derSignature = DerSequence(
+          {DerUnsignedInteger(signature.data(), coordinateSize),
+           DerUnsignedInteger(signature.data() + coordinateSize, coordinateSize)});
+    }
+
+    EvpPkeyCtx context(EVP_PKEY_CTX_new(m_publicKey.get(), nullptr));
+    if (!context || EVP_PKEY_verify_init(context.get()) != 1
+        || EVP_PKEY_CTX_set_signature_md(context.get(), scheme.Digest) <= 0
+        || (scheme.Padding != 0
+            && EVP_PKEY_CTX_set_rsa_padding(context.get(), scheme.Padding) <= 0)
+        || (scheme.Padding == RSA_PKCS1_PSS_PADDING
+            && EVP_PKEY_CTX_set_rsa_pss_saltlen(context.get(), RSA_PSS_SALTLEN_DIGEST) <= 0))
+    {
+      ERR_clear_error();
+      return {};
+    }
+
+    auto const verified = EVP_PKEY_verify(
+        context.get(), derSignature.data(), derSignature.size(), digest.data(), digest.size());
+    ERR_clear_error();
+
+    VerifyResult result;
+    result.KeyId = m_key.Key.Id;
+    result.IsValid = verified == 1;
+    result.Algorithm = algorithm;
+    return result;
+  }
+}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography
@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Performs the public-key cryptography operations in-process.
+ *
+ */
+
+#pragma once
+
+#include "azure/keyvault/keys/cryptography/cryptography_client_models.hpp"
+#include "azure/keyvault/keys/key_client_models.hpp"
+
+#include <azure/core/http/raw_response.hpp>
+#include <azure/core/nullable.hpp>
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <openssl/evp.h>
+
+namespace Azure {
+  namespace Security {
+    namespace KeyVault {
+      namespace Keys {
+        namespace Cryptography {
+  namespace _detail {
+
+    /**
+     * @brief Runs Encrypt, WrapKey and Verify against a key fetched from Key Vault without a
+     * round trip to the service.
+     *
+     * @remark Every operation returns a null value when the key, its permitted operations, its
+     * validity window or the requested algorithm can't be served locally. The caller then sends
+     * the operation to the service, which reports the error (if any) the same way it always did.
+     */
+    class LocalCryptographyProvider final {
+      KeyVaultKey m_key;
+      std::unique_ptr<EVP_PKEY, void (*)(EVP_PKEY*)> m_publicKey;
+
+      bool IsActive() const;
+
+    public:
+      /**
+       * @brief Creates a provider for the key material and attributes in \p key.
+       *
+       * @param key The key as returned by Key Vault. Only the public part of the key is used.
+       */
+      explicit LocalCryptographyProvider(KeyVaultKey key);
+
+      /**
+       * @brief Parses the response of a Get Key request.
+       *
+       */
+      static KeyVaultKey KeyVaultKeyDeserialize(Azure::Core::Http::RawResponse const& rawResponse);
+
+      /**
+       * @brief The versioned identifier of the key that the provider uses.
+       *
+       */
+      std::string const& GetKeyId() const { return m_key.Key.Id; }
+
+      Azure::Nullable<EncryptResult> Encrypt(EncryptParameters const& parameters) const;
+
+      Azure::Nullable<WrapResult> WrapKey(
+          KeyWrapAlgorithm const& algorithm,
+          std::vector<uint8_t> const& key) const;
+
+      Azure::Nullable<VerifyResult> Verify(
+          SignatureAlgorithm const& algorithm,
+          std::vector<uint8_t> const& digest,
+          std::vector<uint8_t> const& signature) const;
+    };
+
+    /**
+     * @brief The key fetched by a #CryptographyClient with local cryptography enabled, shared by
+     * the copies of that client.
+     *
+     */
+    struct LocalKeyCache final
+    {
+      /**
+       * @brief How long the fetched key is used before it is fetched again.
+       *
+       */
+      std::chrono::steady_clock::duration RefreshInterval;
+
+      /**
+       * @brief Guards #Provider and #RefreshOn.
+       *
+       */
+      std::mutex Mutex;
+
+      /**
+       * @brief The provider for the last fetched key, or null when the key couldn't be fetched.
+       *
+       */
+      std::shared_ptr<LocalCryptographyProvider const> Provider;
+
+      /**
+       * @brief When the key should be fetched again. The default value makes the first operation
+       * fetch it.
+       *
+       */
+      std::chrono::steady_clock::time_point RefreshOn;
+
+      /**
+       * @brief Held by the one caller fetching the key.
+       *
+       */
+      std::mutex RefreshMutex;
+
+      explicit LocalKeyCache(std::chrono::steady_clock::duration refreshInterval)
+          : RefreshInterval(refreshInterval)
+      {
+      }
+    };
+
+}}}}}} // namespace Azure::Security::KeyVault::Keys::Cryptography::_detail
@@ -706,6 +706,14 @@ namespace Azure { namespace Storage { namespace Blobs {
        * @brief The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief Write the downloaded data to the file without going through the OS file cache,
+       * where the platform and file system support it. This saves a copy of every byte for large
+       * downloads that won't be read back soon. Ranges of the file which aren't aligned to 4 KiB
+       * are still written through the cache.
+       */
+      bool UseUnbufferedFileWrites = false;
     } TransferOptions;
   };
 
@@ -937,6 +945,15 @@ namespace Azure { namespace Storage { namespace Blobs {
        * @brief The maximum number of threads that may be used in a parallel transfer.
        */
       int32_t Concurrency = 5;
+
+      /**
+       * @brief Read the file through a read-only memory mapping instead of copying each block
+       * into a buffer first. Only use this for files which aren't modified during the upload: if
+       * the file is truncated while it is mapped, reading it terminates the process with SIGBUS on
+       * POSIX platforms, instead of failing the upload. Only used by the UploadFrom overload that
+       * takes a file name.
+       */
+      bool UseMemoryMappedFile = false;
     } TransferOptions;
 
     /**
@@ -415,7 +415,8 @@ namespace Azure { namespace Storage { namespace Blobs {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        context);
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = blobRangeSize;
     return ret;
@@ -468,22 +469,28 @@ namespace Azure { namespace Storage { namespace Blobs {
                                int64_t length,
                                const Azure::Core::Context& context) {
       constexpr size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
+      // Over-allocate so that the buffer can be aligned for unbuffered writes.
+      std::vector<uint8_t> bufferStorage(bufferSize + _internal::UnbufferedFileIoAlignment);
+      uint8_t* buffer = bufferStorage.data()
+          + (_internal::UnbufferedFileIoAlignment
+             - reinterpret_cast<uintptr_t>(bufferStorage.data())
+                 % _internal::UnbufferedFileIoAlignment)
+              % _internal::UnbufferedFileIoAlignment;
       while (length > 0)
       {
         size_t readSize = static_cast<size_t>(std::min<int64_t>(bufferSize, length));
-        size_t bytesRead = stream.ReadToCount(buffer.data(), readSize, context);
+        size_t bytesRead = stream.ReadToCount(buffer, readSize, context);
         if (bytesRead != readSize)
         {
           throw Azure::Core::RequestFailedException("Error when reading body stream.");
         }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
+        fileWriter.Write(buffer, bytesRead, offset);
         length -= bytesRead;
         offset += bytesRead;
       }
     };
 
-    _internal::FileWriter fileWriter(fileName);
+    _internal::FileWriter fileWriter(fileName, options.TransferOptions.UseUnbufferedFileWrites);
     bodyStreamToFile(*(firstChunk.Value.BodyStream), fileWriter, 0, firstChunkLength, context);
     firstChunk.Value.BodyStream.reset();
 
@@ -530,7 +537,8 @@ namespace Azure { namespace Storage { namespace Blobs {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        context);
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = blobRangeSize;
     return ret;
@@ -210,7 +210,7 @@ namespace Azure { namespace Storage { namespace Blobs {
     };
 
     _internal::ConcurrentTransfer(
-        0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadBlockFunc);
+        0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadBlockFunc, context);
 
     for (size_t i = 0; i < blockIds.size(); ++i)
     {
@@ -271,13 +271,23 @@ namespace Azure { namespace Storage { namespace Blobs {
           std::vector<uint8_t>(blockId.begin(), blockId.end()));
     };
 
-    _internal::FileReader fileReader(fileName);
+    _internal::FileReader fileReader(fileName, options.TransferOptions.UseMemoryMappedFile);
 
     auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-      Azure::Core::IO::_internal::RandomAccessFileBodyStream contentStream(
-          fileReader.GetHandle(), offset, length);
       StageBlockOptions chunkOptions;
-      auto blockInfo = StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
+      if (fileReader.GetMappedData())
+      {
+        // Read the block straight out of the file mapping, without an intermediate buffer.
+        Azure::Core::IO::MemoryBodyStream contentStream(
+            fileReader.GetMappedData() + offset, static_cast<size_t>(length));
+        StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
+      }
+      else
+      {
+        Azure::Core::IO::_internal::RandomAccessFileBodyStream contentStream(
+            fileReader.GetHandle(), offset, length);
+        StageBlock(getBlockId(chunkId), contentStream, chunkOptions, context);
+      }
       if (chunkId == numChunks - 1)
       {
         blockIds.resize(static_cast<size_t>(numChunks));
@@ -305,7 +315,8 @@ namespace Azure { namespace Storage { namespace Blobs {
         fileReader.GetFileSize(),
         chunkSize,
         options.TransferOptions.Concurrency,
-        uploadBlockFunc);
+        uploadBlockFunc,
+        context);
 
     for (size_t i = 0; i < blockIds.size(); ++i)
     {
@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Test the performance of the CRC64 implementations used for transactional checksums.
+ *
+ */
+
+#pragma once
+
+#include <azure/perf.hpp>
+#include <azure/perf/random_stream.hpp>
+#include <azure/storage/common/crypt.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief A test to measure computing the CRC64 of a buffer with a given kernel.
+   *
+   */
+  class Crc64 : public Azure::Perf::PerfTest {
+  private:
+    std::vector<uint8_t> m_buffer;
+    _internal::Crc64Kernel m_kernel = _internal::Crc64Kernel::Auto;
+
+  public:
+    /**
+     * @brief Construct a new Crc64 test.
+     *
+     * @param options The test options.
+     */
+    Crc64(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Creates the buffer to hash and selects the kernel.
+     *
+     */
+    void Setup() override
+    {
+      long size = m_options.GetMandatoryOption<long>("Size");
+      m_buffer = Azure::Perf::RandomStream::Create(size)->ReadToEnd(Azure::Core::Context{});
+
+      const std::string kernel = m_options.GetOptionOrDefault<std::string>("Kernel", "auto");
+      if (kernel == "auto")
+      {
+        m_kernel = _internal::Crc64Kernel::Auto;
+      }
+      else if (kernel == "table")
+      {
+        m_kernel = _internal::Crc64Kernel::Table;
+      }
+      else if (kernel == "pclmul")
+      {
+        m_kernel = _internal::Crc64Kernel::Pclmul;
+      }
+      else if (kernel == "vpclmul")
+      {
+        m_kernel = _internal::Crc64Kernel::Vpclmul;
+      }
+      else if (kernel == "pmull")
+      {
+        m_kernel = _internal::Crc64Kernel::Pmull;
+      }
+      else
+      {
+        throw std::invalid_argument("Unknown CRC64 kernel: " + kernel);
+      }
+      if (!_internal::IsCrc64KernelSupported(m_kernel))
+      {
+        throw std::runtime_error("CRC64 kernel " + kernel + " is not supported on this CPU.");
+      }
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const&) override
+    {
+      _internal::Crc64Append(m_kernel, 0, m_buffer.data(), m_buffer.size());
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"Size", {"--size", "-s"}, "Size of payload (in bytes)", 1, true},
+          {"Kernel",
+           {"--kernel"},
+           "CRC64 implementation: auto, table, pclmul, vpclmul or pmull. Defaults to auto.",
+           1,
+           false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {"Crc64", "Compute the CRC64 of a buffer.", [](Azure::Perf::TestOptions options) {
+                return std::make_unique<Azure::Storage::Blobs::Test::Crc64>(options);
+              }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
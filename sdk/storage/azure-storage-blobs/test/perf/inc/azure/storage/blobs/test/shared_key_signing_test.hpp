@@ -0,0 +1,126 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @file
+ * @brief Test the performance of signing requests with a storage account key.
+ *
+ */
+
+#pragma once
+
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/perf.hpp>
+#include <azure/storage/common/internal/shared_key_policy.hpp>
+#include <azure/storage/common/storage_credential.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs { namespace Test {
+
+  /**
+   * @brief A test to measure signing a small blob upload with SharedKey authorization, without
+   * sending it.
+   *
+   */
+  class SharedKeySigning : public Azure::Perf::PerfTest {
+  private:
+    class NoOpTransportPolicy final : public Azure::Core::Http::Policies::HttpPolicy {
+    public:
+      std::unique_ptr<Azure::Core::Http::RawResponse> Send(
+          Azure::Core::Http::Request&,
+          Azure::Core::Http::Policies::NextHttpPolicy,
+          Azure::Core::Context const&) const override
+      {
+        return nullptr;
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<NoOpTransportPolicy>(*this);
+      }
+    };
+
+    std::unique_ptr<Azure::Core::Http::_internal::HttpPipeline> m_pipeline;
+    std::unique_ptr<Azure::Core::Http::Request> m_request;
+
+  public:
+    /**
+     * @brief Construct a new SharedKeySigning test.
+     *
+     * @param options The test options.
+     */
+    SharedKeySigning(Azure::Perf::TestOptions options) : PerfTest(options) {}
+
+    /**
+     * @brief Creates the pipeline and the request to sign.
+     *
+     */
+    void Setup() override
+    {
+      auto credential = std::make_shared<StorageSharedKeyCredential>(
+          "account", "MDEyMzQ1Njc4OWFiY2RlZjAxMjM0NTY3ODlhYmNkZWY=");
+      std::vector<std::unique_ptr<Azure::Core::Http::Policies::HttpPolicy>> policies;
+      policies.emplace_back(std::make_unique<_internal::SharedKeyPolicy>(credential));
+      policies.emplace_back(std::make_unique<NoOpTransportPolicy>());
+      m_pipeline = std::make_unique<Azure::Core::Http::_internal::HttpPipeline>(policies);
+
+      m_request = std::make_unique<Azure::Core::Http::Request>(
+          Azure::Core::Http::HttpMethod::Put,
+          Azure::Core::Url("https://account.blob.core.windows.net/container/blob"));
+      m_request->SetHeader("Content-Length", "1024");
+      m_request->SetHeader("Content-Type", "application/octet-stream");
+      m_request->SetHeader("x-ms-blob-type", "BlockBlob");
+      m_request->SetHeader("x-ms-client-request-id", "00000000-0000-0000-0000-000000000000");
+      m_request->SetHeader("x-ms-date", "Thu, 01 Jan 2026 00:00:00 GMT");
+      m_request->SetHeader("x-ms-version", "2025-01-05");
+      auto const metadataCount = m_options.GetOptionOrDefault<int>("MetadataCount", 0);
+      for (int i = 0; i < metadataCount; ++i)
+      {
+        m_request->SetHeader("x-ms-meta-key" + std::to_string(i), "value");
+      }
+    }
+
+    /**
+     * @brief Define the test
+     *
+     */
+    void Run(Azure::Core::Context const& context) override
+    {
+      m_pipeline->Send(*m_request, context);
+    }
+
+    /**
+     * @brief Define the test options for the test.
+     *
+     * @return The list of test options.
+     */
+    std::vector<Azure::Perf::TestOption> GetTestOptions() override
+    {
+      return {
+          {"MetadataCount",
+           {"--metadata-count"},
+           "Number of metadata headers to sign. Defaults to 0.",
+           1,
+           false}};
+    }
+
+    /**
+     * @brief Get the static Test Metadata for the test.
+     *
+     * @return Azure::Perf::TestMetadata describing the test.
+     */
+    static Azure::Perf::TestMetadata GetTestMetadata()
+    {
+      return {
+          "SharedKeySigning",
+          "Sign a blob upload request with a storage account key.",
+          [](Azure::Perf::TestOptions options) {
+            return std::make_unique<Azure::Storage::Blobs::Test::SharedKeySigning>(options);
+          }};
+    }
+  };
+
+}}}} // namespace Azure::Storage::Blobs::Test
@@ -7,6 +7,7 @@
 #include <azure/core/cryptography/hash.hpp>
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,9 +39,58 @@ namespace Azure { namespace Storage {
   };
 
   namespace _internal {
+    /**
+     * @brief The implementations of CRC64. #Azure::Storage::Crc64Hash picks the fastest one the
+     * CPU supports; the others are exposed for tests and benchmarks.
+     */
+    enum class Crc64Kernel
+    {
+      Auto,
+      Table,
+      Pclmul,
+      Vpclmul,
+      Pmull,
+    };
+
+    /**
+     * @brief Returns whether \p kernel can be used on this CPU.
+     */
+    bool IsCrc64KernelSupported(Crc64Kernel kernel);
+
+    /**
+     * @brief Appends \p data to the CRC64 \p crc using \p kernel and returns the new CRC64. The
+     * CRC64 of an empty input is 0.
+     */
+    uint64_t Crc64Append(Crc64Kernel kernel, uint64_t crc, const uint8_t* data, size_t length);
+
     std::vector<uint8_t> HmacSha256(
         const std::vector<uint8_t>& data,
         const std::vector<uint8_t>& key);
+
+    /**
+     * @brief Computes HMAC-SHA256 with a fixed key. The inner and outer hash states of the key are
+     * computed once, so that signing a message only hashes the message.
+     */
+    class HmacSha256Signer final {
+    public:
+      /**
+       * @brief Prepares the hash states of \p key.
+       */
+      explicit HmacSha256Signer(const std::vector<uint8_t>& key);
+      ~HmacSha256Signer();
+
+      HmacSha256Signer(const HmacSha256Signer&) = delete;
+      HmacSha256Signer& operator=(const HmacSha256Signer&) = delete;
+
+      /**
+       * @brief Returns the HMAC-SHA256 of \p data. Can be called from several threads at once.
+       */
+      std::vector<uint8_t> Sign(const uint8_t* data, size_t length) const;
+
+    private:
+      struct Impl;
+      std::unique_ptr<Impl> m_impl;
+    };
     std::string UrlEncodeQueryParameter(const std::string& value);
     std::string UrlEncodePath(const std::string& value);
   } // namespace _internal
@@ -3,66 +3,41 @@
 
 #pragma once
 
-#include <algorithm>
-#include <atomic>
-#include <cstdlib>
+#include <azure/core/context.hpp>
+
+#include <cstdint>
 #include <functional>
-#include <future>
-#include <stdexcept>
-#include <vector>
 
 namespace Azure { namespace Storage { namespace _internal {
 
-  inline void ConcurrentTransfer(
+  /**
+   * @brief Transfers [offset, offset + length) in chunks of chunkSize, running up to concurrency
+   * chunks at a time.
+   *
+   * @details The calling thread always takes part in the transfer. Additional chunks are run on a
+   * worker pool shared by all transfers in the process, so the total number of transfer threads
+   * stays bounded no matter how many transfers run in parallel. Workers hand out one chunk at a
+   * time and rotate between the transfers that are waiting, so a large transfer doesn't starve the
+   * others. This function returns only after every chunk that was started has completed.
+   *
+   * @param offset Offset of the first byte to transfer.
+   * @param length Number of bytes to transfer.
+   * @param chunkSize Maximum size of a chunk.
+   * @param concurrency Maximum number of chunks of this transfer that run at the same time.
+   * @param transferFunc Transfers one chunk. Its parameters are the chunk offset, the chunk length,
+   * the chunk ID and the number of chunks.
+   * @param context A context to cancel the remaining chunks.
+   *
+   * @throw The first exception thrown by transferFunc, or
+   * Azure::Core::OperationCancelledException if context is cancelled.
+   */
+  void ConcurrentTransfer(
       int64_t offset,
       int64_t length,
       int64_t chunkSize,
       int concurrency,
       // offset, length, chunk ID, number of chunks
-      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc)
-  {
-    std::atomic<int> numWorkingThreads{concurrency};
-    std::atomic<int> nextChunkId{0};
-    std::atomic<bool> failed{false};
-
-    const auto numChunks = (length + chunkSize - 1) / chunkSize;
-
-    auto threadFunc = [&]() {
-      while (true)
-      {
-        int chunkId = nextChunkId.fetch_add(1);
-        if (chunkId >= numChunks || failed)
-        {
-          break;
-        }
-        int64_t chunkOffset = offset + chunkSize * chunkId;
-        int64_t chunkLength = (std::min)(length - chunkSize * chunkId, chunkSize);
-        try
-        {
-          transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
-        }
-        catch (const std::exception&)
-        {
-          if (failed.exchange(true) == false)
-          {
-            numWorkingThreads.fetch_sub(1);
-            throw;
-          }
-        }
-      }
-      numWorkingThreads.fetch_sub(1);
-    };
-
-    std::vector<std::future<void>> threadHandles;
-    for (int i = 0; i < std::min<int64_t>(concurrency, numChunks) - 1; ++i)
-    {
-      threadHandles.emplace_back(std::async(std::launch::async, threadFunc));
-    }
-    threadFunc();
-    for (auto& handle : threadHandles)
-    {
-      handle.get();
-    }
-  }
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      const Azure::Core::Context& context = Azure::Core::Context());
 
 }}} // namespace Azure::Storage::_internal
@@ -5,6 +5,7 @@
 
 #include <azure/core/platform.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -16,9 +17,21 @@ namespace Azure { namespace Storage { namespace _internal {
   using FileHandle = int;
 #endif
 
+  /**
+   * @brief Buffers, file offsets and lengths must be aligned to this many bytes to be written
+   * without going through the OS file cache.
+   */
+  constexpr size_t UnbufferedFileIoAlignment = 4096;
+
   class FileReader final {
   public:
-    FileReader(const std::string& filename);
+    /**
+     * @param filename Name of the file to open.
+     * @param mapFile Whether to also map the file read-only into memory, see #GetMappedData. Only
+     * map files which aren't truncated while they are read: on POSIX, reading a mapped page past
+     * the new end of the file raises SIGBUS instead of failing the read.
+     */
+    FileReader(const std::string& filename, bool mapFile = false);
 
     ~FileReader();
 
@@ -26,14 +39,30 @@ namespace Azure { namespace Storage { namespace _internal {
 
     int64_t GetFileSize() const { return m_fileSize; }
 
+    /**
+     * @brief Returns a read-only view of the whole file, or nullptr if mapping wasn't requested or
+     * the file couldn't be mapped into memory. In that case, read the file through #GetHandle.
+     */
+    const uint8_t* GetMappedData() const { return m_mappedData; }
+
   private:
     FileHandle m_handle;
     int64_t m_fileSize;
+    const uint8_t* m_mappedData = nullptr;
+#if defined(AZ_PLATFORM_WINDOWS)
+    void* m_mappingHandle = nullptr;
+#endif
   };
 
   class FileWriter final {
   public:
-    FileWriter(const std::string& filename);
+    /**
+     * @param filename Name of the file to create or truncate.
+     * @param unbuffered Whether to write aligned ranges without going through the OS file cache,
+     * where the platform and file system support it. Ranges which aren't aligned to
+     * #UnbufferedFileIoAlignment are written through the file cache.
+     */
+    FileWriter(const std::string& filename, bool unbuffered = false);
 
     ~FileWriter();
 
@@ -43,6 +72,9 @@ namespace Azure { namespace Storage { namespace _internal {
 
   private:
     FileHandle m_handle;
+    // A second handle to the same file, opened for unbuffered writes, if requested and supported.
+    FileHandle m_unbufferedHandle{};
+    bool m_hasUnbufferedHandle = false;
   };
 
 }}} // namespace Azure::Storage::_internal
@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "azure/storage/common/internal/xml_wrapper.hpp"
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  /**
+   * @brief A view of characters owned by an XmlPullParser.
+   *
+   * @details The view converts to `std::string` and compares with strings, so code written for
+   * the `std::string` members of XmlNode works with it unchanged.
+   */
+  class XmlStringView final {
+  public:
+    XmlStringView() = default;
+    XmlStringView(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    const char* Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+    bool Empty() const { return m_size == 0; }
+
+    std::string ToString() const { return std::string(m_data, m_size); }
+    operator std::string() const { return ToString(); }
+
+    friend bool operator==(XmlStringView lhs, XmlStringView rhs)
+    {
+      return lhs.m_size == rhs.m_size
+          && (lhs.m_size == 0 || std::memcmp(lhs.m_data, rhs.m_data, lhs.m_size) == 0);
+    }
+    friend bool operator==(XmlStringView lhs, const std::string& rhs)
+    {
+      return lhs == XmlStringView(rhs.data(), rhs.size());
+    }
+    friend bool operator==(XmlStringView lhs, const char* rhs)
+    {
+      return lhs == XmlStringView(rhs, std::strlen(rhs));
+    }
+    template <class T> friend bool operator!=(XmlStringView lhs, const T& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+  };
+
+  /**
+   * @brief A node read by an XmlPullParser. #Name and #Value are valid until the next read.
+   */
+  struct XmlToken final
+  {
+    XmlNodeType Type = XmlNodeType::End;
+    XmlStringView Name;
+    XmlStringView Value;
+  };
+
+  /**
+   * @brief Reads an XML document node by node without copying names and values.
+   *
+   * @details Nodes are returned in the same order as XmlReader returns them: a start tag is
+   * followed by its attributes, an empty element is returned as a start tag and an end tag, and
+   * text that is only whitespace is skipped. Text and attribute values are returned with the
+   * entity and character references replaced.
+   *
+   * Only UTF-8 documents are accepted, and the parser rejects documents which are not
+   * well-formed. Document type declarations are skipped, so entities they declare are not
+   * supported.
+   */
+  class XmlPullParser final {
+  public:
+    /**
+     * @brief Reads a document that is in memory. The data must outlive the parser.
+     *
+     * @throw std::runtime_error if the document is not UTF-8 or contains characters which are
+     * not allowed in XML.
+     */
+    explicit XmlPullParser(const char* data, size_t length);
+
+    XmlPullParser(const XmlPullParser& other) = delete;
+    XmlPullParser& operator=(const XmlPullParser& other) = delete;
+
+    /**
+     * @brief Reads the next node.
+     *
+     * @throw std::runtime_error if the document is not well-formed.
+     */
+    XmlToken Read();
+
+  private:
+    enum class State
+    {
+      Content,
+      Attributes,
+    };
+
+    const char* m_data;
+    size_t m_position = 0;
+    size_t m_size;
+
+    State m_state = State::Content;
+    bool m_rootRead = false;
+    bool m_documentTypeRead = false;
+    // The names of the open elements, and the attribute names of the element being read.
+    std::vector<XmlStringView> m_openElements;
+    std::vector<XmlStringView> m_attributeNames;
+    // Text and attribute values that contain references are decoded here.
+    std::string m_decoded;
+
+    // Each of these returns false if what it read produces no node.
+    bool ReadNode(XmlToken* token);
+    bool ReadMarkup(XmlToken* token);
+    bool ReadAttribute(XmlToken* token);
+    XmlStringView Decode(const char* begin, const char* end, bool isAttribute);
+  };
+
+}}} // namespace Azure::Storage::_internal
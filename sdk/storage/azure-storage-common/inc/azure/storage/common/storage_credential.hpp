@@ -20,8 +20,9 @@ namespace Azure { namespace Storage {
   } // namespace Sas
 
   namespace _internal {
+    class HmacSha256Signer;
     class SharedKeyPolicy;
-  }
+  } // namespace _internal
 
   /**
    * @brief A StorageSharedKeyCredential is a credential backed by a storage account's name and
@@ -51,6 +52,7 @@ namespace Azure { namespace Storage {
     {
       std::lock_guard<std::mutex> guard(m_mutex);
       m_accountKey = std::move(accountKey);
+      m_signer.reset();
     }
 
     /**
@@ -71,8 +73,13 @@ namespace Azure { namespace Storage {
       return m_accountKey;
     }
 
+    // Gets the HMAC-SHA256 signer of the account key, which is created on first use and reused
+    // until the key is updated.
+    std::shared_ptr<const _internal::HmacSha256Signer> GetSigner() const;
+
     mutable std::mutex m_mutex;
     std::string m_accountKey;
+    mutable std::shared_ptr<const _internal::HmacSha256Signer> m_signer;
   };
 
   namespace _internal {
@@ -0,0 +1,201 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/storage/common/internal/concurrent_transfer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace {
+
+    /**
+     * @brief A process-wide pool of threads which run the chunks of all concurrent transfers.
+     *
+     * @details Threads are started on demand, up to a fixed maximum, and live until the process
+     * exits. Tasks are run in FIFO order.
+     */
+    class TransferWorkerPool final {
+    public:
+      static TransferWorkerPool& GetInstance()
+      {
+        // The pool is never destroyed. Joining its workers during static destruction could hang
+        // on a worker blocked in I/O, or deadlock under the loader lock when the DLL is unloaded
+        // on Windows. The idle workers end with the process.
+        static TransferWorkerPool* pool = new TransferWorkerPool();
+        return *pool;
+      }
+
+      void Submit(std::function<void()> task)
+      {
+        {
+          std::lock_guard<std::mutex> guard(m_mutex);
+          m_tasks.push_back(std::move(task));
+          if (m_idleWorkers < m_tasks.size() && m_workers.size() < m_maxWorkers)
+          {
+            m_workers.emplace_back([this]() { WorkerLoop(); });
+          }
+        }
+        m_taskReady.notify_one();
+      }
+
+    private:
+      TransferWorkerPool()
+          : m_maxWorkers((std::max)(16U, std::thread::hardware_concurrency() * 4U))
+      {
+      }
+
+      void WorkerLoop()
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+          ++m_idleWorkers;
+          m_taskReady.wait(lock, [this]() { return !m_tasks.empty(); });
+          --m_idleWorkers;
+          auto task = std::move(m_tasks.front());
+          m_tasks.pop_front();
+
+          lock.unlock();
+          task();
+          lock.lock();
+        }
+      }
+
+      // Storage transfers are I/O bound, so allow more threads than there are cores.
+      const size_t m_maxWorkers;
+
+      std::mutex m_mutex;
+      std::condition_variable m_taskReady;
+      std::deque<std::function<void()>> m_tasks;
+      std::vector<std::thread> m_workers;
+      size_t m_idleWorkers = 0;
+    };
+
+    struct TransferState final
+    {
+      int64_t Offset;
+      int64_t Length;
+      int64_t ChunkSize;
+      int64_t NumChunks;
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> TransferFunc;
+      Azure::Core::Context Context;
+
+      std::atomic<int64_t> NextChunkId{0};
+      std::atomic<bool> Failed{false};
+
+      // Guards the fields below.
+      std::mutex Mutex;
+      std::condition_variable HelperDone;
+      int ActiveHelpers = 0;
+      bool Finished = false;
+      std::exception_ptr Error;
+    };
+
+    // Runs the next chunk of the transfer. Returns false once there is no chunk left to run.
+    bool RunNextChunk(TransferState& state)
+    {
+      if (state.Failed)
+      {
+        return false;
+      }
+      const int64_t chunkId = state.NextChunkId.fetch_add(1);
+      if (chunkId >= state.NumChunks)
+      {
+        return false;
+      }
+      try
+      {
+        state.Context.ThrowIfCancelled();
+        const int64_t chunkOffset = state.Offset + state.ChunkSize * chunkId;
+        const int64_t chunkLength
+            = (std::min)(state.Length - state.ChunkSize * chunkId, state.ChunkSize);
+        state.TransferFunc(chunkOffset, chunkLength, chunkId, state.NumChunks);
+      }
+      catch (...)
+      {
+        if (state.Failed.exchange(true) == false)
+        {
+          std::lock_guard<std::mutex> guard(state.Mutex);
+          state.Error = std::current_exception();
+        }
+        return false;
+      }
+      return true;
+    }
+
+    // Runs a single chunk on a pool thread, then queues itself again behind the chunks of the
+    // other transfers.
+    void RunHelper(std::shared_ptr<TransferState> state)
+    {
+      {
+        std::lock_guard<std::mutex> guard(state->Mutex);
+        if (state->Finished)
+        {
+          return;
+        }
+        ++state->ActiveHelpers;
+      }
+      const bool hasMoreChunks = RunNextChunk(*state);
+      {
+        std::lock_guard<std::mutex> guard(state->Mutex);
+        --state->ActiveHelpers;
+      }
+      state->HelperDone.notify_all();
+
+      if (hasMoreChunks)
+      {
+        TransferWorkerPool::GetInstance().Submit([state]() { RunHelper(state); });
+      }
+    }
+  } // namespace
+
+  void ConcurrentTransfer(
+      int64_t offset,
+      int64_t length,
+      int64_t chunkSize,
+      int concurrency,
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      const Azure::Core::Context& context)
+  {
+    auto state = std::make_shared<TransferState>();
+    state->Offset = offset;
+    state->Length = length;
+    state->ChunkSize = chunkSize;
+    state->NumChunks = (length + chunkSize - 1) / chunkSize;
+    state->TransferFunc = std::move(transferFunc);
+    state->Context = context;
+
+    const int64_t numHelpers = std::min<int64_t>(concurrency, state->NumChunks) - 1;
+    for (int64_t i = 0; i < numHelpers; ++i)
+    {
+      TransferWorkerPool::GetInstance().Submit([state]() { RunHelper(state); });
+    }
+
+    while (RunNextChunk(*state))
+    {
+    }
+
+    {
+      // transferFunc usually references the caller's stack, so wait for every chunk in flight and
+      // make sure that no queued helper starts another one.
+      std::unique_lock<std::mutex> lock(state->Mutex);
+      state->HelperDone.wait(lock, [&state]() { return state->ActiveHelpers == 0; });
+      state->Finished = true;
+    }
+
+    if (state->Error)
+    {
+      std::rethrow_exception(state->Error);
+    }
+  }
+
+}}} // namespace Azure::Storage::_internal
@@ -0,0 +1,358 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+// CRC64 folding kernels based on carry-less multiplication, see "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction" by Intel. The kernels are compiled for their target
+// instruction sets individually and are only called after checking that the CPU supports them.
+
+#include "private/crc64_clmul.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define AZ_STORAGE_CRC64_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define AZ_STORAGE_CRC64_TARGET(features)
+#if _MSC_VER >= 1920
+#define AZ_STORAGE_CRC64_VPCLMUL
+#endif
+#else
+#include <cpuid.h>
+#include <immintrin.h>
+#define AZ_STORAGE_CRC64_TARGET(features) __attribute__((target(features)))
+#if (defined(__clang__) && __clang_major__ >= 6) || (!defined(__clang__) && __GNUC__ >= 8)
+#define AZ_STORAGE_CRC64_VPCLMUL
+#endif
+#endif
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+// PMULL is part of the crypto extension. It is only used when the compiler targets CPUs which
+// have it, so it doesn't need to be detected at runtime.
+#define AZ_STORAGE_CRC64_PMULL
+#include <arm_neon.h>
+#endif
+
+namespace Azure { namespace Storage { namespace _detail {
+
+  namespace {
+    constexpr uint64_t Crc64Poly = 0x9A6C9329AC4BC9B5ULL;
+
+    // Computes x^n mod P in the bit-reflected representation that CRC64 uses, where bit 63 is the
+    // coefficient of x^0.
+    constexpr uint64_t XPowModP(uint32_t n)
+    {
+      uint64_t value = 1ULL << 63;
+      for (uint32_t i = 0; i < n; ++i)
+      {
+        value = (value >> 1) ^ ((value & 1) ? Crc64Poly : 0);
+      }
+      return value;
+    }
+
+    /*
+     * Folding a 128-bit remainder A = H * x^64 + L forward by D bits is
+     *   A * x^D = H * x^(D + 64) + L * x^D = H * (x^(D + 64) mod P) + L * (x^D mod P) (mod P).
+     * A carry-less multiplication of two bit-reflected operands yields the reflected product
+     * multiplied by x, so the constants are computed with one power of x less.
+     */
+    template <uint32_t Distance> struct FoldConstants final
+    {
+      static constexpr uint64_t High = XPowModP(Distance + 64 - 1);
+      static constexpr uint64_t Low = XPowModP(Distance - 1);
+    };
+
+    template <uint32_t Distance> constexpr uint64_t FoldConstants<Distance>::High;
+    template <uint32_t Distance> constexpr uint64_t FoldConstants<Distance>::Low;
+  } // namespace
+
+#if defined(AZ_STORAGE_CRC64_X86)
+  namespace {
+    void Cpuid(uint32_t leaf, uint32_t subleaf, uint32_t registers[4])
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+      int values[4];
+      __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+      for (int i = 0; i < 4; ++i)
+      {
+        registers[i] = static_cast<uint32_t>(values[i]);
+      }
+#else
+      if (!__get_cpuid_count(
+              leaf, subleaf, &registers[0], &registers[1], &registers[2], &registers[3]))
+      {
+        registers[0] = registers[1] = registers[2] = registers[3] = 0;
+      }
+#endif
+    }
+
+    uint64_t ReadXcr0()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+      return _xgetbv(0);
+#else
+      uint32_t eax = 0;
+      uint32_t edx = 0;
+      __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+      return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+    }
+
+    struct CpuFeatures final
+    {
+      bool Pclmul = false;
+      bool Vpclmul = false;
+
+      CpuFeatures()
+      {
+        uint32_t leaf1[4];
+        Cpuid(1, 0, leaf1);
+        const bool sse2 = (leaf1[3] & (1U << 26)) != 0;
+        const bool osxsave = (leaf1[2] & (1U << 27)) != 0;
+        Pclmul = sse2 && (leaf1[2] & (1U << 1)) != 0;
+
+        uint32_t leaf0[4];
+        Cpuid(0, 0, leaf0);
+        if (Pclmul && osxsave && leaf0[0] >= 7)
+        {
+          uint32_t leaf7[4];
+          Cpuid(7, 0, leaf7);
+          const bool avx512f = (leaf7[1] & (1U << 16)) != 0;
+          const bool vpclmul = (leaf7[2] & (1U << 10)) != 0;
+          // The OS must save the SSE, AVX and AVX-512 register state.
+          const bool zmmStateEnabled = (ReadXcr0() & 0xE6) == 0xE6;
+          Vpclmul = avx512f && vpclmul && zmmStateEnabled;
+        }
+      }
+    };
+
+    const CpuFeatures& GetCpuFeatures()
+    {
+      static const CpuFeatures features;
+      return features;
+    }
+
+    AZ_STORAGE_CRC64_TARGET("pclmul,sse2")
+    inline __m128i Fold128(__m128i accumulator, __m128i constants, __m128i data)
+    {
+      const __m128i high = _mm_clmulepi64_si128(accumulator, constants, 0x00);
+      const __m128i low = _mm_clmulepi64_si128(accumulator, constants, 0x11);
+      return _mm_xor_si128(_mm_xor_si128(high, low), data);
+    }
+
+    template <uint32_t Distance>
+    AZ_STORAGE_CRC64_TARGET("pclmul,sse2")
+    inline __m128i Fold128Constants()
+    {
+      return _mm_set_epi64x(
+          static_cast<long long>(FoldConstants<Distance>::Low),
+          static_cast<long long>(FoldConstants<Distance>::High));
+    }
+
+    AZ_STORAGE_CRC64_TARGET("pclmul,sse2")
+    inline __m128i Load128(const uint8_t* data)
+    {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    }
+  } // namespace
+
+  bool IsCrc64PclmulSupported() { return GetCpuFeatures().Pclmul; }
+
+  AZ_STORAGE_CRC64_TARGET("pclmul,sse2")
+  std::size_t Crc64FoldPclmul(
+      uint64_t crc,
+      const uint8_t* data,
+      std::size_t length,
+      uint8_t folded[16])
+  {
+    constexpr std::size_t BlockSize = 64;
+    if (length < 2 * BlockSize)
+    {
+      return 0;
+    }
+
+    const __m128i fold512 = Fold128Constants<512>();
+    const __m128i fold128 = Fold128Constants<128>();
+
+    // Four independent accumulators hide the latency of the multiplications.
+    __m128i x0 = _mm_xor_si128(
+        Load128(data), _mm_set_epi64x(0, static_cast<long long>(crc)));
+    __m128i x1 = Load128(data + 16);
+    __m128i x2 = Load128(data + 32);
+    __m128i x3 = Load128(data + 48);
+    std::size_t offset = BlockSize;
+    for (; length - offset >= BlockSize; offset += BlockSize)
+    {
+      x0 = Fold128(x0, fold512, Load128(data + offset));
+      x1 = Fold128(x1, fold512, Load128(data + offset + 16));
+      x2 = Fold128(x2, fold512, Load128(data + offset + 32));
+      x3 = Fold128(x3, fold512, Load128(data + offset + 48));
+    }
+
+    x0 = Fold128(x0, fold128, x1);
+    x0 = Fold128(x0, fold128, x2);
+    x0 = Fold128(x0, fold128, x3);
+    for (; length - offset >= 16; offset += 16)
+    {
+      x0 = Fold128(x0, fold128, Load128(data + offset));
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(folded), x0);
+    return offset;
+  }
+
+#if defined(AZ_STORAGE_CRC64_VPCLMUL)
+  namespace {
+    AZ_STORAGE_CRC64_TARGET("avx512f,vpclmulqdq")
+    inline __m512i Fold512(__m512i accumulator, __m512i constants, __m512i data)
+    {
+      const __m512i high = _mm512_clmulepi64_epi128(accumulator, constants, 0x00);
+      const __m512i low = _mm512_clmulepi64_epi128(accumulator, constants, 0x11);
+      return _mm512_xor_si512(_mm512_xor_si512(high, low), data);
+    }
+
+    template <uint32_t Distance>
+    AZ_STORAGE_CRC64_TARGET("avx512f,vpclmulqdq")
+    inline __m512i Fold512Constants()
+    {
+      return _mm512_broadcast_i32x4(_mm_set_epi64x(
+          static_cast<long long>(FoldConstants<Distance>::Low),
+          static_cast<long long>(FoldConstants<Distance>::High)));
+    }
+
+    AZ_STORAGE_CRC64_TARGET("avx512f,vpclmulqdq")
+    inline __m512i Load512(const uint8_t* data) { return _mm512_loadu_si512(data); }
+  } // namespace
+
+  bool IsCrc64VpclmulSupported() { return GetCpuFeatures().Vpclmul; }
+
+  AZ_STORAGE_CRC64_TARGET("avx512f,vpclmulqdq,pclmul,sse2")
+  std::size_t Crc64FoldVpclmul(
+      uint64_t crc,
+      const uint8_t* data,
+      std::size_t length,
+      uint8_t folded[16])
+  {
+    constexpr std::size_t BlockSize = 256;
+    if (length < 2 * BlockSize)
+    {
+      return 0;
+    }
+
+    const __m512i fold2048 = Fold512Constants<2048>();
+    const __m512i fold512 = Fold512Constants<512>();
+    const __m128i fold128 = Fold128Constants<128>();
+
+    __m512i z0 = _mm512_xor_si512(
+        Load512(data),
+        _mm512_inserti32x4(
+            _mm512_setzero_si512(), _mm_set_epi64x(0, static_cast<long long>(crc)), 0));
+    __m512i z1 = Load512(data + 64);
+    __m512i z2 = Load512(data + 128);
+    __m512i z3 = Load512(data + 192);
+    std::size_t offset = BlockSize;
+    for (; length - offset >= BlockSize; offset += BlockSize)
+    {
+      z0 = Fold512(z0, fold2048, Load512(data + offset));
+      z1 = Fold512(z1, fold2048, Load512(data + offset + 64));
+      z2 = Fold512(z2, fold2048, Load512(data + offset + 128));
+      z3 = Fold512(z3, fold2048, Load512(data + offset + 192));
+    }
+
+    z0 = Fold512(z0, fold512, z1);
+    z0 = Fold512(z0, fold512, z2);
+    z0 = Fold512(z0, fold512, z3);
+    for (; length - offset >= 64; offset += 64)
+    {
+      z0 = Fold512(z0, fold512, Load512(data + offset));
+    }
+
+    // The first lane holds the oldest data.
+    __m128i x0 = _mm512_extracti32x4_epi32(z0, 0);
+    x0 = Fold128(x0, fold128, _mm512_extracti32x4_epi32(z0, 1));
+    x0 = Fold128(x0, fold128, _mm512_extracti32x4_epi32(z0, 2));
+    x0 = Fold128(x0, fold128, _mm512_extracti32x4_epi32(z0, 3));
+    for (; length - offset >= 16; offset += 16)
+    {
+      x0 = Fold128(x0, fold128, Load128(data + offset));
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(folded), x0);
+    return offset;
+  }
+#else
+  bool IsCrc64VpclmulSupported() { return false; }
+
+  std::size_t Crc64FoldVpclmul(uint64_t, const uint8_t*, std::size_t, uint8_t[16]) { return 0; }
+#endif
+#else
+  bool IsCrc64PclmulSupported() { return false; }
+
+  std::size_t Crc64FoldPclmul(uint64_t, const uint8_t*, std::size_t, uint8_t[16]) { return 0; }
+
+  bool IsCrc64VpclmulSupported() { return false; }
+
+  std::size_t Crc64FoldVpclmul(uint64_t, const uint8_t*, std::size_t, uint8_t[16]) { return 0; }
+#endif
+
+#if defined(AZ_STORAGE_CRC64_PMULL)
+  namespace {
+    template <uint32_t Distance> inline uint64x2_t FoldPmull(uint64x2_t accumulator, uint64x2_t data)
+    {
+      const uint64x2_t high = vreinterpretq_u64_p128(vmull_p64(
+          static_cast<poly64_t>(vgetq_lane_u64(accumulator, 0)),
+          static_cast<poly64_t>(FoldConstants<Distance>::High)));
+      const uint64x2_t low = vreinterpretq_u64_p128(vmull_p64(
+          static_cast<poly64_t>(vgetq_lane_u64(accumulator, 1)),
+          static_cast<poly64_t>(FoldConstants<Distance>::Low)));
+      return veorq_u64(veorq_u64(high, low), data);
+    }
+
+    inline uint64x2_t LoadPmull(const uint8_t* data)
+    {
+      return vreinterpretq_u64_u8(vld1q_u8(data));
+    }
+  } // namespace
+
+  bool IsCrc64PmullSupported() { return true; }
+
+  std::size_t Crc64FoldPmull(
+      uint64_t crc,
+      const uint8_t* data,
+      std::size_t length,
+      uint8_t folded[16])
+  {
+    constexpr std::size_t BlockSize = 64;
+    if (length < 2 * BlockSize)
+    {
+      return 0;
+    }
+
+    uint64x2_t x0 = veorq_u64(LoadPmull(data), vcombine_u64(vcreate_u64(crc), vcreate_u64(0)));
+    uint64x2_t x1 = LoadPmull(data + 16);
+    uint64x2_t x2 = LoadPmull(data + 32);
+    uint64x2_t x3 = LoadPmull(data + 48);
+    std::size_t offset = BlockSize;
+    for (; length - offset >= BlockSize; offset += BlockSize)
+    {
+      x0 = FoldPmull<512>(x0, LoadPmull(data + offset));
+      x1 = FoldPmull<512>(x1, LoadPmull(data + offset + 16));
+      x2 = FoldPmull<512>(x2, LoadPmull(data + offset + 32));
+      x3 = FoldPmull<512>(x3, LoadPmull(data + offset + 48));
+    }
+
+    x0 = FoldPmull<128>(x0, x1);
+    x0 = FoldPmull<128>(x0, x2);
+    x0 = FoldPmull<128>(x0, x3);
+    for (; length - offset >= 16; offset += 16)
+    {
+      x0 = FoldPmull<128>(x0, LoadPmull(data + offset));
+    }
+
+    vst1q_u8(folded, vreinterpretq_u8_u64(x0));
+    return offset;
+  }
+#else
+  bool IsCrc64PmullSupported() { return false; }
+
+  std::size_t Crc64FoldPmull(uint64_t, const uint8_t*, std::size_t, uint8_t[16]) { return 0; }
+#endif
+
+}}} // namespace Azure::Storage::_detail
@@ -22,6 +22,7 @@
 #endif
 
 #include "azure/storage/common/storage_common.hpp"
+#include "private/crc64_clmul.hpp"
 
 #include <azure/core/http/http.hpp>
 
@@ -148,13 +149,19 @@ namespace Azure { namespace Storage {
       ~AlgorithmProviderInstance() { BCryptCloseAlgorithmProvider(Handle, 0); }
     };
 
+    AlgorithmProviderInstance& GetHmacSha256AlgorithmProvider()
+    {
+      static AlgorithmProviderInstance AlgorithmProvider(AlgorithmType::HmacSha256);
+      return AlgorithmProvider;
+    }
+
     std::vector<uint8_t> HmacSha256(
         const std::vector<uint8_t>& data,
         const std::vector<uint8_t>& key)
     {
       AZURE_ASSERT_MSG(data.size() <= (std::numeric_limits<ULONG>::max)(), "Data size is too big.");
 
-      static AlgorithmProviderInstance AlgorithmProvider(AlgorithmType::HmacSha256);
+      auto& AlgorithmProvider = GetHmacSha256AlgorithmProvider();
 
       std::string context;
       context.resize(AlgorithmProvider.ContextSize);
@@ -196,6 +203,86 @@ namespace Azure { namespace Storage {
 
       return hash;
     }
+
+    // A hash object created with the key, which already hashed the inner padding of the key, and
+    // is duplicated for each message.
+    struct HmacSha256Signer::Impl final
+    {
+      BCRYPT_HASH_HANDLE Handle = nullptr;
+      std::string Context;
+
+      ~Impl()
+      {
+        if (Handle != nullptr)
+        {
+          BCryptDestroyHash(Handle);
+        }
+      }
+    };
+
+    HmacSha256Signer::HmacSha256Signer(const std::vector<uint8_t>& key)
+        : m_impl(std::make_unique<Impl>())
+    {
+      auto& algorithmProvider = GetHmacSha256AlgorithmProvider();
+      m_impl->Context.resize(algorithmProvider.ContextSize);
+      NTSTATUS status = BCryptCreateHash(
+          algorithmProvider.Handle,
+          &m_impl->Handle,
+          reinterpret_cast<PUCHAR>(&m_impl->Context[0]),
+          static_cast<ULONG>(m_impl->Context.size()),
+          reinterpret_cast<PUCHAR>(const_cast<uint8_t*>(key.data())),
+          static_cast<ULONG>(key.size()),
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        m_impl->Handle = nullptr;
+        throw std::runtime_error("BCryptCreateHash failed.");
+      }
+    }
+
+    HmacSha256Signer::~HmacSha256Signer() = default;
+
+    std::vector<uint8_t> HmacSha256Signer::Sign(const uint8_t* data, size_t length) const
+    {
+      AZURE_ASSERT_MSG(length <= (std::numeric_limits<ULONG>::max)(), "Data size is too big.");
+
+      auto& algorithmProvider = GetHmacSha256AlgorithmProvider();
+      thread_local std::string context;
+      context.resize(algorithmProvider.ContextSize);
+
+      BCRYPT_HASH_HANDLE hashHandle;
+      NTSTATUS status = BCryptDuplicateHash(
+          m_impl->Handle,
+          &hashHandle,
+          reinterpret_cast<PUCHAR>(&context[0]),
+          static_cast<ULONG>(context.size()),
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptDuplicateHash failed.");
+      }
+
+      status = BCryptHashData(
+          hashHandle,
+          reinterpret_cast<PUCHAR>(const_cast<uint8_t*>(data)),
+          static_cast<ULONG>(length),
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        BCryptDestroyHash(hashHandle);
+        throw std::runtime_error("BCryptHashData failed.");
+      }
+
+      std::vector<uint8_t> hash(algorithmProvider.HashLength);
+      status = BCryptFinishHash(
+          hashHandle, reinterpret_cast<PUCHAR>(&hash[0]), static_cast<ULONG>(hash.size()), 0);
+      BCryptDestroyHash(hashHandle);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptFinishHash failed.");
+      }
+      return hash;
+    }
   } // namespace _internal
 
 #elif defined(AZ_PLATFORM_POSIX)
@@ -220,6 +307,83 @@ namespace Azure { namespace Storage {
       return std::vector<uint8_t>(std::begin(hash), std::begin(hash) + hashLength);
     }
 
+    // The SHA-256 states after hashing the key XORed with the inner and the outer paddings, which
+    // are copied for each message.
+    struct HmacSha256Signer::Impl final
+    {
+      EVP_MD_CTX* Inner = EVP_MD_CTX_new();
+      EVP_MD_CTX* Outer = EVP_MD_CTX_new();
+
+      ~Impl()
+      {
+        EVP_MD_CTX_free(Inner);
+        EVP_MD_CTX_free(Outer);
+      }
+    };
+
+    HmacSha256Signer::HmacSha256Signer(const std::vector<uint8_t>& key)
+        : m_impl(std::make_unique<Impl>())
+    {
+      constexpr size_t BlockSize = 64;
+      uint8_t block[BlockSize] = {};
+      if (key.size() > BlockSize)
+      {
+        unsigned int hashLength = 0;
+        if (EVP_Digest(key.data(), key.size(), block, &hashLength, EVP_sha256(), nullptr) != 1)
+        {
+          throw std::runtime_error("EVP_Digest failed.");
+        }
+      }
+      else
+      {
+        std::copy(key.begin(), key.end(), block);
+      }
+
+      uint8_t innerPad[BlockSize];
+      uint8_t outerPad[BlockSize];
+      for (size_t i = 0; i < BlockSize; ++i)
+      {
+        innerPad[i] = static_cast<uint8_t>(block[i] ^ 0x36);
+        outerPad[i] = static_cast<uint8_t>(block[i] ^ 0x5c);
+      }
+      bool const succeeded = m_impl->Inner != nullptr && m_impl->Outer != nullptr
+          && EVP_DigestInit_ex(m_impl->Inner, EVP_sha256(), nullptr) == 1
+          && EVP_DigestUpdate(m_impl->Inner, innerPad, BlockSize) == 1
+          && EVP_DigestInit_ex(m_impl->Outer, EVP_sha256(), nullptr) == 1
+          && EVP_DigestUpdate(m_impl->Outer, outerPad, BlockSize) == 1;
+      OPENSSL_cleanse(block, BlockSize);
+      OPENSSL_cleanse(innerPad, BlockSize);
+      OPENSSL_cleanse(outerPad, BlockSize);
+      if (!succeeded)
+      {
+        throw std::runtime_error("Failed to initialize HMAC-SHA256.");
+      }
+    }
+
+    HmacSha256Signer::~HmacSha256Signer() = default;
+
+    std::vector<uint8_t> HmacSha256Signer::Sign(const uint8_t* data, size_t length) const
+    {
+      thread_local std::unique_ptr<EVP_MD_CTX, void (*)(EVP_MD_CTX*)> context(
+          EVP_MD_CTX_new(), EVP_MD_CTX_free);
+
+      uint8_t innerHash[EVP_MAX_MD_SIZE];
+      unsigned int innerHashLength = 0;
+      std::vector<uint8_t> hash(EVP_MAX_MD_SIZE);
+      unsigned int hashLength = 0;
+      if (!context || EVP_MD_CTX_copy_ex(context.get(), m_impl->Inner) != 1
+          || EVP_DigestUpdate(context.get(), data, length) != 1
+          || EVP_DigestFinal_ex(context.get(), innerHash, &innerHashLength) != 1
+          || EVP_MD_CTX_copy_ex(context.get(), m_impl->Outer) != 1
+          || EVP_DigestUpdate(context.get(), innerHash, innerHashLength) != 1
+          || EVP_DigestFinal_ex(context.get(), hash.data(), &hashLength) != 1)
+      {
+        throw std::runtime_error("Failed to compute HMAC-SHA256.");
+      }
+      hash.resize(hashLength);
+      return hash;
+    }
+
   } // namespace _internal
 
 #endif
@@ -855,11 +1019,9 @@ namespace Azure { namespace Storage {
     return vr[0] ^ vr[1];
   }
 
-  void Crc64Hash::OnAppend(const uint8_t* data, size_t length)
+  static uint64_t Crc64TableAppend(uint64_t crc, const uint8_t* data, size_t length)
   {
-    m_length += length;
-
-    uint64_t uCrc = m_context ^ ~0ULL;
+    uint64_t uCrc = crc ^ ~0ULL;
 
     uint64_t pData = 0;
 
@@ -1000,7 +1162,91 @@ namespace Azure { namespace Storage {
     {
       uCrc = (uCrc >> 8) ^ Crc64MU1[(uCrc ^ data[pData]) & 0xff];
     }
-    m_context = uCrc ^ ~0ULL;
+    return uCrc ^ ~0ULL;
+  }
+
+  namespace _internal {
+    bool IsCrc64KernelSupported(Crc64Kernel kernel)
+    {
+      switch (kernel)
+      {
+        case Crc64Kernel::Auto:
+        case Crc64Kernel::Table:
+          return true;
+        case Crc64Kernel::Pclmul:
+          return _detail::IsCrc64PclmulSupported();
+        case Crc64Kernel::Vpclmul:
+          return _detail::IsCrc64VpclmulSupported();
+        case Crc64Kernel::Pmull:
+          return _detail::IsCrc64PmullSupported();
+      }
+      return false;
+    }
+
+    uint64_t Crc64Append(Crc64Kernel kernel, uint64_t crc, const uint8_t* data, size_t length)
+    {
+      using FoldFunction = size_t (*)(uint64_t, const uint8_t*, size_t, uint8_t*);
+      static const FoldFunction BestFoldFunction = []() -> FoldFunction {
+        if (_detail::IsCrc64VpclmulSupported())
+        {
+          return _detail::Crc64FoldVpclmul;
+        }
+        if (_detail::IsCrc64PclmulSupported())
+        {
+          return _detail::Crc64FoldPclmul;
+        }
+        if (_detail::IsCrc64PmullSupported())
+        {
+          return _detail::Crc64FoldPmull;
+        }
+        return nullptr;
+      }();
+
+      if (!IsCrc64KernelSupported(kernel))
+      {
+        throw std::invalid_argument("The CRC64 kernel is not supported on this CPU.");
+      }
+
+      FoldFunction foldFunction = nullptr;
+      switch (kernel)
+      {
+        case Crc64Kernel::Auto:
+          foldFunction = BestFoldFunction;
+          break;
+        case Crc64Kernel::Table:
+          break;
+        case Crc64Kernel::Pclmul:
+          foldFunction = _detail::Crc64FoldPclmul;
+          break;
+        case Crc64Kernel::Vpclmul:
+          foldFunction = _detail::Crc64FoldVpclmul;
+          break;
+        case Crc64Kernel::Pmull:
+          foldFunction = _detail::Crc64FoldPmull;
+          break;
+      }
+
+      if (foldFunction)
+      {
+        // The fold functions work on the pre-inverted state, and leave a 16-byte remainder to be
+        // reduced by the table implementation.
+        uint8_t folded[16];
+        const size_t consumed = foldFunction(crc ^ ~0ULL, data, length, folded);
+        if (consumed != 0)
+        {
+          crc = Crc64TableAppend(~0ULL, folded, sizeof(folded));
+          data += consumed;
+          length -= consumed;
+        }
+      }
+      return Crc64TableAppend(crc, data, length);
+    }
+  } // namespace _internal
+
+  void Crc64Hash::OnAppend(const uint8_t* data, size_t length)
+  {
+    m_length += length;
+    m_context = _internal::Crc64Append(_internal::Crc64Kernel::Auto, m_context, data, length);
   }
 
   void Crc64Hash::Concatenate(const Crc64Hash& other)
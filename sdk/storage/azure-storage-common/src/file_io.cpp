@@ -9,6 +9,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #endif
@@ -23,13 +24,26 @@
 #include <windows.h>
 #endif
 
+#include <cstring>
 #include <limits>
 #include <stdexcept>
 
 namespace Azure { namespace Storage { namespace _internal {
 
+  namespace {
+    bool IsAlignedForUnbufferedIo(const uint8_t* buffer, size_t length, int64_t offset)
+    {
+      return reinterpret_cast<uintptr_t>(buffer) % UnbufferedFileIoAlignment == 0
+          && length % UnbufferedFileIoAlignment == 0
+          && static_cast<uint64_t>(offset) % UnbufferedFileIoAlignment == 0;
+    }
+
+    // Large files are only mapped when there is enough address space for them.
+    constexpr bool CanMapFiles = sizeof(void*) >= 8;
+  } // namespace
+
 #if defined(AZ_PLATFORM_WINDOWS)
-  FileReader::FileReader(const std::string& filename)
+  FileReader::FileReader(const std::string& filename, bool mapFile)
   {
     int sizeNeeded = MultiByteToWideChar(
         CP_UTF8,
@@ -84,11 +98,45 @@ namespace Azure { namespace Storage { namespace _internal {
     }
     m_handle = static_cast<void*>(fileHandle);
     m_fileSize = fileSize.QuadPart;
+
+#if !defined(WINAPI_PARTITION_DESKTOP) \
+    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
+    // Map the file so that uploads can read it in place. If this fails, the file is read through
+    // the handle instead.
+    if (mapFile && CanMapFiles && m_fileSize > 0)
+    {
+      HANDLE mappingHandle
+          = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mappingHandle != NULL)
+      {
+        void* view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (view != nullptr)
+        {
+          m_mappingHandle = static_cast<void*>(mappingHandle);
+          m_mappedData = static_cast<const uint8_t*>(view);
+        }
+        else
+        {
+          CloseHandle(mappingHandle);
+        }
+      }
+    }
+#else
+    (void)mapFile;
+#endif
   }
 
-  FileReader::~FileReader() { CloseHandle(static_cast<HANDLE>(m_handle)); }
+  FileReader::~FileReader()
+  {
+    if (m_mappedData)
+    {
+      UnmapViewOfFile(m_mappedData);
+      CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    }
+    CloseHandle(static_cast<HANDLE>(m_handle));
+  }
 
-  FileWriter::FileWriter(const std::string& filename)
+  FileWriter::FileWriter(const std::string& filename, bool unbuffered)
   {
     int sizeNeeded = MultiByteToWideChar(
         CP_UTF8,
@@ -135,9 +183,38 @@ namespace Azure { namespace Storage { namespace _internal {
       throw std::runtime_error("Failed to open file.");
     }
     m_handle = static_cast<void*>(fileHandle);
+
+#if !defined(WINAPI_PARTITION_DESKTOP) \
+    || WINAPI_PARTITION_DESKTOP // See azure/core/platform.hpp for explanation.
+    if (unbuffered)
+    {
+      HANDLE unbufferedHandle = CreateFileW(
+          filenameW.data(),
+          GENERIC_WRITE,
+          FILE_SHARE_READ | FILE_SHARE_WRITE,
+          nullptr,
+          OPEN_EXISTING,
+          FILE_FLAG_NO_BUFFERING,
+          NULL);
+      if (unbufferedHandle != INVALID_HANDLE_VALUE)
+      {
+        m_unbufferedHandle = static_cast<void*>(unbufferedHandle);
+        m_hasUnbufferedHandle = true;
+      }
+    }
+#else
+    (void)unbuffered;
+#endif
   }
 
-  FileWriter::~FileWriter() { CloseHandle(static_cast<HANDLE>(m_handle)); }
+  FileWriter::~FileWriter()
+  {
+    if (m_hasUnbufferedHandle)
+    {
+      CloseHandle(static_cast<HANDLE>(m_unbufferedHandle));
+    }
+    CloseHandle(static_cast<HANDLE>(m_handle));
+  }
 
   void FileWriter::Write(const uint8_t* buffer, size_t length, int64_t offset)
   {
@@ -146,25 +223,35 @@ namespace Azure { namespace Storage { namespace _internal {
       throw std::runtime_error("Failed to write file.");
     }
 
-    OVERLAPPED overlapped;
-    std::memset(&overlapped, 0, sizeof(overlapped));
-    overlapped.Offset = static_cast<DWORD>(static_cast<uint64_t>(offset));
-    overlapped.OffsetHigh = static_cast<DWORD>(static_cast<uint64_t>(offset) >> 32);
+    auto writeAt = [&](FileHandle handle) {
+      OVERLAPPED overlapped;
+      std::memset(&overlapped, 0, sizeof(overlapped));
+      overlapped.Offset = static_cast<DWORD>(static_cast<uint64_t>(offset));
+      overlapped.OffsetHigh = static_cast<DWORD>(static_cast<uint64_t>(offset) >> 32);
 
-    DWORD bytesWritten;
-    BOOL ret = WriteFile(
-        static_cast<HANDLE>(m_handle),
-        buffer,
-        static_cast<DWORD>(length),
-        &bytesWritten,
-        &overlapped);
-    if (!ret)
+      DWORD bytesWritten;
+      BOOL ret = WriteFile(
+          static_cast<HANDLE>(handle),
+          buffer,
+          static_cast<DWORD>(length),
+          &bytesWritten,
+          &overlapped);
+      return ret && bytesWritten == static_cast<DWORD>(length);
+    };
+
+    if (m_hasUnbufferedHandle && IsAlignedForUnbufferedIo(buffer, length, offset)
+        && writeAt(m_unbufferedHandle))
+    {
+      return;
+    }
+    // Unaligned ranges, and volumes that need a larger alignment, go through the file cache.
+    if (!writeAt(m_handle))
     {
       throw std::runtime_error("Failed to write file.");
     }
   }
 #elif defined(AZ_PLATFORM_POSIX)
-  FileReader::FileReader(const std::string& filename)
+  FileReader::FileReader(const std::string& filename, bool mapFile)
   {
     m_handle = open(filename.data(), O_RDONLY);
     if (m_handle == -1)
@@ -177,11 +264,32 @@ namespace Azure { namespace Storage { namespace _internal {
       close(m_handle);
       throw std::runtime_error("Failed to get size of file.");
     }
+
+    // Map the file so that uploads can read it in place. If this fails, the file is read through
+    // the file descriptor instead.
+    if (mapFile && CanMapFiles && m_fileSize > 0)
+    {
+      void* view
+          = mmap(nullptr, static_cast<size_t>(m_fileSize), PROT_READ, MAP_SHARED, m_handle, 0);
+      if (view != MAP_FAILED)
+      {
+        // Every chunk is read front to back exactly once.
+        madvise(view, static_cast<size_t>(m_fileSize), MADV_SEQUENTIAL);
+        m_mappedData = static_cast<const uint8_t*>(view);
+      }
+    }
   }
 
-  FileReader::~FileReader() { close(m_handle); }
+  FileReader::~FileReader()
+  {
+    if (m_mappedData)
+    {
+      munmap(const_cast<uint8_t*>(m_mappedData), static_cast<size_t>(m_fileSize));
+    }
+    close(m_handle);
+  }
 
-  FileWriter::FileWriter(const std::string& filename)
+  FileWriter::FileWriter(const std::string& filename, bool unbuffered)
   {
     m_handle = open(
         filename.data(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
@@ -189,9 +297,32 @@ namespace Azure { namespace Storage { namespace _internal {
     {
       throw std::runtime_error("Failed to open file.");
     }
+
+    if (unbuffered)
+    {
+#if defined(O_DIRECT)
+      m_unbufferedHandle = open(filename.data(), O_WRONLY | O_DIRECT);
+      m_hasUnbufferedHandle = m_unbufferedHandle != -1;
+#elif defined(F_NOCACHE)
+      m_unbufferedHandle = open(filename.data(), O_WRONLY);
+      if (m_unbufferedHandle != -1 && fcntl(m_unbufferedHandle, F_NOCACHE, 1) == -1)
+      {
+        close(m_unbufferedHandle);
+        m_unbufferedHandle = -1;
+      }
+      m_hasUnbufferedHandle = m_unbufferedHandle != -1;
+#endif
+    }
   }
 
-  FileWriter::~FileWriter() { close(m_handle); }
+  FileWriter::~FileWriter()
+  {
+    if (m_hasUnbufferedHandle)
+    {
+      close(m_unbufferedHandle);
+    }
+    close(m_handle);
+  }
 
   void FileWriter::Write(const uint8_t* buffer, size_t length, int64_t offset)
   {
@@ -199,6 +330,16 @@ namespace Azure { namespace Storage { namespace _internal {
     {
       throw std::runtime_error("Failed to write file.");
     }
+    if (m_hasUnbufferedHandle && IsAlignedForUnbufferedIo(buffer, length, offset))
+    {
+      ssize_t bytesWritten
+          = pwrite(m_unbufferedHandle, buffer, length, static_cast<off_t>(offset));
+      if (bytesWritten >= 0 && static_cast<size_t>(bytesWritten) == length)
+      {
+        return;
+      }
+      // The file system may need a larger alignment, write through the file cache instead.
+    }
     ssize_t bytesWritten = pwrite(m_handle, buffer, length, static_cast<off_t>(offset));
     if (bytesWritten < 0 || static_cast<size_t>(bytesWritten) != length)
     {
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Azure { namespace Storage { namespace _detail {
+
+  /*
+   * The carry-less multiplication kernels below fold the bulk of a buffer into a 16-byte
+   * remainder. They return the number of bytes consumed, which is a multiple of 16 and may be 0
+   * for short buffers. Running the byte-wise CRC64 over the 16 bytes in `folded`, starting from a
+   * zero state, yields the CRC64 state after the consumed bytes. The remaining bytes are then
+   * processed the regular way.
+   *
+   * `crc` is the CRC64 state (the pre-inverted context) before data.
+   */
+
+  bool IsCrc64PclmulSupported();
+  std::size_t Crc64FoldPclmul(
+      uint64_t crc,
+      const uint8_t* data,
+      std::size_t length,
+      uint8_t folded[16]);
+
+  bool IsCrc64VpclmulSupported();
+  std::size_t Crc64FoldVpclmul(
+      uint64_t crc,
+      const uint8_t* data,
+      std::size_t length,
+      uint8_t folded[16]);
+
+  bool IsCrc64PmullSupported();
+  std::size_t Crc64FoldPmull(
+      uint64_t crc,
+      const uint8_t* data,
+      std::size_t length,
+      uint8_t folded[16]);
+
+}}} // namespace Azure::Storage::_detail
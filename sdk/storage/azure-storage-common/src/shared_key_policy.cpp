@@ -9,6 +9,9 @@
 #include <azure/core/internal/strings.hpp>
 
 #include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace {
 /*
@@ -92,78 +95,126 @@ bool comparator(const std::string& lhs, const std::string& rhs)
 
 namespace Azure { namespace Storage { namespace _internal {
 
+  namespace {
+    // Assigns the lowercase, URL-decoded form of a query parameter component to a string which is
+    // reused across requests, so that its memory is only allocated once in most cases.
+    void AssignCanonicalizedQueryComponent(
+        std::string& target,
+        const std::string& value,
+        bool lower)
+    {
+      if (value.find_first_of("%+") != std::string::npos)
+      {
+        target = Azure::Core::Url::Decode(
+            lower ? Azure::Core::_internal::StringExtensions::ToLower(value) : value);
+        return;
+      }
+      target.assign(value);
+      if (lower)
+      {
+        for (auto& c : target)
+        {
+          c = Azure::Core::_internal::StringExtensions::ToLower(c);
+        }
+      }
+    }
+  } // namespace
+
   std::string SharedKeyPolicy::GetSignature(const Core::Http::Request& request) const
   {
-    std::string string_to_sign;
-    string_to_sign += request.GetMethod().ToString() + "\n";
+    // The string to sign and the sorted entries are kept per thread, so that signing reuses their
+    // memory instead of allocating it for every request.
+    thread_local std::string stringToSign;
+    thread_local std::vector<std::pair<const std::string*, const std::string*>> headersToSign;
+    thread_local std::vector<std::pair<std::string, std::string>> queryParametersToSign;
 
-    const auto& headers = request.GetHeaders();
-    for (std::string headerName :
-         {"Content-Encoding",
-          "Content-Language",
-          "Content-Length",
-          "Content-MD5",
-          "Content-Type",
-          "Date",
-          "If-Modified-Since",
-          "If-Match",
-          "If-None-Match",
-          "If-Unmodified-Since",
-          "Range"})
+    stringToSign.clear();
+    stringToSign += request.GetMethod().ToString();
+    stringToSign += '\n';
+
+    static const std::string ContentLength = "content-length";
+    static const std::string StandardHeaders[] = {
+        "content-encoding",
+        "content-language",
+        ContentLength,
+        "content-md5",
+        "content-type",
+        "date",
+        "if-modified-since",
+        "if-match",
+        "if-none-match",
+        "if-unmodified-since",
+        "range",
+    };
+    const auto headers = request.GetHeaders();
+    for (const auto& headerName : StandardHeaders)
     {
       auto ite = headers.find(headerName);
-      if (ite != headers.end())
+      if (ite != headers.end() && !(ite->second == "0" && headerName == ContentLength))
       {
-        if (headerName == "Content-Length" && ite->second == "0")
-        {
-          // do nothing
-        }
-        else
-        {
-          string_to_sign += ite->second;
-        }
+        stringToSign += ite->second;
       }
-      string_to_sign += "\n";
+      stringToSign += '\n';
     }
 
     // canonicalized headers
-    const std::string prefix = "x-ms-";
-    std::vector<std::pair<std::string, std::string>> ordered_kv;
-    for (auto ite = headers.lower_bound(prefix);
-         ite != headers.end() && ite->first.substr(0, prefix.length()) == prefix;
+    // Header names are stored in lowercase, and the order of the map is usually the culture-aware
+    // order as well, in which case there is nothing to sort.
+    static const std::string Prefix = "x-ms-";
+    headersToSign.clear();
+    for (auto ite = headers.lower_bound(Prefix);
+         ite != headers.end() && ite->first.compare(0, Prefix.length(), Prefix) == 0;
          ++ite)
     {
-      std::string key = Azure::Core::_internal::StringExtensions::ToLower(ite->first);
-      ordered_kv.emplace_back(std::make_pair(std::move(key), ite->second));
+      headersToSign.emplace_back(&ite->first, &ite->second);
     }
-    std::sort(ordered_kv.begin(), ordered_kv.end(), [](const auto& lhs, const auto& rhs) {
-      return comparator(lhs.first, rhs.first);
-    });
-    for (const auto& p : ordered_kv)
+    auto const headerComparator
+        = [](const auto& lhs, const auto& rhs) { return comparator(*lhs.first, *rhs.first); };
+    if (!std::is_sorted(headersToSign.begin(), headersToSign.end(), headerComparator))
     {
-      string_to_sign += p.first + ":" + p.second + "\n";
+      std::sort(headersToSign.begin(), headersToSign.end(), headerComparator);
     }
-    ordered_kv.clear();
+    for (const auto& header : headersToSign)
+    {
+      stringToSign += *header.first;
+      stringToSign += ':';
+      stringToSign += *header.second;
+      stringToSign += '\n';
+    }
+    headersToSign.clear();
 
     // canonicalized resource
-    string_to_sign += "/" + m_credential->AccountName + "/" + request.GetUrl().GetPath() + "\n";
+    stringToSign += '/';
+    stringToSign += m_credential->AccountName;
+    stringToSign += '/';
+    stringToSign += request.GetUrl().GetPath();
+    stringToSign += '\n';
+    size_t queryParametersCount = 0;
     for (const auto& query : request.GetUrl().GetQueryParameters())
     {
-      std::string key = Azure::Core::_internal::StringExtensions::ToLower(query.first);
-      ordered_kv.emplace_back(
-          std::make_pair(Azure::Core::Url::Decode(key), Azure::Core::Url::Decode(query.second)));
+      if (queryParametersToSign.size() == queryParametersCount)
+      {
+        queryParametersToSign.emplace_back();
+      }
+      auto& entry = queryParametersToSign[queryParametersCount++];
+      AssignCanonicalizedQueryComponent(entry.first, query.first, true);
+      AssignCanonicalizedQueryComponent(entry.second, query.second, false);
     }
-    std::sort(ordered_kv.begin(), ordered_kv.end());
-    for (const auto& p : ordered_kv)
+    auto const queryParametersEnd = queryParametersToSign.begin()
+        + static_cast<std::ptrdiff_t>(queryParametersCount);
+    std::sort(queryParametersToSign.begin(), queryParametersEnd);
+    for (auto ite = queryParametersToSign.begin(); ite != queryParametersEnd; ++ite)
     {
-      string_to_sign += p.first + ":" + p.second + "\n";
+      stringToSign += ite->first;
+      stringToSign += ':';
+      stringToSign += ite->second;
+      stringToSign += '\n';
     }
 
     // remove last linebreak
-    string_to_sign.pop_back();
+    stringToSign.pop_back();
 
-    return Azure::Core::Convert::Base64Encode(_internal::HmacSha256(
-        std::vector<uint8_t>(string_to_sign.begin(), string_to_sign.end()),
-        Azure::Core::Convert::Base64Decode(m_credential->GetAccountKey())));
+    return Azure::Core::Convert::Base64Encode(m_credential->GetSigner()->Sign(
+        reinterpret_cast<const uint8_t*>(stringToSign.data()), stringToSign.size()));
   }
 }}} // namespace Azure::Storage::_internal
@@ -3,8 +3,27 @@
 
 #include "azure/storage/common/storage_credential.hpp"
 
+#include "azure/storage/common/crypt.hpp"
+
+#include <azure/core/base64.hpp>
+
 #include <algorithm>
 
+namespace Azure { namespace Storage {
+
+  std::shared_ptr<const _internal::HmacSha256Signer> StorageSharedKeyCredential::GetSigner() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (!m_signer)
+    {
+      m_signer = std::make_shared<const _internal::HmacSha256Signer>(
+          Azure::Core::Convert::Base64Decode(m_accountKey));
+    }
+    return m_signer;
+  }
+
+}} // namespace Azure::Storage
+
 namespace Azure { namespace Storage { namespace _internal {
 
   ConnectionStringParts ParseConnectionString(const std::string& connectionString)
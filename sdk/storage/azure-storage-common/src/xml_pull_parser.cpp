@@ -0,0 +1,696 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "azure/storage/common/internal/xml_pull_parser.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+namespace Azure { namespace Storage { namespace _internal {
+
+  namespace {
+    [[noreturn]] void ThrowParseError() { throw std::runtime_error("Failed to parse xml."); }
+
+    [[noreturn]] void ThrowUnsupportedEncoding()
+    {
+      throw std::runtime_error("Unsupported xml encoding.");
+    }
+
+    bool IsWhitespace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+
+    // Non-ASCII characters are accepted in names without checking their Unicode category; the
+    // document has already been checked to be valid UTF-8.
+    bool IsNameStartChar(char c)
+    {
+      return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':'
+          || static_cast<unsigned char>(c) >= 0x80;
+    }
+
+    bool IsNameChar(char c)
+    {
+      return IsNameStartChar(c) || (c >= '0' && c <= '9') || c == '-' || c == '.';
+    }
+
+    // Returns the end of the name at the beginning of [begin, end).
+    const char* ReadName(const char* begin, const char* end)
+    {
+      if (begin == end || !IsNameStartChar(*begin))
+      {
+        ThrowParseError();
+      }
+      return std::find_if_not(begin + 1, end, IsNameChar);
+    }
+
+    const char* SkipWhitespace(const char* begin, const char* end)
+    {
+      return std::find_if_not(begin, end, IsWhitespace);
+    }
+
+    const char* Find(const char* begin, const char* end, const char* pattern, size_t length)
+    {
+      auto const found = std::search(begin, end, pattern, pattern + length);
+      return found == end ? nullptr : found;
+    }
+
+    bool StartsWith(const char* begin, const char* end, const char* prefix, size_t length)
+    {
+      return static_cast<size_t>(end - begin) >= length && std::memcmp(begin, prefix, length) == 0;
+    }
+
+    bool EqualsIgnoreCase(XmlStringView value, const char* expected)
+    {
+      auto const length = std::strlen(expected);
+      if (value.Size() != length)
+      {
+        return false;
+      }
+      for (size_t i = 0; i < length; ++i)
+      {
+        auto c = value.Data()[i];
+        if (c >= 'A' && c <= 'Z')
+        {
+          c = static_cast<char>(c - 'A' + 'a');
+        }
+        if (c != expected[i])
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    bool IsXmlChar(uint32_t codePoint)
+    {
+      return codePoint == 0x9 || codePoint == 0xA || codePoint == 0xD
+          || (codePoint >= 0x20 && codePoint <= 0xD7FF)
+          || (codePoint >= 0xE000 && codePoint <= 0xFFFD)
+          || (codePoint >= 0x10000 && codePoint <= 0x10FFFF);
+    }
+
+    // Checks that [begin, end) is UTF-8 and only contains characters allowed in XML 1.0.
+    void ValidateCharacters(const unsigned char* begin, const unsigned char* end)
+    {
+      auto p = begin;
+      while (p != end)
+      {
+        // Most of a document is ASCII text without control characters; skip it eight bytes at a
+        // time.
+        while (end - p >= 8)
+        {
+          uint64_t word;
+          std::memcpy(&word, p, sizeof(word));
+          auto const nonAscii = word & 0x8080808080808080ULL;
+          auto const control = (word - 0x2020202020202020ULL) & ~word & 0x8080808080808080ULL;
+          if ((nonAscii | control) != 0)
+          {
+            break;
+          }
+          p += 8;
+        }
+        if (p == end)
+        {
+          break;
+        }
+
+        auto const lead = *p;
+        if (lead < 0x80)
+        {
+          if (!IsXmlChar(lead))
+          {
+            ThrowParseError();
+          }
+          ++p;
+          continue;
+        }
+
+        size_t length;
+        uint32_t codePoint;
+        uint32_t minimum;
+        if (lead >= 0xC2 && lead <= 0xDF)
+        {
+          length = 2;
+          codePoint = lead & 0x1F;
+          minimum = 0x80;
+        }
+        else if (lead >= 0xE0 && lead <= 0xEF)
+        {
+          length = 3;
+          codePoint = lead & 0x0F;
+          minimum = 0x800;
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4)
+        {
+          length = 4;
+          codePoint = lead & 0x07;
+          minimum = 0x10000;
+        }
+        else
+        {
+          ThrowParseError();
+        }
+        if (static_cast<size_t>(end - p) < length)
+        {
+          ThrowParseError();
+        }
+        for (size_t i = 1; i < length; ++i)
+        {
+          if ((p[i] & 0xC0) != 0x80)
+          {
+            ThrowParseError();
+          }
+          codePoint = (codePoint << 6) | (p[i] & 0x3F);
+        }
+        // Overlong encodings, surrogates and code points above U+10FFFF are not UTF-8.
+        if (codePoint < minimum || !IsXmlChar(codePoint))
+        {
+          ThrowParseError();
+        }
+        p += length;
+      }
+    }
+
+    // Checks the version and encoding of an XML declaration; [begin, end) is what is between
+    // "<?xml" and "?>".
+    void ValidateDeclaration(const char* begin, const char* end)
+    {
+      static const char* const PseudoAttributes[] = {"version", "encoding", "standalone"};
+      size_t nextPseudoAttribute = 0;
+
+      auto p = begin;
+      while (true)
+      {
+        auto const nameBegin = SkipWhitespace(p, end);
+        if (nameBegin == end)
+        {
+          break;
+        }
+        if (nameBegin == p)
+        {
+          ThrowParseError();
+        }
+        auto const nameEnd = ReadName(nameBegin, end);
+        XmlStringView const name(nameBegin, nameEnd - nameBegin);
+
+        // The pseudo-attributes are optional, apart from the version, but come in this order.
+        while (nextPseudoAttribute != 3 && !(name == PseudoAttributes[nextPseudoAttribute]))
+        {
+          if (nextPseudoAttribute == 0)
+          {
+            ThrowParseError();
+          }
+          ++nextPseudoAttribute;
+        }
+        if (nextPseudoAttribute == 3)
+        {
+          ThrowParseError();
+        }
+
+        p = SkipWhitespace(nameEnd, end);
+        if (p == end || *p != '=')
+        {
+          ThrowParseError();
+        }
+        p = SkipWhitespace(p + 1, end);
+        if (p == end || (*p != '"' && *p != '\''))
+        {
+          ThrowParseError();
+        }
+        auto const valueBegin = p + 1;
+        auto const valueEnd = std::find(valueBegin, end, *p);
+        if (valueEnd == end)
+        {
+          ThrowParseError();
+        }
+        XmlStringView const value(valueBegin, valueEnd - valueBegin);
+
+        if (nextPseudoAttribute == 0)
+        {
+          if (value.Size() < 3 || !StartsWith(valueBegin, valueEnd, "1.", 2))
+          {
+            ThrowParseError();
+          }
+        }
+        else if (nextPseudoAttribute == 1)
+        {
+          if (!EqualsIgnoreCase(value, "utf-8"))
+          {
+            ThrowUnsupportedEncoding();
+          }
+        }
+        else if (!(value == "yes") && !(value == "no"))
+        {
+          ThrowParseError();
+        }
+        ++nextPseudoAttribute;
+        p = valueEnd + 1;
+      }
+
+      if (nextPseudoAttribute == 0)
+      {
+        ThrowParseError();
+      }
+    }
+
+    void AppendUtf8(std::string& out, uint32_t codePoint)
+    {
+      if (codePoint < 0x80)
+      {
+        out += static_cast<char>(codePoint);
+      }
+      else if (codePoint < 0x800)
+      {
+        out += static_cast<char>(0xC0 | (codePoint >> 6));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+      else if (codePoint < 0x10000)
+      {
+        out += static_cast<char>(0xE0 | (codePoint >> 12));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+      else
+      {
+        out += static_cast<char>(0xF0 | (codePoint >> 18));
+        out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codePoint & 0x3F));
+      }
+    }
+
+    // Parses the digits of "&#...;" or "&#x...;".
+    uint32_t ParseCharacterReference(XmlStringView digits)
+    {
+      auto begin = digits.Data();
+      auto const end = begin + digits.Size();
+      uint32_t base = 10;
+      if (begin != end && *begin == 'x')
+      {
+        base = 16;
+        ++begin;
+      }
+      if (begin == end || end - begin > 8)
+      {
+        ThrowParseError();
+      }
+
+      uint32_t codePoint = 0;
+      for (; begin != end; ++begin)
+      {
+        auto const c = *begin;
+        uint32_t digit;
+        if (c >= '0' && c <= '9')
+        {
+          digit = static_cast<uint32_t>(c - '0');
+        }
+        else if (base == 16 && c >= 'a' && c <= 'f')
+        {
+          digit = static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (base == 16 && c >= 'A' && c <= 'F')
+        {
+          digit = static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+          ThrowParseError();
+        }
+        codePoint = codePoint * base + digit;
+      }
+
+      if (!IsXmlChar(codePoint))
+      {
+        ThrowParseError();
+      }
+      return codePoint;
+    }
+  } // namespace
+
+  XmlPullParser::XmlPullParser(const char* data, size_t length) : m_data(data), m_size(length)
+  {
+    auto const begin = m_data;
+    auto const end = m_data + m_size;
+
+    // Documents in UTF-16 or UTF-32 start with a byte order mark or with a zero byte.
+    if (m_size >= 2
+        && (StartsWith(begin, end, "\xFE\xFF", 2) || StartsWith(begin, end, "\xFF\xFE", 2)
+            || begin[0] == '\0' || begin[1] == '\0'))
+    {
+      ThrowUnsupportedEncoding();
+    }
+    if (StartsWith(begin, end, "\xEF\xBB\xBF", 3))
+    {
+      m_position = 3;
+    }
+
+    // The XML declaration, if there is one, has to be the first thing in the document.
+    auto const content = begin + m_position;
+    if (StartsWith(content, end, "<?xml", 5) && content + 5 != end && IsWhitespace(content[5]))
+    {
+      auto const close = Find(content + 5, end, "?>", 2);
+      if (close == nullptr)
+      {
+        ThrowParseError();
+      }
+      ValidateDeclaration(content + 5, close);
+      m_position = (close + 2) - m_data;
+    }
+
+    ValidateCharacters(
+        reinterpret_cast<const unsigned char*>(begin),
+        reinterpret_cast<const unsigned char*>(end));
+  }
+
+  XmlToken XmlPullParser::Read()
+  {
+    XmlToken token;
+    while (!ReadNode(&token))
+    {
+    }
+    return token;
+  }
+
+  bool XmlPullParser::ReadNode(XmlToken* token)
+  {
+    if (m_state == State::Attributes)
+    {
+      return ReadAttribute(token);
+    }
+
+    auto const begin = m_data + m_position;
+    auto const end = m_data + m_size;
+    if (begin == end)
+    {
+      if (!m_rootRead || !m_openElements.empty())
+      {
+        ThrowParseError();
+      }
+      token->Type = XmlNodeType::End;
+      return true;
+    }
+
+    if (*begin == '<')
+    {
+      return ReadMarkup(token);
+    }
+
+    auto textEnd = static_cast<const char*>(std::memchr(begin, '<', end - begin));
+    if (textEnd == nullptr)
+    {
+      textEnd = end;
+    }
+    m_position = textEnd - m_data;
+
+    if (std::all_of(begin, textEnd, IsWhitespace))
+    {
+      return false;
+    }
+    if (m_openElements.empty() || Find(begin, textEnd, "]]>", 3) != nullptr)
+    {
+      ThrowParseError();
+    }
+    token->Type = XmlNodeType::Text;
+    token->Name = XmlStringView();
+    token->Value = Decode(begin, textEnd, false);
+    return true;
+  }
+
+  bool XmlPullParser::ReadMarkup(XmlToken* token)
+  {
+    auto const begin = m_data + m_position;
+    auto const end = m_data + m_size;
+    if (end - begin < 2)
+    {
+      ThrowParseError();
+    }
+
+    if (begin[1] == '?')
+    {
+      auto const targetEnd = ReadName(begin + 2, end);
+      auto const close = Find(targetEnd, end, "?>", 2);
+      if (close == nullptr || (targetEnd != close && !IsWhitespace(*targetEnd))
+          || EqualsIgnoreCase(XmlStringView(begin + 2, targetEnd - (begin + 2)), "xml"))
+      {
+        ThrowParseError();
+      }
+      m_position = (close + 2) - m_data;
+      return false;
+    }
+
+    if (begin[1] == '!')
+    {
+      if (StartsWith(begin, end, "<!--", 4))
+      {
+        // "--" may only appear at the end of a comment.
+        auto const close = Find(begin + 4, end, "--", 2);
+        if (close == nullptr || close + 2 == end || close[2] != '>')
+        {
+          ThrowParseError();
+        }
+        m_position = (close + 3) - m_data;
+        return false;
+      }
+      if (StartsWith(begin, end, "<![CDATA[", 9))
+      {
+        auto const close = Find(begin + 9, end, "]]>", 3);
+        if (close == nullptr || m_openElements.empty())
+        {
+          ThrowParseError();
+        }
+        m_position = (close + 3) - m_data;
+        token->Type = XmlNodeType::Text;
+        token->Name = XmlStringView();
+        token->Value = XmlStringView(begin + 9, close - (begin + 9));
+        return true;
+      }
+      if (!StartsWith(begin, end, "<!DOCTYPE", 9) || m_rootRead || m_documentTypeRead)
+      {
+        ThrowParseError();
+      }
+
+      // The document type declaration may have an internal subset in brackets, which can
+      // contain quoted strings.
+      int brackets = 0;
+      char quote = '\0';
+      for (auto p = begin + 9; p != end; ++p)
+      {
+        if (quote != '\0')
+        {
+          if (*p == quote)
+          {
+            quote = '\0';
+          }
+        }
+        else if (*p == '"' || *p == '\'')
+        {
+          quote = *p;
+        }
+        else if (*p == '[')
+        {
+          ++brackets;
+        }
+        else if (*p == ']')
+        {
+          --brackets;
+        }
+        else if (*p == '>' && brackets == 0)
+        {
+          m_documentTypeRead = true;
+          m_position = (p + 1) - m_data;
+          return false;
+        }
+      }
+      ThrowParseError();
+    }
+
+    if (begin[1] == '/')
+    {
+      auto const nameEnd = ReadName(begin + 2, end);
+      auto const close = SkipWhitespace(nameEnd, end);
+      if (close == end || *close != '>' || m_openElements.empty()
+          || !(XmlStringView(begin + 2, nameEnd - (begin + 2)) == m_openElements.back()))
+      {
+        ThrowParseError();
+      }
+      m_openElements.pop_back();
+
+      m_position = (close + 1) - m_data;
+      token->Type = XmlNodeType::EndTag;
+      token->Name = XmlStringView();
+      token->Value = XmlStringView();
+      return true;
+    }
+
+    auto const nameEnd = ReadName(begin + 1, end);
+    if (m_rootRead && m_openElements.empty())
+    {
+      ThrowParseError();
+    }
+    XmlStringView const name(begin + 1, nameEnd - (begin + 1));
+    m_openElements.push_back(name);
+    m_attributeNames.clear();
+    m_rootRead = true;
+    m_state = State::Attributes;
+
+    m_position = nameEnd - m_data;
+    token->Type = XmlNodeType::StartTag;
+    token->Name = name;
+    token->Value = XmlStringView();
+    return true;
+  }
+
+  bool XmlPullParser::ReadAttribute(XmlToken* token)
+  {
+    auto const begin = m_data + m_position;
+    auto const end = m_data + m_size;
+
+    auto p = SkipWhitespace(begin, end);
+    if (p == end)
+    {
+      ThrowParseError();
+    }
+
+    if (*p == '>')
+    {
+      m_state = State::Content;
+      m_position = (p + 1) - m_data;
+      return false;
+    }
+
+    if (*p == '/')
+    {
+      if (p + 1 == end || p[1] != '>')
+      {
+        ThrowParseError();
+      }
+      m_openElements.pop_back();
+      m_state = State::Content;
+
+      m_position = (p + 2) - m_data;
+      token->Type = XmlNodeType::EndTag;
+      token->Name = XmlStringView();
+      token->Value = XmlStringView();
+      return true;
+    }
+
+    // Attributes are separated from the element name and from each other by whitespace.
+    if (p == begin)
+    {
+      ThrowParseError();
+    }
+    auto const nameBegin = p;
+    auto const nameEnd = ReadName(nameBegin, end);
+    XmlStringView const name(nameBegin, nameEnd - nameBegin);
+    if (std::find(m_attributeNames.begin(), m_attributeNames.end(), name)
+        != m_attributeNames.end())
+    {
+      ThrowParseError();
+    }
+    m_attributeNames.push_back(name);
+
+    p = SkipWhitespace(nameEnd, end);
+    if (p == end || *p != '=')
+    {
+      ThrowParseError();
+    }
+    p = SkipWhitespace(p + 1, end);
+    if (p == end || (*p != '"' && *p != '\''))
+    {
+      ThrowParseError();
+    }
+    auto const valueBegin = p + 1;
+    auto const valueEnd = std::find(valueBegin, end, *p);
+    if (valueEnd == end || std::find(valueBegin, valueEnd, '<') != valueEnd)
+    {
+      ThrowParseError();
+    }
+
+    m_position = (valueEnd + 1) - m_data;
+    token->Type = XmlNodeType::Attribute;
+    token->Name = name;
+    token->Value = Decode(valueBegin, valueEnd, true);
+    return true;
+  }
+
+  XmlStringView XmlPullParser::Decode(const char* begin, const char* end, bool isAttribute)
+  {
+    // Attribute values are normalized: line breaks and tabs become spaces.
+    auto const needsDecoding = [isAttribute](char c) {
+      return c == '&' || c == '\r' || (isAttribute && (c == '\n' || c == '\t'));
+    };
+
+    auto p = std::find_if(begin, end, needsDecoding);
+    if (p == end)
+    {
+      return XmlStringView(begin, end - begin);
+    }
+
+    m_decoded.assign(begin, p);
+    while (p != end)
+    {
+      auto const c = *p;
+      if (c == '&')
+      {
+        auto const semicolon = static_cast<const char*>(std::memchr(p, ';', end - p));
+        if (semicolon == nullptr)
+        {
+          ThrowParseError();
+        }
+        XmlStringView const name(p + 1, semicolon - (p + 1));
+        if (name == "lt")
+        {
+          m_decoded += '<';
+        }
+        else if (name == "gt")
+        {
+          m_decoded += '>';
+        }
+        else if (name == "amp")
+        {
+          m_decoded += '&';
+        }
+        else if (name == "quot")
+        {
+          m_decoded += '"';
+        }
+        else if (name == "apos")
+        {
+          m_decoded += '\'';
+        }
+        else if (!name.Empty() && name.Data()[0] == '#')
+        {
+          AppendUtf8(
+              m_decoded,
+              ParseCharacterReference(XmlStringView(name.Data() + 1, name.Size() - 1)));
+        }
+        else
+        {
+          ThrowParseError();
+        }
+        p = semicolon + 1;
+      }
+      else if (c == '\r')
+      {
+        // "\r\n" and "\r" are line breaks.
+        m_decoded += isAttribute ? ' ' : '\n';
+        ++p;
+        if (p != end && *p == '\n')
+        {
+          ++p;
+        }
+      }
+      else if (isAttribute && (c == '\n' || c == '\t'))
+      {
+        m_decoded += ' ';
+        ++p;
+      }
+      else
+      {
+        m_decoded += c;
+        ++p;
+      }
+    }
+    return XmlStringView(m_decoded.data(), m_decoded.size());
+  }
+
+}}} // namespace Azure::Storage::_internal
@@ -3,6 +3,8 @@
 
 #include "azure/storage/common/internal/xml_wrapper.hpp"
 
+#include "azure/storage/common/internal/xml_pull_parser.hpp"
+
 #include <azure/core/platform.hpp>
 
 #include <cstring>
@@ -24,202 +26,56 @@
 // C++14. It causes an error. We can disable ICU C++ API to avoid it
 // because we don't need ICU C++ API.
 #define U_SHOW_CPLUSPLUS_API 0
-#include <libxml/xmlreader.h>
 #include <libxml/xmlwriter.h>
 #endif
 
 namespace Azure { namespace Storage { namespace _internal {
 
-#if defined(AZ_PLATFORM_WINDOWS)
-
-  void XmlGlobalInitialize() {}
-  void XmlGlobalDeinitialize() {}
-
+  // Documents are read by XmlPullParser on every platform. It returns the same nodes as the
+  // platform readers did; Read() copies each name and value into the returned XmlNode.
   struct XmlReader::XmlReaderContext
   {
-    XmlReaderContext()
-    {
-      HRESULT ret = WsCreateError(nullptr, 0, &error);
-      if (ret != NO_ERROR)
-      {
-        throw std::runtime_error("Failed to initialize xml reader.");
-      }
-      ret = WsCreateReader(nullptr, 0, &reader, error);
-      if (ret != NO_ERROR)
-      {
-        WsFreeError(error);
-        throw std::runtime_error("Failed to initialize xml reader.");
-      }
-    }
-    XmlReaderContext(const XmlReaderContext&) = delete;
-    XmlReaderContext& operator=(const XmlReaderContext&) = delete;
-    ~XmlReaderContext()
-    {
-      WsFreeReader(reader);
-      WsFreeError(error);
-    }
+    explicit XmlReaderContext(const char* data, size_t length) : parser(data, length) {}
 
-    WS_XML_READER* reader = nullptr;
-    WS_ERROR* error = nullptr;
-    bool readingAttributes = false;
-    ULONG attributeIndex = 0;
-    const WS_XML_ELEMENT_NODE* attributeElementNode = nullptr;
+    XmlPullParser parser;
   };
 
   XmlReader::XmlReader(const char* data, size_t length)
+      : m_context(std::make_unique<XmlReaderContext>(data, length))
   {
-    if (length > static_cast<size_t>((std::numeric_limits<ULONG>::max)()))
-    {
-      throw std::runtime_error("Xml data too big.");
-    }
-
-    auto context = std::make_unique<XmlReaderContext>();
-
-    WS_XML_READER_BUFFER_INPUT bufferInput;
-    ZeroMemory(&bufferInput, sizeof(bufferInput));
-    bufferInput.input.inputType = WS_XML_READER_INPUT_TYPE_BUFFER;
-    bufferInput.encodedData = const_cast<char*>(data);
-    bufferInput.encodedDataSize = static_cast<ULONG>(length);
-    WS_XML_READER_TEXT_ENCODING textEncoding;
-    ZeroMemory(&textEncoding, sizeof(textEncoding));
-    textEncoding.encoding.encodingType = WS_XML_READER_ENCODING_TYPE_TEXT;
-    textEncoding.charSet = WS_CHARSET_AUTO;
-    HRESULT ret = WsSetInput(
-        context->reader, &textEncoding.encoding, &bufferInput.input, nullptr, 0, context->error);
-    if (ret != S_OK)
-    {
-      throw std::runtime_error("Failed to initialize xml reader.");
-    }
+  }
 
-    WS_CHARSET charSet;
-    ret = WsGetReaderProperty(
-        context->reader, WS_XML_READER_PROPERTY_CHARSET, &charSet, sizeof(charSet), context->error);
-    if (ret != S_OK)
-    {
-      throw std::runtime_error("Failed to get xml encoding.");
-    }
-    if (charSet != WS_CHARSET_UTF8)
-    {
-      throw std::runtime_error("Unsupported xml encoding.");
-    }
+  XmlReader::XmlReader(XmlReader&& other) noexcept { *this = std::move(other); }
 
-    m_context = std::move(context);
+  XmlReader& XmlReader::operator=(XmlReader&& other) noexcept
+  {
+    m_context = std::move(other.m_context);
+    return *this;
   }
 
-  XmlReader::~XmlReader() {}
+  XmlReader::~XmlReader() = default;
 
   XmlNode XmlReader::Read()
   {
-    auto& context = m_context;
-
-    auto moveToNext = [&]() {
-      HRESULT ret = WsReadNode(context->reader, context->error);
-      if (!SUCCEEDED(ret))
-      {
-        throw std::runtime_error("Failed to parse xml.");
-      }
-    };
-
-    if (context->readingAttributes)
-    {
-      const WS_XML_ATTRIBUTE* attribute
-          = context->attributeElementNode->attributes[context->attributeIndex];
-
-      std::string name(
-          reinterpret_cast<const char*>(attribute->localName->bytes), attribute->localName->length);
-
-      if (attribute->value->textType != WS_XML_TEXT_TYPE_UTF8)
-      {
-        throw std::runtime_error("Unsupported xml encoding.");
-      }
-
-      const WS_XML_UTF8_TEXT* utf8Text
-          = reinterpret_cast<const WS_XML_UTF8_TEXT*>(attribute->value);
-      std::string value(
-          reinterpret_cast<const char*>(utf8Text->value.bytes), utf8Text->value.length);
-
-      if (++context->attributeIndex == context->attributeElementNode->attributeCount)
-      {
-        moveToNext();
-        context->readingAttributes = false;
-        context->attributeElementNode = nullptr;
-        context->attributeIndex = 0;
-      }
-
-      return XmlNode{XmlNodeType::Attribute, std::move(name), std::move(value)};
-    }
-
-    const WS_XML_NODE* node;
-    HRESULT ret = WsGetReaderNode(context->reader, &node, context->error);
-    if (!SUCCEEDED(ret))
-    {
-      throw std::runtime_error("Failed to parse xml.");
-    }
-    switch (node->nodeType)
-    {
-      case WS_XML_NODE_TYPE_ELEMENT: {
-        const WS_XML_ELEMENT_NODE* elementNode = reinterpret_cast<const WS_XML_ELEMENT_NODE*>(node);
-        std::string name(
-            reinterpret_cast<const char*>(elementNode->localName->bytes),
-            elementNode->localName->length);
-
-        if (elementNode->attributeCount != 0)
-        {
-          context->readingAttributes = true;
-          context->attributeElementNode = elementNode;
-          context->attributeIndex = 0;
-        }
-        else
-        {
-          moveToNext();
-        }
-
-        return XmlNode{XmlNodeType::StartTag, std::move(name)};
-      }
-      case WS_XML_NODE_TYPE_TEXT: {
-        std::string value;
-        while (true)
-        {
-          const WS_XML_TEXT_NODE* textNode = (const WS_XML_TEXT_NODE*)node;
-          if (textNode->text->textType != WS_XML_TEXT_TYPE_UTF8)
-          {
-            throw std::runtime_error("Unsupported xml encoding.");
-          }
-          const WS_XML_UTF8_TEXT* utf8Text
-              = reinterpret_cast<const WS_XML_UTF8_TEXT*>(textNode->text);
-          value += std::string(
-              reinterpret_cast<const char*>(utf8Text->value.bytes), utf8Text->value.length);
-
-          moveToNext();
-          ret = WsGetReaderNode(context->reader, &node, context->error);
-          if (!SUCCEEDED(ret))
-          {
-            throw std::runtime_error("Failed to parse xml.");
-          }
-          if (node->nodeType != WS_XML_NODE_TYPE_TEXT)
-          {
-            break;
-          }
-        }
-        return XmlNode{XmlNodeType::Text, std::string(), std::move(value)};
-      }
-      case WS_XML_NODE_TYPE_END_ELEMENT:
-        moveToNext();
-        return XmlNode{XmlNodeType::EndTag};
-      case WS_XML_NODE_TYPE_EOF:
-        return XmlNode{XmlNodeType::End};
-      case WS_XML_NODE_TYPE_CDATA:
-      case WS_XML_NODE_TYPE_END_CDATA:
-      case WS_XML_NODE_TYPE_COMMENT:
-      case WS_XML_NODE_TYPE_BOF:
-        moveToNext();
-        return Read();
+    auto const token = m_context->parser.Read();
+    switch (token.Type)
+    {
+      case XmlNodeType::StartTag:
+        return XmlNode{XmlNodeType::StartTag, token.Name};
+      case XmlNodeType::Attribute:
+        return XmlNode{XmlNodeType::Attribute, token.Name, token.Value};
+      case XmlNodeType::Text:
+        return XmlNode{XmlNodeType::Text, std::string(), token.Value};
       default:
-        throw std::runtime_error(
-            "Unknown type " + std::to_string(node->nodeType) + " while parsing xml.");
+        return XmlNode{token.Type};
     }
   }
 
+#if defined(AZ_PLATFORM_WINDOWS)
+
+  void XmlGlobalInitialize() {}
+  void XmlGlobalDeinitialize() {}
+
   struct XmlWriter::XmlWriterContext
   {
     XmlWriterContext()
@@ -396,130 +252,6 @@ namespace Azure { namespace Storage { namespace _internal {
 
   static void XmlGlobalInitialize() { static XmlGlobalInitializer globalInitializer; }
 
-  struct XmlReader::XmlReaderContext
-  {
-    using XmlTextReaderPtr = std::unique_ptr<xmlTextReader, decltype(&xmlFreeTextReader)>;
-
-    XmlTextReaderPtr reader;
-    bool readingAttributes = false;
-    bool readingEmptyTag = false;
-
-    explicit XmlReaderContext(XmlTextReaderPtr&& reader_) : reader(std::move(reader_)) {}
-  };
-
-  XmlReader::XmlReader(const char* data, size_t length)
-  {
-    XmlGlobalInitialize();
-
-    if (length > static_cast<size_t>((std::numeric_limits<int>::max)()))
-    {
-      throw std::runtime_error("Xml data too big.");
-    }
-
-    auto reader = XmlReaderContext::XmlTextReaderPtr(
-        xmlReaderForMemory(data, static_cast<int>(length), nullptr, nullptr, 0), xmlFreeTextReader);
-
-    if (!reader)
-    {
-      throw std::runtime_error("Failed to parse xml.");
-    }
-
-    m_context = std::make_unique<XmlReaderContext>(std::move(reader));
-  }
-
-  XmlReader::XmlReader(XmlReader&& other) noexcept { *this = std::move(other); }
-
-  XmlReader& XmlReader::operator=(XmlReader&& other) noexcept
-  {
-    m_context = std::move(other.m_context);
-    return *this;
-  }
-
-  XmlReader::~XmlReader() = default;
-
-  XmlNode XmlReader::Read()
-  {
-    XmlReaderContext* context = m_context.get();
-    xmlTextReader* reader = m_context->reader.get();
-    if (context->readingAttributes)
-    {
-      int ret = xmlTextReaderMoveToNextAttribute(reader);
-      if (ret == 1)
-      {
-        const char* name = reinterpret_cast<const char*>(xmlTextReaderConstName(reader));
-        const char* value = reinterpret_cast<const char*>(xmlTextReaderConstValue(reader));
-        return XmlNode{XmlNodeType::Attribute, name, value};
-      }
-      else if (ret == 0)
-      {
-        context->readingAttributes = false;
-      }
-      else
-      {
-        throw std::runtime_error("Failed to parse xml.");
-      }
-    }
-    if (context->readingEmptyTag)
-    {
-      context->readingEmptyTag = false;
-      return XmlNode{XmlNodeType::EndTag};
-    }
-
-    int ret = xmlTextReaderRead(reader);
-    if (ret == 0)
-    {
-      return XmlNode{XmlNodeType::End};
-    }
-    if (ret != 1)
-    {
-      throw std::runtime_error("Failed to parse xml.");
-    }
-
-    int type = xmlTextReaderNodeType(reader);
-    bool is_empty = xmlTextReaderIsEmptyElement(reader) == 1;
-    bool has_value = xmlTextReaderHasValue(reader) == 1;
-    bool has_attributes = xmlTextReaderHasAttributes(reader) == 1;
-
-    const char* name = reinterpret_cast<const char*>(xmlTextReaderConstName(reader));
-    const char* value = reinterpret_cast<const char*>(xmlTextReaderConstValue(reader));
-
-    if (has_attributes)
-    {
-      context->readingAttributes = true;
-    }
-
-    if (type == XML_READER_TYPE_ELEMENT && is_empty)
-    {
-      context->readingEmptyTag = true;
-      return XmlNode{XmlNodeType::StartTag, name};
-    }
-    else if (type == XML_READER_TYPE_ELEMENT)
-    {
-      return XmlNode{XmlNodeType::StartTag, name};
-    }
-    else if (type == XML_READER_TYPE_END_ELEMENT)
-    {
-      return XmlNode{XmlNodeType::EndTag};
-    }
-    else if (type == XML_READER_TYPE_TEXT)
-    {
-      if (has_value)
-      {
-        return XmlNode{XmlNodeType::Text, std::string(), value};
-      }
-    }
-    else if (type == XML_READER_TYPE_SIGNIFICANT_WHITESPACE)
-    {
-      // silently ignore
-    }
-    else
-    {
-      throw std::runtime_error("Unknown type " + std::to_string(type) + " while parsing xml.");
-    }
-
-    return Read();
-  }
-
   struct XmlWriter::XmlWriterContext
   {
     using XmlBufferPtr = std::unique_ptr<xmlBuffer, decltype(&xmlBufferFree)>;
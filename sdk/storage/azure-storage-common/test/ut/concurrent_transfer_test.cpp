@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/concurrent_transfer.hpp>
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(ConcurrentTransferTest, AllChunksTransferred)
+  {
+    const int64_t length = 1000;
+    const int64_t chunkSize = 7;
+    std::vector<int> transferred(static_cast<size_t>(length), 0);
+    std::mutex transferredMutex;
+    std::atomic<int> numChunks{0};
+
+    _internal::ConcurrentTransfer(
+        0, length, chunkSize, 8, [&](int64_t offset, int64_t chunkLength, int64_t, int64_t total) {
+          EXPECT_EQ(total, (length + chunkSize - 1) / chunkSize);
+          std::lock_guard<std::mutex> guard(transferredMutex);
+          for (int64_t i = offset; i < offset + chunkLength; ++i)
+          {
+            ++transferred[static_cast<size_t>(i)];
+          }
+          ++numChunks;
+        });
+
+    EXPECT_EQ(numChunks.load(), (length + chunkSize - 1) / chunkSize);
+    for (auto count : transferred)
+    {
+      EXPECT_EQ(count, 1);
+    }
+  }
+
+  TEST(ConcurrentTransferTest, ConcurrencyIsBounded)
+  {
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+
+    _internal::ConcurrentTransfer(0, 64, 1, 3, [&](int64_t, int64_t, int64_t, int64_t) {
+      int current = ++running;
+      int observed = maxRunning.load();
+      while (current > observed && !maxRunning.compare_exchange_weak(observed, current))
+      {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      --running;
+    });
+
+    EXPECT_LE(maxRunning.load(), 3);
+  }
+
+  TEST(ConcurrentTransferTest, ParallelTransfers)
+  {
+    std::vector<std::future<int64_t>> transfers;
+    for (int i = 0; i < 32; ++i)
+    {
+      transfers.push_back(std::async(std::launch::async, []() {
+        std::atomic<int64_t> bytes{0};
+        _internal::ConcurrentTransfer(
+            0, 4096, 100, 5, [&](int64_t, int64_t chunkLength, int64_t, int64_t) {
+              bytes += chunkLength;
+            });
+        return bytes.load();
+      }));
+    }
+    for (auto& transfer : transfers)
+    {
+      EXPECT_EQ(transfer.get(), 4096);
+    }
+  }
+
+  TEST(ConcurrentTransferTest, FirstExceptionIsRethrown)
+  {
+    std::atomic<int> numChunks{0};
+    EXPECT_THROW(
+        _internal::ConcurrentTransfer(
+            0,
+            100,
+            1,
+            4,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t) {
+              ++numChunks;
+              if (chunkId == 10)
+              {
+                throw std::runtime_error("chunk failed");
+              }
+            }),
+        std::runtime_error);
+    EXPECT_LT(numChunks.load(), 100);
+  }
+
+  TEST(ConcurrentTransferTest, Cancelled)
+  {
+    Azure::Core::Context context;
+    std::atomic<int> numChunks{0};
+    EXPECT_THROW(
+        _internal::ConcurrentTransfer(
+            0,
+            100,
+            1,
+            4,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t) {
+              ++numChunks;
+              if (chunkId == 10)
+              {
+                context.Cancel();
+              }
+            },
+            context),
+        Azure::Core::OperationCancelledException);
+    EXPECT_LT(numChunks.load(), 100);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -31,6 +31,29 @@ namespace Azure { namespace Storage { namespace Test {
         "+SBESxQVhI53mSEdZJcCBpdBkaqwzfPaVYZMAf5LP3c=");
   }
 
+  TEST_F(CryptFunctionsTest, HmacSha256Signer)
+  {
+    for (size_t keySize : {1, 32, 64, 65, 100})
+    {
+      auto const key = RandomBuffer(keySize);
+      _internal::HmacSha256Signer const signer(key);
+      for (size_t dataSize : {0, 1, 55, 64, 1000})
+      {
+        auto const data = RandomBuffer(dataSize);
+        EXPECT_EQ(signer.Sign(data.data(), data.size()), _internal::HmacSha256(data, key));
+        // Signing does not change the prepared states of the key.
+        EXPECT_EQ(signer.Sign(data.data(), data.size()), _internal::HmacSha256(data, key));
+      }
+    }
+
+    std::string key = "8CwtGFF1mGR4bPEP9eZ0x1fxKiQ3Ca5N";
+    _internal::HmacSha256Signer const signer(std::vector<uint8_t>(key.begin(), key.end()));
+    auto const data = ToBinaryVector("Hello Azure!");
+    EXPECT_EQ(
+        Azure::Core::Convert::Base64Encode(signer.Sign(data.data(), data.size())),
+        "+SBESxQVhI53mSEdZJcCBpdBkaqwzfPaVYZMAf5LP3c=");
+  }
+
   static std::vector<uint8_t> ComputeHash(const std::string& data)
   {
     const uint8_t* ptr = reinterpret_cast<const uint8_t*>(data.data());
@@ -114,6 +137,49 @@ namespace Azure { namespace Storage { namespace Test {
         crc64Single.Final(reinterpret_cast<const uint8_t*>(allData.data()), allData.size()));
   }
 
+  TEST_F(CryptFunctionsTest, Crc64Hash_Kernels)
+  {
+    const std::vector<_internal::Crc64Kernel> kernels = {
+        _internal::Crc64Kernel::Auto,
+        _internal::Crc64Kernel::Pclmul,
+        _internal::Crc64Kernel::Vpclmul,
+        _internal::Crc64Kernel::Pmull,
+    };
+
+    auto data = RandomBuffer(static_cast<size_t>(64_KB));
+    const std::vector<size_t> lengths = {0, 1, 15, 16, 63, 127, 128, 129, 255, 256, 511, 512, 513,
+                                         1023, 1024, 4097, 64_KB - 3};
+    for (auto kernel : kernels)
+    {
+      if (!_internal::IsCrc64KernelSupported(kernel))
+      {
+        EXPECT_THROW(
+            _internal::Crc64Append(kernel, 0, data.data(), data.size()), std::invalid_argument);
+        continue;
+      }
+      for (size_t start : {0, 1, 7})
+      {
+        for (size_t length : lengths)
+        {
+          length = (std::min)(length, data.size() - start);
+          const uint64_t initialCrc = static_cast<uint64_t>(RandomInt(0, 1 << 30));
+          EXPECT_EQ(
+              _internal::Crc64Append(kernel, initialCrc, data.data() + start, length),
+              _internal::Crc64Append(
+                  _internal::Crc64Kernel::Table, initialCrc, data.data() + start, length));
+        }
+      }
+    }
+
+    EXPECT_EQ(
+        _internal::Crc64Append(
+            _internal::Crc64Kernel::Auto,
+            0,
+            reinterpret_cast<const uint8_t*>("Hello Azure!"),
+            strlen("Hello Azure!")),
+        0xc7a37fbfa4d9d80eULL);
+  }
+
   TEST_F(CryptFunctionsTest, Crc64Hash_CtorDtor)
   {
     {
@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/file_io.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    std::vector<uint8_t> MakeContent(size_t size)
+    {
+      std::vector<uint8_t> content(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        content[i] = static_cast<uint8_t>(i * 31 + 7);
+      }
+      return content;
+    }
+
+    std::vector<uint8_t> ReadFile(const std::string& fileName)
+    {
+      std::ifstream file(fileName, std::ios::binary);
+      return std::vector<uint8_t>(
+          (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+  } // namespace
+
+  TEST(FileIoTest, ReaderMapsFile)
+  {
+    const std::string fileName = "FileIoTest.ReaderMapsFile.bin";
+    const auto content = MakeContent(1024 * 1024 + 123);
+    {
+      _internal::FileWriter writer(fileName);
+      writer.Write(content.data(), content.size(), 0);
+    }
+    {
+      // Files are only mapped on request.
+      _internal::FileReader reader(fileName);
+      EXPECT_EQ(reader.GetFileSize(), static_cast<int64_t>(content.size()));
+      EXPECT_EQ(reader.GetMappedData(), nullptr);
+    }
+    {
+      _internal::FileReader reader(fileName, true);
+      EXPECT_EQ(reader.GetFileSize(), static_cast<int64_t>(content.size()));
+      if (reader.GetMappedData())
+      {
+        EXPECT_EQ(
+            std::vector<uint8_t>(reader.GetMappedData(), reader.GetMappedData() + content.size()),
+            content);
+      }
+    }
+    std::remove(fileName.data());
+  }
+
+  TEST(FileIoTest, EmptyFileIsNotMapped)
+  {
+    const std::string fileName = "FileIoTest.EmptyFileIsNotMapped.bin";
+    {
+      _internal::FileWriter writer(fileName);
+    }
+    {
+      _internal::FileReader reader(fileName, true);
+      EXPECT_EQ(reader.GetFileSize(), 0);
+      EXPECT_EQ(reader.GetMappedData(), nullptr);
+    }
+    std::remove(fileName.data());
+  }
+
+  TEST(FileIoTest, UnbufferedWriter)
+  {
+    const std::string fileName = "FileIoTest.UnbufferedWriter.bin";
+    constexpr size_t alignment = _internal::UnbufferedFileIoAlignment;
+    // Aligned buffer, so that the aligned ranges below can be written without the file cache.
+    std::vector<uint8_t> storage(4 * alignment + 100 + alignment);
+    uint8_t* buffer = storage.data()
+        + (alignment - reinterpret_cast<uintptr_t>(storage.data()) % alignment) % alignment;
+    const auto content = MakeContent(4 * alignment + 100);
+    std::copy(content.begin(), content.end(), buffer);
+    {
+      _internal::FileWriter writer(fileName, true);
+      // Aligned range, written out of order.
+      writer.Write(buffer + 2 * alignment, 2 * alignment, 2 * alignment);
+      // Unaligned tail.
+      writer.Write(buffer + 4 * alignment, 100, 4 * alignment);
+      // Aligned range.
+      writer.Write(buffer, 2 * alignment, 0);
+    }
+    EXPECT_EQ(ReadFile(fileName), content);
+    std::remove(fileName.data());
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -3,10 +3,70 @@
 
 #include "test_base.hpp"
 
+#include <azure/core/internal/http/pipeline.hpp>
+#include <azure/storage/common/internal/shared_key_policy.hpp>
 #include <azure/storage/common/storage_credential.hpp>
 
 namespace Azure { namespace Storage { namespace Test {
 
+  namespace {
+    class NoOpTransportPolicy final : public Core::Http::Policies::HttpPolicy {
+    public:
+      std::unique_ptr<Core::Http::RawResponse> Send(
+          Core::Http::Request&,
+          Core::Http::Policies::NextHttpPolicy,
+          Core::Context const&) const override
+      {
+        return std::make_unique<Core::Http::RawResponse>(
+            1, 1, Core::Http::HttpStatusCode::Created, "Created");
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<NoOpTransportPolicy>(*this);
+      }
+    };
+
+    std::string SignRequest(
+        std::shared_ptr<StorageSharedKeyCredential> credential,
+        Core::Http::Request& request)
+    {
+      std::vector<std::unique_ptr<Core::Http::Policies::HttpPolicy>> policies;
+      policies.emplace_back(std::make_unique<_internal::SharedKeyPolicy>(credential));
+      policies.emplace_back(std::make_unique<NoOpTransportPolicy>());
+      Core::Http::_internal::HttpPipeline pipeline(policies);
+      pipeline.Send(request, Core::Context());
+      return request.GetHeaders().at("authorization");
+    }
+  } // namespace
+
+  TEST(StorageCredentialTest, SharedKeySignature)
+  {
+    auto credential = std::make_shared<StorageSharedKeyCredential>(
+        "account", "MDEyMzQ1Njc4OWFiY2RlZjAxMjM0NTY3ODlhYmNkZWY=");
+
+    Core::Http::Request request(
+        Core::Http::HttpMethod::Put,
+        Core::Url("https://account.blob.core.windows.net/container/blob?comp=block&BlockId="
+                  "AB%20C%3D"));
+    request.SetHeader("Content-Length", "5");
+    request.SetHeader("Content-Type", "text/plain");
+    request.SetHeader("x-ms-version", "2025-01-05");
+    request.SetHeader("x-ms-date", "Thu, 01 Jan 2026 00:00:00 GMT");
+    request.SetHeader("x-ms-blob-type", "BlockBlob");
+    // '-' is ignored when sorting headers, so these are signed in the reverse of their map order.
+    request.SetHeader("x-ms-meta-a-c", "2");
+    request.SetHeader("x-ms-meta-ab", "1");
+
+    auto const expected = "SharedKey account:Uw3iyHISGJHfp1JvF5HsgwuWBWrIWpfNoeDTs712EaU=";
+    EXPECT_EQ(SignRequest(credential, request), expected);
+    // The signing buffers and the key states are reused.
+    EXPECT_EQ(SignRequest(credential, request), expected);
+
+    credential->Update("MTIzNDU2Nzg5MGFiY2RlZjEyMzQ1Njc4OTBhYmNkZWY=");
+    EXPECT_NE(SignRequest(credential, request), expected);
+  }
+
   TEST(StorageCredentialTest, DefaultHostCorrect)
   {
     EXPECT_EQ(
@@ -0,0 +1,322 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+#include "test_base.hpp"
+
+#include <azure/storage/common/internal/xml_pull_parser.hpp>
+#include <azure/storage/common/internal/xml_wrapper.hpp>
+
+#include <ostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    const std::string ListBlobsResponse
+        = "\xEF\xBB\xBF<?xml version=\"1.0\" encoding=\"utf-8\"?>\r\n"
+          "<EnumerationResults ServiceEndpoint=\"https://account.blob.core.windows.net/\" "
+          "ContainerName='container'>\n"
+          "  <Prefix />\n"
+          "  <Blobs>\n"
+          "    <Blob>\n"
+          "      <Name Encoded=\"false\">a&amp;b &lt;c&gt; &#x4E2D;&#25991;</Name>\n"
+          "      <Properties>\n"
+          "        <Last-Modified>Tue, 19 Nov 2013 14:30:59 GMT</Last-Modified>\n"
+          "        <Etag>\"0x8D9\"</Etag>\n"
+          "      </Properties>\n"
+          "      <Metadata><key1>value1</key1><key2></key2></Metadata>\n"
+          "    </Blob>\n"
+          "  </Blobs>\n"
+          "  <NextMarker>marker</NextMarker>\n"
+          "</EnumerationResults>\n";
+
+    struct Node
+    {
+      _internal::XmlNodeType Type;
+      std::string Name;
+      std::string Value;
+
+      bool operator==(const Node& other) const
+      {
+        return Type == other.Type && Name == other.Name && Value == other.Value;
+      }
+
+      friend std::ostream& operator<<(std::ostream& os, const Node& node)
+      {
+        return os << static_cast<int>(node.Type) << " '" << node.Name << "' '" << node.Value << "'";
+      }
+    };
+
+    std::vector<Node> ReadAll(_internal::XmlReader& reader)
+    {
+      std::vector<Node> nodes;
+      while (true)
+      {
+        auto node = reader.Read();
+        nodes.push_back(Node{node.Type, node.Name, node.Value});
+        if (node.Type == _internal::XmlNodeType::End)
+        {
+          return nodes;
+        }
+      }
+    }
+
+    std::vector<Node> ReadAll(_internal::XmlPullParser& parser)
+    {
+      std::vector<Node> nodes;
+      while (true)
+      {
+        auto node = parser.Read();
+        nodes.push_back(Node{node.Type, node.Name, node.Value});
+        if (node.Type == _internal::XmlNodeType::End)
+        {
+          return nodes;
+        }
+      }
+    }
+
+    std::vector<Node> ParseAll(const std::string& xml)
+    {
+      _internal::XmlPullParser parser(xml.data(), xml.size());
+      return ReadAll(parser);
+    }
+  } // namespace
+
+  TEST(XmlPullParserTest, ReadsNodesInOrder)
+  {
+    using _internal::XmlNodeType;
+    std::vector<Node> const expected = {
+        {XmlNodeType::StartTag, "EnumerationResults", ""},
+        {XmlNodeType::Attribute, "ServiceEndpoint", "https://account.blob.core.windows.net/"},
+        {XmlNodeType::Attribute, "ContainerName", "container"},
+        {XmlNodeType::StartTag, "Prefix", ""},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::StartTag, "Blobs", ""},
+        {XmlNodeType::StartTag, "Blob", ""},
+        {XmlNodeType::StartTag, "Name", ""},
+        {XmlNodeType::Attribute, "Encoded", "false"},
+        {XmlNodeType::Text, "", "a&b <c> \xE4\xB8\xAD\xE6\x96\x87"},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::StartTag, "Properties", ""},
+        {XmlNodeType::StartTag, "Last-Modified", ""},
+        {XmlNodeType::Text, "", "Tue, 19 Nov 2013 14:30:59 GMT"},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::StartTag, "Etag", ""},
+        {XmlNodeType::Text, "", "\"0x8D9\""},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::StartTag, "Metadata", ""},
+        {XmlNodeType::StartTag, "key1", ""},
+        {XmlNodeType::Text, "", "value1"},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::StartTag, "key2", ""},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::StartTag, "NextMarker", ""},
+        {XmlNodeType::Text, "", "marker"},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::EndTag, "", ""},
+        {XmlNodeType::End, "", ""},
+    };
+
+    EXPECT_EQ(ParseAll(ListBlobsResponse), expected);
+
+    // XmlReader returns the same nodes, as strings.
+    _internal::XmlReader reader(ListBlobsResponse.data(), ListBlobsResponse.size());
+    EXPECT_EQ(ReadAll(reader), expected);
+  }
+
+  TEST(XmlPullParserTest, ValuesAreViews)
+  {
+    const std::string xml = "<a b=\"attribute\">text</a>";
+    _internal::XmlPullParser parser(xml.data(), xml.size());
+
+    auto node = parser.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::StartTag);
+    EXPECT_EQ(node.Name.Data(), xml.data() + 1);
+    EXPECT_TRUE(node.Name == "a");
+
+    node = parser.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::Attribute);
+    EXPECT_EQ(node.Value.Data(), xml.data() + 6);
+    EXPECT_TRUE(node.Value == std::string("attribute"));
+
+    node = parser.Read();
+    EXPECT_EQ(node.Type, _internal::XmlNodeType::Text);
+    EXPECT_EQ(node.Value.Data(), xml.data() + 17);
+    std::string value;
+    value = node.Value;
+    EXPECT_EQ(value, "text");
+    EXPECT_TRUE(node.Value != "tex");
+
+    EXPECT_EQ(parser.Read().Type, _internal::XmlNodeType::EndTag);
+    EXPECT_EQ(parser.Read().Type, _internal::XmlNodeType::End);
+  }
+
+  TEST(XmlPullParserTest, Decoding)
+  {
+    auto const nodes
+        = ParseAll("<a b=\"x&#10;y\tz\r\nw\">line1\r\nline2\rline3<![CDATA[<&>]]></a>");
+    ASSERT_EQ(nodes.size(), 6u);
+    EXPECT_EQ(nodes[1].Value, "x\ny z w");
+    EXPECT_EQ(nodes[2].Value, "line1\nline2\nline3");
+    EXPECT_EQ(nodes[3].Value, "<&>");
+  }
+
+  TEST(XmlPullParserTest, SkipsCommentsAndDeclarations)
+  {
+    auto const nodes = ParseAll(
+        "<?xml version=\"1.0\"?><!DOCTYPE a [<!ELEMENT a ANY>]><!-- 1 --><a><!-- 2 --></a>");
+    ASSERT_EQ(nodes.size(), 3u);
+    EXPECT_EQ(nodes[0].Type, _internal::XmlNodeType::StartTag);
+    EXPECT_EQ(nodes[1].Type, _internal::XmlNodeType::EndTag);
+    EXPECT_EQ(nodes[2].Type, _internal::XmlNodeType::End);
+  }
+
+  TEST(XmlPullParserTest, MalformedDocuments)
+  {
+    for (auto const& xml : std::vector<std::string>{
+             "",
+             "   ",
+             "<a>",
+             "<a></b>",
+             "<a></a><b></b>",
+             "text<a></a>",
+             "<a>&unknown;</a>",
+             "<a>&#0;</a>",
+             "<a b></a>",
+             "<a b=\"c></a>",
+             "<a b=\"c\"d=\"e\"></a>",
+             "<a><!-- comment </a>",
+             "<a><!-- a -- b --></a>",
+             "<a b=\"1\" b=\"2\"></a>",
+             "<a b=\"<\"></a>",
+             "<a>]]></a>",
+             "<1a></1a>",
+             "<a></ a>",
+             "<a></a ",
+             "<a><?xml version=\"1.0\"?></a>",
+             "<a><? ?></a>",
+             "<a></a><!DOCTYPE a>",
+             "<!DOCTYPE a><!DOCTYPE a><a></a>",
+             "<!ELEMENT a ANY><a></a>",
+             "<?xml?><a></a>",
+             "<?xml encoding=\"utf-8\"?><a></a>",
+             "<?xml version=\"1.0\" standalone=\"yes\" encoding=\"utf-8\"?><a></a>",
+             "<?xml version=\"1.0\" standalone=\"maybe\"?><a></a>",
+             "<?xml version=\"1.0\" foo=\"bar\"?><a></a>",
+         })
+    {
+      EXPECT_THROW(ParseAll(xml), std::runtime_error) << xml;
+    }
+  }
+
+  TEST(XmlPullParserTest, WellFormedDocuments)
+  {
+    for (auto const& xml : std::vector<std::string>{
+             "<a/>",
+             "<a:b xmlns:a=\"urn:a\" c.d-e_f='1'/>",
+             "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?><a></a >",
+             "<?xml version='1.0' encoding='utf-8'?>\n<a/>\n<!-- trailing -->\n",
+             "<?xml-stylesheet href=\"a.xsl\"?><a><?pi data?></a>",
+             "<!DOCTYPE a [<!ATTLIST a b CDATA \"]>\">]><a/>",
+             "<a>&#x10FFFF;&#9;</a>",
+             "<\xC3\xA9>\xE2\x82\xAC \xF0\x9F\x98\x80</\xC3\xA9>",
+         })
+    {
+      EXPECT_NO_THROW(ParseAll(xml)) << xml;
+    }
+  }
+
+  TEST(XmlPullParserTest, RejectsOtherEncodings)
+  {
+    for (auto const& xml : std::vector<std::string>{
+             "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?><a></a>",
+             "<?xml version=\"1.0\" encoding=\"utf-16\"?><a></a>",
+             std::string("\xFF\xFE<\0a\0/\0>\0", 10),
+             std::string("\xFE\xFF\0<\0a\0/\0>", 10),
+             std::string("<\0a\0/\0>\0", 8),
+         })
+    {
+      EXPECT_THROW(ParseAll(xml), std::runtime_error) << xml;
+      _internal::XmlReader* reader = nullptr;
+      EXPECT_THROW(reader = new _internal::XmlReader(xml.data(), xml.size()), std::runtime_error);
+      delete reader;
+    }
+  }
+
+  TEST(XmlPullParserTest, RejectsInvalidCharacters)
+  {
+    for (auto const& xml : std::vector<std::string>{
+             "<a>\x80</a>",
+             "<a>\xC3</a>",
+             "<a>\xC3\x28</a>",
+             "<a>\xC0\xAF</a>",
+             "<a>\xE0\x80\xAF</a>",
+             "<a>\xED\xA0\x80</a>",
+             "<a>\xEF\xBF\xBE</a>",
+             "<a>\xF4\x90\x80\x80</a>",
+             "<a>\xF8\x88\x80\x80\x80</a>",
+             "<a>\x01</a>",
+             "<a b=\"\x1F\"/>",
+             std::string("<a>\0</a>", 8),
+             "<a>&#1;</a>",
+             "<a>&#xD800;</a>",
+             "<a>&#xFFFE;</a>",
+             "<a>&#x110000;</a>",
+         })
+    {
+      EXPECT_THROW(ParseAll(xml), std::runtime_error) << xml;
+    }
+  }
+
+  // Mutates a valid document at random. Every mutation either parses or fails with
+  // std::runtime_error; none may crash, hang or read outside the document.
+  TEST(XmlPullParserTest, MutatedDocuments)
+  {
+    std::mt19937 random(20241017);
+    const std::string bytes = "<>/?!=\"'&;#x[]- \r\n\t\0aZ\x80\xBF\xC3\xE2\xEF\xF0\xFF";
+    for (int iteration = 0; iteration < 20000; ++iteration)
+    {
+      auto xml = ListBlobsResponse;
+      auto const mutations = 1 + random() % 4;
+      for (unsigned int i = 0; i < mutations && !xml.empty(); ++i)
+      {
+        auto const position = random() % xml.size();
+        auto const byte = bytes[random() % bytes.size()];
+        switch (random() % 4)
+        {
+          case 0:
+            xml[position] = byte;
+            break;
+          case 1:
+            xml.insert(xml.begin() + position, byte);
+            break;
+          case 2:
+            xml.erase(position, 1 + random() % 8);
+            break;
+          default:
+            xml.resize(position);
+            break;
+        }
+      }
+
+      // The parser reads up to the end of the data it is given, so give it exactly that.
+      std::vector<char> data(xml.begin(), xml.end());
+      try
+      {
+        _internal::XmlPullParser parser(data.data(), data.size());
+        ReadAll(parser);
+      }
+      catch (std::runtime_error const&)
+      {
+      }
+    }
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -1032,7 +1032,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        context);
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = fileRangeSize;
     return ret;
@@ -1150,7 +1151,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         remainingSize,
         options.TransferOptions.ChunkSize,
         options.TransferOptions.Concurrency,
-        downloadChunkFunc);
+        downloadChunkFunc,
+        context);
     ret.Value.ContentRange.Offset = firstChunkOffset;
     ret.Value.ContentRange.Length = fileRangeSize;
     return ret;
@@ -1258,7 +1260,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     if (bufferSize > 0)
     {
       _internal::ConcurrentTransfer(
-          0, bufferSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0,
+          bufferSize,
+          chunkSize,
+          options.TransferOptions.Concurrency,
+          uploadPageFunc,
+          context);
     }
 
     Models::UploadFileFromResult result;
@@ -1370,7 +1377,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     if (fileSize > 0)
     {
       _internal::ConcurrentTransfer(
-          0, fileSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc);
+          0, fileSize, chunkSize, options.TransferOptions.Concurrency, uploadPageFunc, context);
     }
 
     Models::UploadFileFromResult result;
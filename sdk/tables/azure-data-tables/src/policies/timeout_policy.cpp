@@ -16,14 +16,11 @@ namespace Azure { namespace Data { namespace Tables { namespace _detail { namesp
       Core::Http::Policies::NextHttpPolicy nextPolicy,
       Core::Context const& context) const
   {
-    const auto& headers = request.GetHeaders();
-    if (headers.find(HttpHeaderDate) == headers.end())
+    if (!request.GetHeader(HttpHeaderDate).HasValue())
     {
       // add x-ms-date header in RFC1123 format
       request.SetHeader(
-          HttpHeaderXMsDate,
-          DateTime(std::chrono::system_clock::now())
-              .ToString(Azure::DateTime::DateFormat::Rfc1123));
+          HttpHeaderXMsDate, Core::_internal::DateTimeFormatter::GetCurrentTimeRfc1123());
     }
 
     auto cancelTimepoint = context.GetDeadline();
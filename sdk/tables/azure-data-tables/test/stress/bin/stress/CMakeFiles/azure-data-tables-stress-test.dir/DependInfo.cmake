@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/sdk/tables/azure-data-tables/test/stress/tables_stress_test.cpp" "sdk/tables/azure-data-tables/test/stress/CMakeFiles/azure-data-tables-stress-test.dir/tables_stress_test.cpp.o" "gcc" "sdk/tables/azure-data-tables/test/stress/CMakeFiles/azure-data-tables-stress-test.dir/tables_stress_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build/sdk/tables/azure-data-tables/CMakeFiles/azure-data-tables.dir/DependInfo.cmake"
+  "/root/repo/_gate_build/sdk/core/azure-core/CMakeFiles/azure-core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/azure-data-tables-stress-test.dir/tables_stress_test.cpp.o"
+  "CMakeFiles/azure-data-tables-stress-test.dir/tables_stress_test.cpp.o.d"
+  "azure-data-tables-stress-test"
+  "azure-data-tables-stress-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/azure-data-tables-stress-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
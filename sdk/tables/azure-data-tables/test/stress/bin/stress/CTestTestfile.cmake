@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/sdk/tables/azure-data-tables/test/stress
+# Build directory: /root/repo/_gate_build/sdk/tables/azure-data-tables/test/stress
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.